@@ -0,0 +1,149 @@
+/*
+ * JUXTA Activity Metrics Implementation
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "activity.h"
+#include <string.h>
+
+static uint16_t sat_u16(uint64_t value)
+{
+    return (value > UINT16_MAX) ? UINT16_MAX : (uint16_t)value;
+}
+
+static int8_t posture_axis(int64_t sum, uint32_t samples)
+{
+    int64_t mean = sum / (int64_t)samples;
+    int64_t units = (mean >= 0) ? (mean + JUXTA_ACTIVITY_POSTURE_MG / 2) / JUXTA_ACTIVITY_POSTURE_MG
+                                : -((-mean + JUXTA_ACTIVITY_POSTURE_MG / 2) / JUXTA_ACTIVITY_POSTURE_MG);
+    return (units < INT8_MIN) ? INT8_MIN : (units > INT8_MAX) ? INT8_MAX : (int8_t)units;
+}
+
+uint32_t juxta_activity_isqrt(uint64_t value)
+{
+    uint64_t root = 0;
+    uint64_t bit = 1ULL << 62;
+
+    while (bit > value)
+    {
+        bit >>= 2;
+    }
+    while (bit)
+    {
+        if (value >= root + bit)
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)root;
+}
+
+void juxta_activity_init(struct juxta_activity *act, uint16_t window_samples, uint16_t threshold_mg)
+{
+    memset(act, 0, sizeof(*act));
+    act->window_samples = window_samples ? window_samples : 1;
+    act->threshold_mg = threshold_mg;
+}
+
+bool juxta_activity_add(struct juxta_activity *act, int16_t x_mg, int16_t y_mg, int16_t z_mg)
+{
+    const int32_t raw[3] = {x_mg, y_mg, z_mg};
+    int32_t dyn[3];
+    bool over = false;
+
+    if (!act->primed)
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            act->static_q[i] = raw[i] * (1 << JUXTA_ACTIVITY_STATIC_SHIFT);
+        }
+        act->primed = true;
+    }
+
+    uint32_t odba = 0;
+    uint32_t dyn_sq = 0;
+    uint32_t mag_sq = 0;
+    for (int i = 0; i < 3; i++)
+    {
+        /* Static part follows slowly; what remains is body movement */
+        act->static_q[i] += raw[i] - (act->static_q[i] >> JUXTA_ACTIVITY_STATIC_SHIFT);
+        dyn[i] = raw[i] - (act->static_q[i] >> JUXTA_ACTIVITY_STATIC_SHIFT);
+
+        uint32_t mag = (uint32_t)((dyn[i] < 0) ? -dyn[i] : dyn[i]);
+        odba += mag;
+        dyn_sq += mag * mag;
+        mag_sq += (uint32_t)(raw[i] * raw[i]);
+        if (mag > act->threshold_mg)
+        {
+            over = true;
+        }
+        act->axis_sum[i] += raw[i];
+    }
+
+    uint32_t mag = juxta_activity_isqrt(mag_sq);
+    act->samples++;
+    act->odba_sum += odba;
+    act->vedba_sum += juxta_activity_isqrt(dyn_sq);
+    act->mag_sum += mag;
+    act->mag_sq_sum += (uint64_t)mag * mag;
+
+    /* At most one motion event per window, like the old 1 s interrupt hold-off */
+    bool new_event = false;
+    if (over && !act->window_flagged && act->threshold_mg)
+    {
+        act->window_flagged = true;
+        if (act->motion_events < UINT8_MAX)
+        {
+            act->motion_events++;
+        }
+        new_event = true;
+    }
+    if (++act->window_pos >= act->window_samples)
+    {
+        act->window_pos = 0;
+        act->window_flagged = false;
+    }
+
+    return new_event;
+}
+
+void juxta_activity_take(struct juxta_activity *act, struct juxta_activity_minute *out)
+{
+    memset(out, 0, sizeof(*out));
+    out->motion_events = act->motion_events;
+
+    uint32_t n = act->samples;
+    if (n > 0)
+    {
+        /* n * sum(m^2) - sum(m)^2 before dividing, so a truncated mean does not
+         * cost a few mg next to 1 g; fits 64 bits up to 65535 samples */
+        uint64_t scaled_sq = (uint64_t)n * act->mag_sq_sum;
+        uint64_t sum_sq = act->mag_sum * act->mag_sum;
+        uint64_t variance = (scaled_sq > sum_sq) ? (scaled_sq - sum_sq) / ((uint64_t)n * n) : 0;
+
+        out->samples = sat_u16(n);
+        out->odba_mg = sat_u16((act->odba_sum + n / 2) / n);
+        out->vedba_mg = sat_u16((act->vedba_sum + n / 2) / n);
+        out->sd_mg = sat_u16(juxta_activity_isqrt(variance));
+        for (int i = 0; i < 3; i++)
+        {
+            out->posture[i] = posture_axis(act->axis_sum[i], n);
+        }
+    }
+
+    act->samples = 0;
+    act->odba_sum = 0;
+    act->vedba_sum = 0;
+    act->mag_sum = 0;
+    act->mag_sq_sum = 0;
+    memset(act->axis_sum, 0, sizeof(act->axis_sum));
+    act->motion_events = 0;
+}
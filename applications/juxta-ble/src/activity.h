@@ -0,0 +1,90 @@
+/*
+ * JUXTA Activity Metrics Header
+ * Per-minute accelerometer summaries computed sample by sample in fixed
+ * point: ODBA and VeDBA against a running static (gravity) estimate, the
+ * spread of the acceleration magnitude, the mean vector for posture, and
+ * a per-second motion event count. No Zephyr dependencies.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef JUXTA_ACTIVITY_H_
+#define JUXTA_ACTIVITY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define JUXTA_ACTIVITY_STATIC_SHIFT 6 /* Static estimate EMA weight 1/64 (~2.6 s at 25 Hz) */
+#define JUXTA_ACTIVITY_POSTURE_MG 16  /* Posture vector units */
+
+    struct juxta_activity
+    {
+        /* Configuration */
+        uint16_t window_samples; /* Samples per motion event window (1 s) */
+        uint16_t threshold_mg;   /* Dynamic acceleration on any axis that counts as motion */
+
+        /* Running state kept across minutes */
+        int32_t static_q[3]; /* Static estimate, mg << STATIC_SHIFT */
+        bool primed;
+        uint16_t window_pos;
+        bool window_flagged;
+
+        /* Minute sums */
+        uint32_t samples;
+        uint64_t odba_sum;
+        uint64_t vedba_sum;
+        uint64_t mag_sum;
+        uint64_t mag_sq_sum;
+        int64_t axis_sum[3];
+        uint8_t motion_events;
+    };
+
+    struct juxta_activity_minute
+    {
+        uint16_t samples;  /* Samples summarised (0 = no data) */
+        uint16_t odba_mg;  /* Mean overall dynamic body acceleration */
+        uint16_t vedba_mg; /* Mean vectorial dynamic body acceleration */
+        uint16_t sd_mg;    /* Standard deviation of |a| (square root of the variance) */
+        int8_t posture[3]; /* Mean acceleration per axis in 16 mg units */
+        uint8_t motion_events;
+    };
+
+    /**
+     * @brief Initialize the accumulator
+     *
+     * @param act Accumulator
+     * @param window_samples Samples per motion event window
+     * @param threshold_mg Per-axis dynamic acceleration threshold for motion
+     */
+    void juxta_activity_init(struct juxta_activity *act, uint16_t window_samples, uint16_t threshold_mg);
+
+    /**
+     * @brief Add one sample
+     *
+     * @return true if the sample started a new motion event
+     */
+    bool juxta_activity_add(struct juxta_activity *act, int16_t x_mg, int16_t y_mg, int16_t z_mg);
+
+    /**
+     * @brief Summarise the minute and restart the sums
+     *
+     * The static estimate and motion window carry over to the next minute.
+     */
+    void juxta_activity_take(struct juxta_activity *act, struct juxta_activity_minute *out);
+
+    /**
+     * @brief Integer square root
+     */
+    uint32_t juxta_activity_isqrt(uint64_t value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JUXTA_ACTIVITY_H_ */
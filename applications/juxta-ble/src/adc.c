@@ -10,7 +10,6 @@
 #include <zephyr/drivers/adc.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/devicetree.h>
-#include <zephyr/irq.h>
 #include <string.h>
 #include <math.h>
 #include <hal/nrf_rtc.h>
@@ -141,70 +140,76 @@ int juxta_adc_burst_sample(int32_t *samples, uint32_t max_samples,
         return -EINVAL;
     }
 
-    /* Start timing using RTC0 counter (32kHz clock) */
-    uint32_t start_ticks = NRF_RTC0->COUNTER;
-    uint32_t sample_count = 0;
-
-    /* Debug: Log RTC0 configuration for timing verification */
-    LOG_DBG("🔍 RTC0 Debug: PRESCALER=0x%08X, COUNTER=%u, start_ticks=%u",
-            (unsigned)NRF_RTC0->PRESCALER, (unsigned)NRF_RTC0->COUNTER, (unsigned)start_ticks);
+    if (max_samples > JUXTA_ADC_BURST_MAX_SAMPLES)
+    {
+        max_samples = JUXTA_ADC_BURST_MAX_SAMPLES;
+    }
 
-    /* Use optimized batch sampling to avoid per-sample overhead */
-    /* Configure sequence for burst sampling */
-    static int16_t burst_buffer[500]; /* Static buffer for raw ADC values */
+    /* Raw SAADC results land here via EasyDMA for the whole burst */
+    static int16_t burst_buffer[JUXTA_ADC_BURST_MAX_SAMPLES];
+
+    /* One sequence: the driver's k_timer re-triggers SAMPLE every
+     * interval_us (whole system clock ticks) and EasyDMA writes each result
+     * to the next buffer slot, so the CPU only takes the timer and END
+     * interrupts while the burst runs.
+     */
+    struct adc_sequence_options burst_opts = {
+        .interval_us = JUXTA_ADC_BURST_INTERVAL_US,
+        .callback = NULL,
+        .user_data = NULL,
+        .extra_samplings = (uint16_t)(max_samples - 1),
+    };
 
     struct adc_sequence burst_seq = {
+        .options = &burst_opts,
         .channels = BIT(0),
         .buffer = burst_buffer,
-        .buffer_size = sizeof(burst_buffer),
+        .buffer_size = max_samples * sizeof(burst_buffer[0]),
         .resolution = 12,
         .oversampling = 0, /* Disable oversampling for maximum speed */
         .calibrate = false /* Disable per-read calibration for speed */
     };
 
-    /* Disable interrupts during critical sampling for consistent timing */
-    unsigned int key = irq_lock();
+    /* Start timing using RTC0 counter (32kHz clock) */
+    uint32_t start_ticks = NRF_RTC0->COUNTER;
 
-    /* Perform optimized burst sampling with minimal overhead */
-    for (uint32_t i = 0; i < max_samples; i++)
-    {
-        /* Direct ADC read without function call overhead */
-        int ret = adc_read(adc_dev, &burst_seq);
+    LOG_DBG("🔍 RTC0 Debug: PRESCALER=0x%08X, COUNTER=%u, start_ticks=%u",
+            (unsigned)NRF_RTC0->PRESCALER, (unsigned)NRF_RTC0->COUNTER, (unsigned)start_ticks);
 
-        if (ret == 0)
-        {
-            /* Convert raw ADC value to millivolts */
-            int32_t voltage_mv = burst_buffer[0];
-            ret = adc_raw_to_millivolts(adc_ref_internal(adc_dev),
-                                        adc_cfg.gain,
-                                        burst_seq.resolution,
-                                        &voltage_mv);
-
-            samples[sample_count] = (ret == 0) ? voltage_mv : 0;
-            sample_count++;
-        }
-        else
-        {
-            /* Use previous sample value if ADC read fails */
-            if (sample_count > 0)
-            {
-                samples[sample_count] = samples[sample_count - 1];
-            }
-            else
-            {
-                samples[sample_count] = 0; /* Default to 0 if no previous sample */
-            }
-            sample_count++;
-        }
+    int ret = adc_read(adc_dev, &burst_seq);
 
-        /* No artificial delay - let ADC conversion time be the limiting factor */
+    /* End timing */
+    uint32_t end_ticks = NRF_RTC0->COUNTER;
+
+    if (ret != 0)
+    {
+        LOG_ERR("ADC burst sequence failed: %d", ret);
+        *actual_samples = 0;
+        *duration_us = 0;
+        return ret;
     }
 
-    /* Re-enable interrupts */
-    irq_unlock(key);
+    /* Convert raw values to millivolts in a single pass. The scale factor
+     * (reference / gain) is resolved once instead of per sample; the result
+     * matches adc_raw_to_millivolts() for every input.
+     */
+    int32_t full_scale_mv = 1 << burst_seq.resolution;
+    ret = adc_raw_to_millivolts(adc_ref_internal(adc_dev),
+                                adc_cfg.gain,
+                                burst_seq.resolution,
+                                &full_scale_mv);
+    if (ret != 0)
+    {
+        LOG_ERR("ADC conversion failed: %d", ret);
+        *actual_samples = 0;
+        *duration_us = 0;
+        return ret;
+    }
 
-    /* End timing */
-    uint32_t end_ticks = NRF_RTC0->COUNTER;
+    for (uint32_t i = 0; i < max_samples; i++)
+    {
+        samples[i] = ((int32_t)burst_buffer[i] * full_scale_mv) >> burst_seq.resolution;
+    }
 
     /* Handle RTC0 rollover (24-bit counter: 0xFFFFFF + 1 = 0x000000) */
     uint32_t duration_ticks;
@@ -218,16 +223,15 @@ int juxta_adc_burst_sample(int32_t *samples, uint32_t max_samples,
         duration_ticks = (0x1000000 - start_ticks) + end_ticks;
     }
 
-    /* Calculate actual duration with improved precision */
-    *actual_samples = sample_count; /* Always equals max_samples now */
+    *actual_samples = max_samples;
 
     /* Use 64-bit arithmetic to avoid overflow and improve precision */
     /* RTC0 runs at exactly 32768 Hz, so each tick = 1000000/32768 = 30.517578125 μs */
     uint64_t duration_us_64 = ((uint64_t)duration_ticks * 1000000ULL) / 32768ULL;
     *duration_us = (uint32_t)duration_us_64; /* Convert ticks to microseconds */
 
-    LOG_DBG("📊 ADC burst completed: requested=%u, actual=%u, duration=%u us (ticks=%u, start=%u, end=%u)",
-            (unsigned)max_samples, (unsigned)sample_count, (unsigned)*duration_us,
+    LOG_DBG("📊 ADC burst completed: samples=%u, interval=%u us, duration=%u us (ticks=%u, start=%u, end=%u)",
+            (unsigned)max_samples, (unsigned)JUXTA_ADC_BURST_INTERVAL_US, (unsigned)*duration_us,
             (unsigned)duration_ticks, (unsigned)start_ticks, (unsigned)end_ticks);
 
     return 0;
@@ -245,7 +249,7 @@ int juxta_adc_burst_sample(int32_t *samples, uint32_t max_samples,
  */
 int juxta_adc_test_timing(uint32_t expected_samples)
 {
-    if (expected_samples < 200 || expected_samples > 2000)
+    if (expected_samples < 200 || expected_samples > JUXTA_ADC_BURST_MAX_SAMPLES)
     {
         return -EINVAL;
     }
@@ -253,16 +257,17 @@ int juxta_adc_test_timing(uint32_t expected_samples)
     LOG_INF("🧪 Testing ADC timing accuracy with %u samples", (unsigned)expected_samples);
 
     /* Use static buffer to avoid k_malloc dependency */
-    static int32_t test_samples[2000];
+    static int32_t test_samples[JUXTA_ADC_BURST_MAX_SAMPLES];
 
     uint32_t actual_samples, duration_us;
     int ret = juxta_adc_burst_sample(test_samples, expected_samples, &actual_samples, &duration_us);
 
     if (ret == 0)
     {
-        // Calculate expected timing based on maximum speed ADC characteristics
-        // Each sample: ~2-3μs ADC conversion (no artificial delay) = ~3μs per sample (target)
-        uint32_t expected_duration_us = expected_samples * 3U;
+        // The first sample starts immediately, the rest follow the k_timer period,
+        // which the kernel rounds up to whole system clock ticks
+        uint32_t period_us = k_ticks_to_us_near32(k_us_to_ticks_ceil32(JUXTA_ADC_BURST_INTERVAL_US));
+        uint32_t expected_duration_us = (actual_samples - 1U) * period_us;
         int32_t timing_error = (int32_t)duration_us - (int32_t)expected_duration_us;
         int32_t error_percent_x100 = (timing_error * 10000) / (int32_t)expected_duration_us; /* Error % * 100 */
 
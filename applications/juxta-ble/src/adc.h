@@ -17,6 +17,16 @@ extern "C"
 {
 #endif
 
+/* Burst sampling limits */
+#define JUXTA_ADC_BURST_MAX_SAMPLES 2000 /* Raw DMA buffer size (int16 per sample) */
+/*
+ * Sample spacing within a burst. The driver paces extra_samplings with a
+ * k_timer, so the period is whole ticks of the 32768 Hz system clock
+ * (30.5 us each) and must exceed acquisition (10 us) plus conversion (2 us).
+ * 61 us is exactly two ticks (~16.4 kHz).
+ */
+#define JUXTA_ADC_BURST_INTERVAL_US 61
+
     /**
      * @brief Initialize the ADC module for differential measurements
      *
@@ -52,11 +62,18 @@ extern "C"
     /**
      * @brief Perform a burst of ADC samples with precise timing
      *
-     * Performs continuous ADC sampling for approximately 2ms with ~10μs intervals.
-     * Uses RTC0 counter for precise timing measurement.
+     * Runs the whole burst as a single ADC sequence (interval_us +
+     * extra_samplings): the driver's k_timer triggers a sample every
+     * JUXTA_ADC_BURST_INTERVAL_US (rounded up to system clock ticks) and
+     * the SAADC DMAs raw results into a static buffer. Interrupts stay
+     * enabled; raw values are converted to millivolts in one pass after the
+     * sequence completes. Uses RTC0 counter for duration.
+     *
+     * Only used by juxta_adc_test_timing(); threshold capture uses the
+     * PPI-triggered pipeline in main.c.
      *
-     * @param samples Buffer to store ADC samples (must be at least 200 samples)
-     * @param max_samples Maximum number of samples to store
+     * @param samples Buffer to store ADC samples in millivolts
+     * @param max_samples Number of samples to take (100 to JUXTA_ADC_BURST_MAX_SAMPLES)
      * @param actual_samples Pointer to store actual number of samples taken
      * @param duration_us Pointer to store actual duration in microseconds
      * @return 0 on success, negative error code on failure
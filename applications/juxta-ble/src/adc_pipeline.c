@@ -0,0 +1,254 @@
+/*
+ * JUXTA ADC Pipeline Implementation
+ * Portable peri-event capture pipeline shared by firmware and host replay
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "adc_pipeline.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if (ADC_PIPELINE_RING_SIZE % ADC_PIPELINE_BLOCK_SIZE) != 0
+#error "ADC ring must hold a whole number of DMA blocks"
+#endif
+#if ADC_PIPELINE_RING_SIZE < ADC_PIPELINE_WINDOW_MAX
+#error "ADC ring must hold the largest event window"
+#endif
+#if (ADC_PIPELINE_TRIGGER_MASK & ((1 << ADC_PIPELINE_CHANNELS) - 1)) == 0
+#error "ADC trigger mask selects no captured channel"
+#endif
+
+void adc_pipeline_ring_reset(struct adc_pipeline_ring *ring)
+{
+    memset(ring, 0, sizeof(*ring));
+}
+
+/* De-interleave @p frames scan results into each channel ring at @p dst_pos.
+ * Constant stride and no wrap inside the span, so the inner loop is a plain
+ * strided copy the compiler can unroll (a straight copy for one channel).
+ */
+static void ring_deinterleave(struct adc_pipeline_ring *ring, const int16_t *src,
+                              uint32_t frames, uint32_t dst_pos)
+{
+    for (uint32_t ch = 0; ch < ADC_PIPELINE_CHANNELS; ch++)
+    {
+        int16_t *dst = &ring->samples[ch][dst_pos];
+        const int16_t *s = src + ch;
+        for (uint32_t i = 0; i < frames; i++)
+        {
+            dst[i] = s[i * ADC_PIPELINE_CHANNELS];
+        }
+    }
+}
+
+void adc_pipeline_ring_add(struct adc_pipeline_ring *ring, const int16_t *frames, uint32_t count)
+{
+    /* Add interleaved frames to the channel rings, split at the wrap point */
+    uint32_t head = ring->head;
+    uint32_t remaining = count;
+    const int16_t *src = frames;
+
+    while (remaining > 0)
+    {
+        uint32_t span = ADC_PIPELINE_RING_SIZE - head;
+        if (span > remaining)
+        {
+            span = remaining;
+        }
+        ring_deinterleave(ring, src, span, head);
+        src += span * ADC_PIPELINE_CHANNELS;
+        remaining -= span;
+        head = (head + span) % ADC_PIPELINE_RING_SIZE;
+    }
+
+    /* Overflow drops the oldest samples: tail trails head by count */
+    uint32_t new_count = ring->count + count;
+    if (new_count > ADC_PIPELINE_RING_SIZE)
+    {
+        new_count = ADC_PIPELINE_RING_SIZE;
+    }
+    ring->head = head;
+    ring->count = new_count;
+    ring->tail = (head + ADC_PIPELINE_RING_SIZE - new_count) % ADC_PIPELINE_RING_SIZE;
+}
+
+void adc_pipeline_ring_add_block(struct adc_pipeline_ring *ring, const int16_t *frames,
+                                 uint32_t count, uint32_t end_us, bool time_valid)
+{
+    /* Blocks land on block-aligned slots; stamp the slot before the samples
+     * are published so the detector never sees samples without a time */
+    uint32_t block = ring->head / ADC_PIPELINE_BLOCK_SIZE;
+    ring->block_end_us[block] = end_us;
+    ring->block_time_valid[block] = time_valid && (count == ADC_PIPELINE_BLOCK_SIZE);
+
+    adc_pipeline_ring_add(ring, frames, count);
+}
+
+bool adc_pipeline_ring_sample_time(const struct adc_pipeline_ring *ring, uint32_t pos,
+                                   uint32_t period_us, uint32_t *time_us)
+{
+    uint32_t block = (pos % ADC_PIPELINE_RING_SIZE) / ADC_PIPELINE_BLOCK_SIZE;
+    if (!ring->block_time_valid[block] || period_us == 0)
+    {
+        return false;
+    }
+
+    uint32_t samples_after = (ADC_PIPELINE_BLOCK_SIZE - 1) - (pos % ADC_PIPELINE_BLOCK_SIZE);
+    *time_us = ring->block_end_us[block] - (samples_after * period_us);
+    return true;
+}
+
+uint32_t adc_pipeline_find_trigger(const struct adc_pipeline_ring *ring, uint32_t start_offset,
+                                   uint32_t search_count, int32_t threshold_mv,
+                                   uint32_t channel_mask)
+{
+    /* Search for threshold crossing on the selected channels in ring buffer */
+    for (uint32_t i = 0; i < search_count && i < ring->count; i++)
+    {
+        uint32_t pos = (start_offset + i) % ADC_PIPELINE_RING_SIZE;
+
+        for (uint32_t ch = 0; ch < ADC_PIPELINE_CHANNELS; ch++)
+        {
+            if (!(channel_mask & (1U << ch)))
+            {
+                continue;
+            }
+            /* Ring samples are already in mV */
+            int32_t voltage_mv = ring->samples[ch][pos];
+            if (abs(voltage_mv) > threshold_mv)
+            {
+                return pos; /* Return position of trigger */
+            }
+        }
+    }
+    return ADC_PIPELINE_NO_TRIGGER;
+}
+
+uint32_t adc_pipeline_extract_centered(const struct adc_pipeline_ring *ring, uint32_t trigger_pos,
+                                       int16_t *output, uint32_t output_size)
+{
+    /* Extract samples centered around trigger position */
+    if (ring->count < output_size)
+    {
+        return 0; /* Not enough samples in buffer */
+    }
+
+    uint32_t half_samples = output_size / 2;
+    uint32_t start_pos = (trigger_pos + ADC_PIPELINE_RING_SIZE - half_samples) % ADC_PIPELINE_RING_SIZE;
+
+    /* Output is channel-major: output_size samples of channel 0, then channel 1, ... */
+    for (uint32_t ch = 0; ch < ADC_PIPELINE_CHANNELS; ch++)
+    {
+        int16_t *dst = &output[ch * output_size];
+        for (uint32_t i = 0; i < output_size; i++)
+        {
+            uint32_t src_pos = (start_pos + i) % ADC_PIPELINE_RING_SIZE;
+            dst[i] = ring->samples[ch][src_pos];
+        }
+    }
+
+    return output_size;
+}
+
+void adc_pipeline_raw_to_mv(const int16_t *raw, int16_t *mv, uint32_t frames)
+{
+    /* SAADC: 12-bit, gain=1/6, Vref=0.6V → full-scale ≈ 3.6V. Differential
+     * results are signed over ±2048 counts (LSB ≈ 3600/2048 mV), single-ended
+     * results span 4096 counts (LSB ≈ 3600/4096 mV) */
+    for (uint32_t i = 0; i < frames * ADC_PIPELINE_CHANNELS; i++)
+    {
+        uint32_t ch = i % ADC_PIPELINE_CHANNELS;
+        int32_t counts = ADC_PIPELINE_CHANNEL_IS_DIFFERENTIAL(ch) ? 2048 : 4096;
+        int32_t v = (int32_t)raw[i] * 3600 / counts;
+        if (v > ADC_PIPELINE_MV_LIMIT)
+            v = ADC_PIPELINE_MV_LIMIT; /* limit to expected app range */
+        if (v < -ADC_PIPELINE_MV_LIMIT)
+            v = -ADC_PIPELINE_MV_LIMIT;
+        mv[i] = (int16_t)v;
+    }
+}
+
+void adc_pipeline_scale(const int16_t *mv, uint32_t sample_count, uint8_t *scaled,
+                        uint8_t *peak_positive, uint8_t *peak_negative)
+{
+    for (uint32_t ch = 0; ch < ADC_PIPELINE_CHANNELS; ch++)
+    {
+        const int16_t *src = &mv[ch * sample_count];
+        uint8_t *dst = &scaled[ch * sample_count];
+        uint8_t pos_peak = 0;
+        uint8_t neg_peak = 255;
+
+        for (uint32_t i = 0; i < sample_count; i++)
+        {
+            /* Convert mV range (-2000 to +2000) to 0-255 */
+            int32_t value = ((int32_t)src[i] + ADC_PIPELINE_MV_LIMIT) * 255 / (2 * ADC_PIPELINE_MV_LIMIT);
+            if (value < 0)
+                value = 0;
+            if (value > 255)
+                value = 255;
+            dst[i] = (uint8_t)value;
+
+            /* Track peaks */
+            if (dst[i] > pos_peak)
+                pos_peak = dst[i];
+            if (dst[i] < neg_peak)
+                neg_peak = dst[i];
+        }
+
+        peak_positive[ch] = pos_peak;
+        peak_negative[ch] = neg_peak;
+    }
+}
+
+bool adc_pipeline_detect(struct adc_pipeline_detector *det, const struct adc_pipeline_ring *ring,
+                         bool threshold_mode, int32_t threshold_mv, uint32_t debounce_ms,
+                         uint32_t window_samples, uint32_t now_ms, uint32_t *trigger_pos)
+{
+    bool triggered = false;
+
+    /* Require at least one full window worth of samples in the ring */
+    if (ring->count >= window_samples && now_ms >= det->next_allowed_ms)
+    {
+        if (threshold_mode)
+        {
+            /* Threshold mode - search the newest block for a crossing */
+            uint32_t pos = adc_pipeline_find_trigger(ring, det->scan_position,
+                                                     ADC_PIPELINE_BLOCK_SIZE, threshold_mv,
+                                                     ADC_PIPELINE_TRIGGER_MASK);
+            if (pos != ADC_PIPELINE_NO_TRIGGER)
+            {
+                *trigger_pos = pos;
+                triggered = true;
+            }
+        }
+        else
+        {
+            /* Timer mode - always trigger at the current position */
+            *trigger_pos = ring->head;
+            triggered = true;
+        }
+
+        /* Debounce runs from the last trigger, so polls without a crossing
+         * leave the gate open */
+        if (triggered)
+        {
+            det->next_allowed_ms = now_ms + debounce_ms;
+        }
+    }
+
+    /* Next search starts where this poll left the producer */
+    det->scan_position = ring->head;
+    return triggered;
+}
+
+uint32_t adc_pipeline_event_record_size(bool peaks_only, uint32_t sample_count)
+{
+    if (peaks_only)
+    {
+        /* Header + per-channel peak pair + 1 reserved */
+        return ADC_PIPELINE_EVENT_HEADER_SIZE + (2 * ADC_PIPELINE_CHANNELS) + 1;
+    }
+    return ADC_PIPELINE_EVENT_HEADER_SIZE + (sample_count * ADC_PIPELINE_CHANNELS);
+}
@@ -0,0 +1,227 @@
+/*
+ * JUXTA ADC Pipeline Header
+ * Portable peri-event capture pipeline: channel rings, trigger detection,
+ * centered extraction and 8-bit scaling. No Zephyr dependencies so the same
+ * code runs on target and in the host replay tool (tools/adc_replay).
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef JUXTA_ADC_PIPELINE_H_
+#define JUXTA_ADC_PIPELINE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Channel count: Kconfig on target, overridable on host builds */
+#ifndef ADC_PIPELINE_CHANNELS
+#ifdef CONFIG_JUXTA_BLE_ADC_CHANNELS
+#define ADC_PIPELINE_CHANNELS CONFIG_JUXTA_BLE_ADC_CHANNELS
+#else
+#define ADC_PIPELINE_CHANNELS 1
+#endif
+#endif
+
+/*
+ * Channel layout (matches the capture channel map in main.c): channels 0 and
+ * 1 are the AIN1-AIN0 and AIN3-AIN2 electrode pairs, channels 2 and 3 are the
+ * single-ended AIN4 (reference) and AIN5 inputs.
+ */
+#define ADC_PIPELINE_DIFFERENTIAL_MASK 0x3
+#define ADC_PIPELINE_CHANNEL_IS_DIFFERENTIAL(ch) ((ADC_PIPELINE_DIFFERENTIAL_MASK >> (ch)) & 1)
+
+/* Channels searched for threshold crossings: Kconfig on target, the
+ * electrode pairs by default */
+#ifndef ADC_PIPELINE_TRIGGER_MASK
+#ifdef CONFIG_JUXTA_BLE_ADC_TRIGGER_MASK
+#define ADC_PIPELINE_TRIGGER_MASK CONFIG_JUXTA_BLE_ADC_TRIGGER_MASK
+#else
+#define ADC_PIPELINE_TRIGGER_MASK ADC_PIPELINE_DIFFERENTIAL_MASK
+#endif
+#endif
+
+/* Ring and block geometry; the ring is twice the largest window by default */
+#ifndef ADC_PIPELINE_RING_SIZE
+#ifdef CONFIG_JUXTA_BLE_ADC_RING_FRAMES
+#define ADC_PIPELINE_RING_SIZE CONFIG_JUXTA_BLE_ADC_RING_FRAMES
+#else
+#define ADC_PIPELINE_RING_SIZE 1000 /* Frames per channel ring */
+#endif
+#endif
+#define ADC_PIPELINE_BLOCK_SIZE 100 /* Frames per DMA block */
+#define ADC_PIPELINE_RING_BLOCKS (ADC_PIPELINE_RING_SIZE / ADC_PIPELINE_BLOCK_SIZE)
+
+/* Extraction window limits (samples per channel) */
+#define ADC_PIPELINE_WINDOW_MIN 100     /* Minimum: 1 DMA block */
+#define ADC_PIPELINE_WINDOW_DEFAULT 200 /* Recommended default */
+#define ADC_PIPELINE_WINDOW_MAX 500     /* Maximum: fits the shortest ring */
+
+/* Stored event layout (matches JUXTA_FRAMFS_ADC_HEADER_SIZE) */
+#define ADC_PIPELINE_EVENT_HEADER_SIZE 13
+
+/* Scaled sample range: -2000..+2000 mV maps to 0..255 */
+#define ADC_PIPELINE_MV_LIMIT 2000
+
+#define ADC_PIPELINE_NO_TRIGGER UINT32_MAX
+
+    /**
+     * @brief Per-channel sample rings sharing one head/tail/count
+     *
+     * Samples are stored in millivolts. Each block-aligned slot also keeps
+     * the timestamp timer value of its last sample.
+     */
+    struct adc_pipeline_ring
+    {
+        int16_t samples[ADC_PIPELINE_CHANNELS][ADC_PIPELINE_RING_SIZE];
+        volatile uint32_t head;  /* Write position (producer updates) */
+        volatile uint32_t tail;  /* Oldest sample position */
+        volatile uint32_t count; /* Number of frames in the ring */
+        uint32_t block_end_us[ADC_PIPELINE_RING_BLOCKS];
+        bool block_time_valid[ADC_PIPELINE_RING_BLOCKS];
+    };
+
+    /**
+     * @brief Trigger detector state (debounce gate and search start)
+     */
+    struct adc_pipeline_detector
+    {
+        uint32_t next_allowed_ms; /* Absolute time gate for trigger */
+        uint32_t scan_position;   /* Ring position where the next search starts */
+    };
+
+    /**
+     * @brief Clear ring contents, positions and block timestamps
+     *
+     * @param ring Ring to reset
+     */
+    void adc_pipeline_ring_reset(struct adc_pipeline_ring *ring);
+
+    /**
+     * @brief Add interleaved frames to the channel rings
+     *
+     * Frames are [ch0, ch1, ...] per sampling. Overflow drops the oldest frames.
+     *
+     * @param ring Destination ring
+     * @param frames Interleaved samples in millivolts
+     * @param count Number of frames
+     */
+    void adc_pipeline_ring_add(struct adc_pipeline_ring *ring, const int16_t *frames, uint32_t count);
+
+    /**
+     * @brief Add one DMA block and record its end timestamp
+     *
+     * @param ring Destination ring
+     * @param frames Interleaved samples in millivolts
+     * @param count Number of frames (timestamp kept only for full blocks)
+     * @param end_us Timestamp timer value at the last sample of the block
+     * @param time_valid Whether end_us came from an active timestamp source
+     */
+    void adc_pipeline_ring_add_block(struct adc_pipeline_ring *ring, const int16_t *frames,
+                                     uint32_t count, uint32_t end_us, bool time_valid);
+
+    /**
+     * @brief Interpolate the timestamp of a ring sample from its block end time
+     *
+     * @param ring Source ring
+     * @param pos Ring position of the sample
+     * @param period_us Sample period in microseconds
+     * @param time_us Output timestamp timer value
+     * @return true if the sample's block has a valid timestamp
+     */
+    bool adc_pipeline_ring_sample_time(const struct adc_pipeline_ring *ring, uint32_t pos,
+                                       uint32_t period_us, uint32_t *time_us);
+
+    /**
+     * @brief Search for an absolute threshold crossing on the selected channels
+     *
+     * @param ring Source ring
+     * @param start_offset Ring position to start from
+     * @param search_count Maximum frames to examine
+     * @param threshold_mv Threshold in millivolts
+     * @param channel_mask Channels to search (bit n = channel n)
+     * @return Ring position of the first crossing, or ADC_PIPELINE_NO_TRIGGER
+     */
+    uint32_t adc_pipeline_find_trigger(const struct adc_pipeline_ring *ring, uint32_t start_offset,
+                                       uint32_t search_count, int32_t threshold_mv,
+                                       uint32_t channel_mask);
+
+    /**
+     * @brief Copy a window centered on a ring position, channel-major
+     *
+     * @param ring Source ring
+     * @param trigger_pos Ring position at the window center
+     * @param output Destination (ADC_PIPELINE_CHANNELS * output_size samples)
+     * @param output_size Samples per channel
+     * @return output_size, or 0 if the ring holds fewer frames
+     */
+    uint32_t adc_pipeline_extract_centered(const struct adc_pipeline_ring *ring, uint32_t trigger_pos,
+                                           int16_t *output, uint32_t output_size);
+
+    /**
+     * @brief Convert interleaved raw SAADC frames to clamped millivolts
+     *
+     * 12-bit, gain 1/6, 0.6 V reference: full scale 3600 mV over ±2048 counts
+     * on differential channels and over 4096 counts on single-ended ones
+     * (ADC_PIPELINE_DIFFERENTIAL_MASK), clamped to ±ADC_PIPELINE_MV_LIMIT.
+     *
+     * @param raw Raw SAADC results, [ch0, ch1, ...] per frame
+     * @param mv Output millivolts (may alias raw)
+     * @param frames Number of frames
+     */
+    void adc_pipeline_raw_to_mv(const int16_t *raw, int16_t *mv, uint32_t frames);
+
+    /**
+     * @brief Scale channel-major millivolt samples to 8 bits and find peaks
+     *
+     * @param mv Channel-major input (ADC_PIPELINE_CHANNELS * sample_count)
+     * @param sample_count Samples per channel
+     * @param scaled Channel-major 8-bit output
+     * @param peak_positive Per-channel maximum scaled value
+     * @param peak_negative Per-channel minimum scaled value
+     */
+    void adc_pipeline_scale(const int16_t *mv, uint32_t sample_count, uint8_t *scaled,
+                            uint8_t *peak_positive, uint8_t *peak_negative);
+
+    /**
+     * @brief Run one detector poll against the ring
+     *
+     * Mirrors the capture thread: once the ring holds a full window and the
+     * debounce gate has expired, either the last block is searched for a
+     * crossing on the ADC_PIPELINE_TRIGGER_MASK channels (threshold mode) or
+     * the current head is used (timer mode). The gate is re-armed only when
+     * an event triggers; samples that arrive while it is closed are skipped.
+     *
+     * @param det Detector state
+     * @param ring Source ring
+     * @param threshold_mode true for threshold events, false for timer bursts
+     * @param threshold_mv Threshold in millivolts
+     * @param debounce_ms Minimum time between triggers
+     * @param window_samples Extraction window per channel
+     * @param now_ms Current time in milliseconds
+     * @param trigger_pos Output ring position of the trigger
+     * @return true if an event should be captured
+     */
+    bool adc_pipeline_detect(struct adc_pipeline_detector *det, const struct adc_pipeline_ring *ring,
+                             bool threshold_mode, int32_t threshold_mv, uint32_t debounce_ms,
+                             uint32_t window_samples, uint32_t now_ms, uint32_t *trigger_pos);
+
+    /**
+     * @brief Size of the stored event record for a capture
+     *
+     * @param peaks_only true for single events (peaks), false for waveforms
+     * @param sample_count Samples per channel (waveforms only)
+     * @return Record size in bytes including header
+     */
+    uint32_t adc_pipeline_event_record_size(bool peaks_only, uint32_t sample_count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JUXTA_ADC_PIPELINE_H_ */
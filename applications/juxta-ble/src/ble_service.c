@@ -15,7 +15,6 @@
 #include <zephyr/bluetooth/att.h>
 #include <zephyr/drivers/watchdog.h>
 #include <zephyr/sys/reboot.h>
-#include <hal/nrf_rtc.h>
 #include <string.h>
 #include <stdio.h>
 #include <errno.h>
@@ -23,8 +22,13 @@
 #include "ble_service.h"
 #include "juxta_framfs/framfs.h"
 #include "juxta_vitals_nrf52/vitals.h"
+#include "energy.h"
+#include "scratch.h"
+#include "juxta_prof/prof.h"
 
-LOG_MODULE_REGISTER(juxta_ble_service, LOG_LEVEL_DBG);
+LOG_MODULE_REGISTER(juxta_ble_service, CONFIG_JUXTA_BLE_SERVICE_LOG_LEVEL);
+
+JUXTA_PROF_DEFINE(xfer_chunk);
 
 /* Forward declarations */
 static int generate_file_listing(char *buffer, size_t buffer_size);
@@ -51,7 +55,6 @@ typedef enum
 static char node_response[JUXTA_NODE_RESPONSE_MAX_SIZE] __unused;
 static char gateway_command[JUXTA_GATEWAY_COMMAND_MAX_SIZE] __unused;
 static char filename_request[JUXTA_FILENAME_MAX_SIZE] __unused;
-static uint8_t file_transfer_chunk[JUXTA_FILE_TRANSFER_CHUNK_SIZE] __unused;
 
 /* CCC descriptors for indications - will be used in Phase IV */
 static struct bt_gatt_ccc_cfg filename_ccc_cfg[BT_GATT_CCC_MAX] __unused;
@@ -103,18 +106,19 @@ static bool should_allow_fram_write(void)
         return true;
     }
 
-    uint16_t battery_mv = juxta_vitals_get_battery_mv(vitals_ctx);
+    struct juxta_vitals_battery battery;
+    juxta_vitals_get_battery(vitals_ctx, &battery);
 
     // Validate battery reading (should be 2000-4200 mV for Li-ion)
-    if (battery_mv < 1000 || battery_mv > 5000)
+    if (!battery.valid || battery.mv < 1000 || battery.mv > 5000)
     {
-        LOG_ERR("🚨 Invalid battery reading: %d mV - allowing FRAM write", battery_mv);
+        LOG_ERR("🚨 Invalid battery reading: %d mV - allowing FRAM write", battery.mv);
         return true; // Allow operations if battery reading is invalid
     }
 
-    if (juxta_vitals_is_low_battery(vitals_ctx))
+    if (battery.low)
     {
-        LOG_WRN("⚠️ Battery critically low (%d mV) - preventing FRAM write", battery_mv);
+        LOG_WRN("⚠️ Battery critically low (%d mV) - preventing FRAM write", battery.mv);
         return false;
     }
     return true;
@@ -236,23 +240,14 @@ static int handle_timestamp_synchronization(uint32_t timestamp)
     /* Get current timestamp for comparison */
     uint32_t current_timestamp = juxta_vitals_get_timestamp(vitals_ctx);
 
-    /* Capture microsecond reference before setting timestamp */
-    uint32_t microsecond_reference = NRF_RTC0->COUNTER;
-
-    /* Set the new timestamp */
-    int ret = juxta_vitals_set_timestamp(vitals_ctx, timestamp);
+    /* Set the new timestamp; the error accumulated since the last sync feeds the drift estimate */
+    int ret = juxta_vitals_sync_timestamp(vitals_ctx, timestamp);
     if (ret < 0)
     {
         LOG_ERR("⏰ Failed to set timestamp: %d", ret);
         return ret;
     }
 
-    /* Enable microsecond tracking with captured reference */
-    vitals_ctx->microsecond_reference = microsecond_reference;
-    vitals_ctx->microsecond_tracking_enabled = true;
-
-    LOG_INF("⏰ Microsecond tracking enabled (RTC0 reference: %u)", microsecond_reference);
-
     /* Log the timestamp change */
     if (current_timestamp > 0)
     {
@@ -277,27 +272,14 @@ static int handle_timestamp_synchronization(uint32_t timestamp)
 }
 
 /**
- * @brief Handle memory clearing (file system format)
+ * @brief Format the file system and reset MAC table and user settings
+ *
+ * Caller holds the FRAMFS lock.
  *
  * @return 0 on success, negative error code on failure
  */
-static int handle_memory_clearing(void)
+static int clear_framfs_locked(void)
 {
-    if (!framfs_ctx || !framfs_ctx->initialized)
-    {
-        LOG_ERR("🧹 Framfs not available for memory clearing");
-        return -ENODEV;
-    }
-
-    LOG_INF("🧹 Starting memory clearing operation...");
-
-    /* Check battery before FRAM operations */
-    if (!should_allow_fram_write())
-    {
-        LOG_WRN("⚠️ Skipping memory clearing due to low battery");
-        return -EAGAIN;
-    }
-
     /* Format the file system */
     int ret = juxta_framfs_format(framfs_ctx);
     if (ret < 0)
@@ -325,10 +307,43 @@ static int handle_memory_clearing(void)
     }
     // feed_watchdog(); /* Feed watchdog after settings clear operation - COMMENTED OUT */
 
-    LOG_INF("✅ Memory clearing completed successfully");
     return 0;
 }
 
+/**
+ * @brief Handle memory clearing (file system format)
+ *
+ * @return 0 on success, negative error code on failure
+ */
+static int handle_memory_clearing(void)
+{
+    if (!framfs_ctx || !framfs_ctx->initialized)
+    {
+        LOG_ERR("🧹 Framfs not available for memory clearing");
+        return -ENODEV;
+    }
+
+    LOG_INF("🧹 Starting memory clearing operation...");
+
+    /* Check battery before FRAM operations */
+    if (!should_allow_fram_write())
+    {
+        LOG_WRN("⚠️ Skipping memory clearing due to low battery");
+        return -EAGAIN;
+    }
+
+    /* Writers may still be mid-append when the gateway connects */
+    juxta_ble_framfs_lock();
+    int ret = clear_framfs_locked();
+    juxta_ble_framfs_unlock();
+
+    if (ret == 0)
+    {
+        LOG_INF("✅ Memory clearing completed successfully");
+    }
+    return ret;
+}
+
 /**
  * @brief Generate Node characteristic JSON response
  */
@@ -368,10 +383,7 @@ static int generate_node_response(char *buffer, size_t buffer_size)
     /* Get battery level from vitals library */
     if (vitals_ctx && vitals_ctx->initialized)
     {
-        /* Force a vitals update to get fresh battery reading */
-        (void)juxta_vitals_update(vitals_ctx);
-
-        /* Get validated battery level (0-100) */
+        /* Get validated battery level (0-100) from the background-sampled snapshot */
         int ret = juxta_vitals_get_validated_battery_level(vitals_ctx, &battery_level);
         if (ret == 0)
         {
@@ -411,9 +423,35 @@ static int generate_node_response(char *buffer, size_t buffer_size)
 
     /* Generate simplified JSON response */
     int written = snprintf(buffer, buffer_size,
-                           "{\"upload_path\":\"%s\",\"firmware_version\":\"%s\",\"battery_level\":%d,\"memory_level\":%d,\"device_id\":\"%s\",\"alert\":\"%s\"}",
+                           "{\"upload_path\":\"%s\",\"firmware_version\":\"%s\",\"battery_level\":%d,\"memory_level\":%d,\"device_id\":\"%s\",\"alert\":\"%s\"",
                            upload_path, JUXTA_FIRMWARE_VERSION, battery_level, memory_level, device_id, alert);
 
+#if IS_ENABLED(CONFIG_JUXTA_BLE_ENERGY)
+    /* Modelled average current, projected runtime and today's charge per source (uAh) */
+    struct juxta_energy_totals today;
+    juxta_energy_get_totals(JUXTA_ENERGY_TODAY, &today);
+    if (written > 0 && written < buffer_size)
+    {
+        written += snprintf(buffer + written, buffer_size - written,
+                            ",\"avg_ua\":%u,\"runtime_h\":%u,\"energy_uah\":[",
+                            juxta_energy_avg_ua(), juxta_energy_runtime_h(battery_level));
+    }
+    for (int i = 0; i < JUXTA_ENERGY_SOURCE_COUNT && written > 0 && written < buffer_size; i++)
+    {
+        written += snprintf(buffer + written, buffer_size - written, "%s%u", i ? "," : "",
+                            (uint32_t)(today.charge_nc[i] / 3600000ULL));
+    }
+    if (written > 0 && written < buffer_size)
+    {
+        written += snprintf(buffer + written, buffer_size - written, "]");
+    }
+#endif
+
+    if (written > 0 && written < buffer_size)
+    {
+        written += snprintf(buffer + written, buffer_size - written, "}");
+    }
+
     if (written >= buffer_size)
     {
         LOG_ERR("📊 Node response too large (%d >= %zu)", written, buffer_size);
@@ -453,6 +491,48 @@ static ssize_t read_node_char(struct bt_conn *conn, const struct bt_gatt_attr *a
     return copy_len;
 }
 
+#ifdef CONFIG_JUXTA_PROF
+/**
+ * @brief Profiler characteristic read callback
+ * Returns the probe statistics as JSON; the snapshot is taken at offset 0 so
+ * a long read sees one consistent dump
+ */
+static ssize_t read_profiler_char(struct bt_conn *conn, const struct bt_gatt_attr *attr,
+                                  void *buf, uint16_t len, uint16_t offset)
+{
+    static char prof_response[JUXTA_PROF_RESPONSE_MAX_SIZE];
+    static int prof_response_len;
+
+    if (offset == 0)
+    {
+        prof_response_len = juxta_prof_to_json(prof_response, sizeof(prof_response));
+        if (prof_response_len < 0)
+        {
+            LOG_ERR("⏱️ Failed to generate profiler response");
+            return BT_GATT_ERR(BT_ATT_ERR_UNLIKELY);
+        }
+    }
+
+    if (offset > prof_response_len)
+    {
+        return BT_GATT_ERR(BT_ATT_ERR_INVALID_OFFSET);
+    }
+
+    size_t copy_len = MIN(len, prof_response_len - offset);
+    memcpy(buf, prof_response + offset, copy_len);
+    return copy_len;
+}
+
+#define JUXTA_PROFILER_CHAR_ATTRS                           \
+    BT_GATT_CHARACTERISTIC(BT_UUID_JUXTA_PROFILER_CHAR,     \
+                           BT_GATT_CHRC_READ,               \
+                           BT_GATT_PERM_READ,               \
+                           read_profiler_char, NULL, NULL), \
+    BT_GATT_CUD("Profiler", BT_GATT_PERM_READ),
+#else
+#define JUXTA_PROFILER_CHAR_ATTRS
+#endif /* CONFIG_JUXTA_PROF */
+
 /**
  * @brief Parse JSON command from gateway characteristic
  * Expected format: {"timestamp":1234567890,"sendFilenames":true,"clearMemory":true,"inactivityDoubler":false,"subjectId":"vole001","uploadPath":"/TEST"}
@@ -800,6 +880,80 @@ static int parse_gateway_command(const char *json_cmd, struct juxta_framfs_user_
         }
     }
 
+    /* Look for adaptiveDuty (session-based) */
+    p = strstr(json_cmd, "\"adaptiveDuty\":");
+    if (p)
+    {
+        if (strstr(p, "\"adaptiveDuty\":true") || strstr(p, "\"adaptiveDuty\": true"))
+        {
+            LOG_INF("🎛️ Adaptive duty command: enabled");
+            juxta_set_session_adaptive_duty_enabled(true);
+        }
+        else if (strstr(p, "\"adaptiveDuty\":false") || strstr(p, "\"adaptiveDuty\": false"))
+        {
+            LOG_INF("🎛️ Adaptive duty command: disabled");
+            juxta_set_session_adaptive_duty_enabled(false);
+        }
+        else
+        {
+            LOG_WRN("🎛️ Invalid adaptiveDuty format in command");
+        }
+    }
+
+    /* Look for adaptive duty bounds (session-based) */
+    uint8_t adv_interval_max;
+    uint8_t scan_interval_max;
+    uint16_t radio_budget;
+    bool duty_bounds_changed = false;
+    juxta_get_session_duty_bounds(&adv_interval_max, &scan_interval_max, &radio_budget);
+
+    p = strstr(json_cmd, "\"advIntervalMax\":");
+    if (p)
+    {
+        if (sscanf(p, "\"advIntervalMax\":%hhu", &adv_interval_max) == 1)
+        {
+            LOG_INF("🎛️ Advertising interval max command: %d", adv_interval_max);
+            duty_bounds_changed = true;
+        }
+        else
+        {
+            LOG_WRN("🎛️ Invalid advIntervalMax format in command");
+        }
+    }
+
+    p = strstr(json_cmd, "\"scanIntervalMax\":");
+    if (p)
+    {
+        if (sscanf(p, "\"scanIntervalMax\":%hhu", &scan_interval_max) == 1)
+        {
+            LOG_INF("🎛️ Scanning interval max command: %d", scan_interval_max);
+            duty_bounds_changed = true;
+        }
+        else
+        {
+            LOG_WRN("🎛️ Invalid scanIntervalMax format in command");
+        }
+    }
+
+    p = strstr(json_cmd, "\"radioBudget\":");
+    if (p)
+    {
+        if (sscanf(p, "\"radioBudget\":%hu", &radio_budget) == 1)
+        {
+            LOG_INF("🎛️ Radio budget command: %u s/h", radio_budget);
+            duty_bounds_changed = true;
+        }
+        else
+        {
+            LOG_WRN("🎛️ Invalid radioBudget format in command");
+        }
+    }
+
+    if (duty_bounds_changed)
+    {
+        juxta_set_session_duty_bounds(adv_interval_max, scan_interval_max, radio_budget);
+    }
+
     if (settings_changed)
     {
         LOG_INF("🎛️ Settings updated - saving to framfs");
@@ -811,7 +965,11 @@ static int parse_gateway_command(const char *json_cmd, struct juxta_framfs_user_
                 return 0;
             }
 
-            if (juxta_framfs_set_user_settings(framfs_ctx, settings) == 0)
+            juxta_ble_framfs_lock();
+            int save_ret = juxta_framfs_set_user_settings(framfs_ctx, settings);
+            juxta_ble_framfs_unlock();
+
+            if (save_ret == 0)
             {
                 LOG_INF("✅ Settings saved successfully");
 
@@ -1058,7 +1216,7 @@ static int start_file_transfer(const char *filename)
 /**
  * @brief Get next chunk of file data for transfer with MTU optimization
  */
-static int get_file_transfer_chunk(uint8_t *buffer, size_t buffer_size, size_t *bytes_read)
+static int file_transfer_chunk_fill(uint8_t *buffer, size_t buffer_size, size_t *bytes_read)
 {
     if (!file_transfer_active || !framfs_ctx || !framfs_ctx->initialized)
     {
@@ -1077,7 +1235,7 @@ static int get_file_transfer_chunk(uint8_t *buffer, size_t buffer_size, size_t *
         }
 
         /* Use conservative 240-byte chunks for MAC table */
-        size_t chunk_size = MIN(MIN(buffer_size, 240), remaining);
+        size_t chunk_size = MIN(MIN(buffer_size, JUXTA_FILE_TRANSFER_HEX_CHUNK_SIZE), remaining);
 
         /* Read MAC table chunk */
         int ret = juxta_framfs_read_mac_table_data(framfs_ctx, current_transfer_offset,
@@ -1094,9 +1252,9 @@ static int get_file_transfer_chunk(uint8_t *buffer, size_t buffer_size, size_t *
         /* Feed watchdog during MAC table transfer operations - COMMENTED OUT */
         // feed_watchdog();
 
-        double progress = (double)current_transfer_offset / current_transfer_file_size * 100.0;
-        LOG_DBG("📁 MAC table chunk: offset=%u/%d, bytes=%zu, progress=%.1f%%",
-                current_transfer_offset, current_transfer_file_size, *bytes_read, progress);
+        LOG_DBG("📁 MAC table chunk: offset=%u/%d, bytes=%zu, progress=%u%%",
+                current_transfer_offset, current_transfer_file_size, *bytes_read,
+                (unsigned)((uint64_t)current_transfer_offset * 100U / MAX(current_transfer_file_size, 1)));
         return 0;
     }
 
@@ -1109,11 +1267,10 @@ static int get_file_transfer_chunk(uint8_t *buffer, size_t buffer_size, size_t *
     }
 
     /* Target 240-byte hex strings, so read 120 binary bytes */
-    size_t target_binary_chunk = 120; /* Will become 240 hex chars */
-    uint8_t binary_buffer[512];       /* Temporary buffer for binary data */
+    size_t target_binary_chunk = JUXTA_FILE_TRANSFER_BINARY_CHUNK_SIZE;
 
-    /* Limit binary chunk size to what's remaining and buffer capacity */
-    size_t binary_chunk_size = MIN(MIN(target_binary_chunk, remaining_binary_bytes), sizeof(binary_buffer));
+    /* Limit binary chunk size to what's remaining */
+    size_t binary_chunk_size = MIN(target_binary_chunk, remaining_binary_bytes);
 
     LOG_DBG("📁 Chunk calculation: remaining_binary=%zu, target_binary=%zu, final_binary=%zu, will_be_hex=%zu",
             remaining_binary_bytes, target_binary_chunk, binary_chunk_size, binary_chunk_size * 2);
@@ -1125,12 +1282,15 @@ static int get_file_transfer_chunk(uint8_t *buffer, size_t buffer_size, size_t *
         return -EINVAL;
     }
 
-    LOG_INF("📁 Reading file chunk: %s, offset=%u, binary_size=%zu (will be %zu hex chars)",
+    LOG_DBG("📁 Reading file chunk: %s, offset=%u, binary_size=%zu (will be %zu hex chars)",
             current_transfer_filename, current_transfer_offset, binary_chunk_size, binary_chunk_size * 2);
 
+    /* Read into the upper half of the output and expand to hex in place:
+     * byte i is read before hex chars 2i and 2i+1 can overwrite it */
+    uint8_t *binary_buffer = buffer + binary_chunk_size;
     int ret = juxta_framfs_read(framfs_ctx, current_transfer_filename,
                                 current_transfer_offset, binary_buffer, binary_chunk_size);
-    LOG_INF("📁 File read result: ret=%d", ret);
+    LOG_DBG("📁 File read result: ret=%d", ret);
 
     if (ret < 0)
     {
@@ -1146,9 +1306,12 @@ static int get_file_transfer_chunk(uint8_t *buffer, size_t buffer_size, size_t *
     }
 
     /* Convert binary data to hex string */
+    static const char hex_digits[] = "0123456789ABCDEF";
     for (int i = 0; i < ret; i++)
     {
-        snprintf((char *)buffer + (i * 2), 3, "%02X", binary_buffer[i]);
+        uint8_t byte = binary_buffer[i];
+        buffer[i * 2] = hex_digits[byte >> 4];
+        buffer[i * 2 + 1] = hex_digits[byte & 0x0F];
     }
 
     current_transfer_offset += ret;
@@ -1157,18 +1320,26 @@ static int get_file_transfer_chunk(uint8_t *buffer, size_t buffer_size, size_t *
     if (current_transfer_offset == ret && ret > 0)
     {
         /* Log first few bytes of first chunk for debugging */
-        LOG_INF("📁 First chunk hex data (first 32 chars): %.32s", (char *)buffer);
+        LOG_DBG("📁 First chunk hex data (first 32 chars): %.32s", (char *)buffer);
     }
 
     /* Feed watchdog during file transfer operations - COMMENTED OUT */
     // feed_watchdog();
 
-    double progress = (double)current_transfer_offset / current_transfer_file_size * 100.0;
-    LOG_DBG("📁 File transfer chunk: offset=%u/%d, hex_bytes=%zu, progress=%.1f%%",
-            current_transfer_offset, current_transfer_file_size, *bytes_read, progress);
+    LOG_DBG("📁 File transfer chunk: offset=%u/%d, hex_bytes=%zu, progress=%u%%",
+            current_transfer_offset, current_transfer_file_size, *bytes_read,
+            (unsigned)((uint64_t)current_transfer_offset * 100U / MAX(current_transfer_file_size, 1)));
     return 0;
 }
 
+static int get_file_transfer_chunk(uint8_t *buffer, size_t buffer_size, size_t *bytes_read)
+{
+    JUXTA_PROF_START(start);
+    int ret = file_transfer_chunk_fill(buffer, buffer_size, bytes_read);
+    JUXTA_PROF_STOP(xfer_chunk, start);
+    return ret;
+}
+
 /**
  * @brief End current file transfer
  */
@@ -1276,13 +1447,16 @@ static void continue_file_transfer(void)
         return;
     }
 
-    /* Get next chunk */
+    /* Get next chunk; the indication copies it, so the buffer is released right after */
+    struct juxta_scratch_scope scratch;
+    (void)juxta_scratch_begin(&scratch, K_FOREVER);
+    uint8_t *chunk = juxta_scratch_alloc(&scratch, JUXTA_FILE_TRANSFER_HEX_CHUNK_SIZE);
     size_t bytes_read = 0;
-    int ret = get_file_transfer_chunk(file_transfer_chunk, sizeof(file_transfer_chunk), &bytes_read);
+    int ret = chunk ? get_file_transfer_chunk(chunk, JUXTA_FILE_TRANSFER_HEX_CHUNK_SIZE, &bytes_read) : -ENOMEM;
     if (ret == 0 && bytes_read > 0)
     {
         /* Send next chunk */
-        send_indication(current_conn, file_transfer_char_attr, file_transfer_chunk, bytes_read);
+        send_indication(current_conn, file_transfer_char_attr, chunk, bytes_read);
     }
     else
     {
@@ -1292,6 +1466,7 @@ static void continue_file_transfer(void)
         file_transfer_state = FILE_TRANSFER_STATE_COMPLETE;
         end_file_transfer();
     }
+    juxta_scratch_end(&scratch);
 }
 
 /**
@@ -1416,14 +1591,17 @@ static ssize_t write_filename_char(struct bt_conn *conn, const struct bt_gatt_at
                 LOG_INF("📁 Starting file transfer for: %s (size: %d bytes)",
                         filename_request, current_transfer_file_size);
 
+                struct juxta_scratch_scope scratch;
+                (void)juxta_scratch_begin(&scratch, K_FOREVER);
+                uint8_t *chunk = juxta_scratch_alloc(&scratch, JUXTA_FILE_TRANSFER_HEX_CHUNK_SIZE);
                 size_t bytes_read = 0;
-                ret = get_file_transfer_chunk(file_transfer_chunk, sizeof(file_transfer_chunk), &bytes_read);
+                ret = chunk ? get_file_transfer_chunk(chunk, JUXTA_FILE_TRANSFER_HEX_CHUNK_SIZE, &bytes_read) : -ENOMEM;
                 LOG_INF("📁 First chunk result: ret=%d, bytes_read=%zu", ret, bytes_read);
 
                 if (ret == 0 && bytes_read > 0)
                 {
                     LOG_INF("📁 Sending first chunk: %zu bytes", bytes_read);
-                    send_indication(conn, file_transfer_char_attr, file_transfer_chunk, bytes_read);
+                    send_indication(conn, file_transfer_char_attr, chunk, bytes_read);
                 }
                 else
                 {
@@ -1434,6 +1612,7 @@ static ssize_t write_filename_char(struct bt_conn *conn, const struct bt_gatt_at
                     file_transfer_state = FILE_TRANSFER_STATE_COMPLETE;
                     end_file_transfer();
                 }
+                juxta_scratch_end(&scratch);
             }
         }
         else
@@ -1582,6 +1761,10 @@ BT_GATT_SERVICE_DEFINE(juxta_hublink_svc,
                        /* Gateway Characteristic User Description */
                        BT_GATT_CUD("Gateway Commands", BT_GATT_PERM_READ),
 
+                       /* Profiler Characteristic (READ, CONFIG_JUXTA_PROF only) */
+                       JUXTA_PROFILER_CHAR_ATTRS
+
+
                        /* Filename Characteristic (READ/WRITE/INDICATE) */
                        BT_GATT_CHARACTERISTIC(BT_UUID_JUXTA_FILENAME_CHAR,
                                               BT_GATT_CHRC_READ | BT_GATT_CHRC_WRITE | BT_GATT_CHRC_INDICATE,
@@ -1618,6 +1801,9 @@ int juxta_ble_service_init(void)
     LOG_INF("🎛️ Gateway: 57617368-5504-0001-8000-00805f9b34fb");
     LOG_INF("📁 Filename: 57617368-5502-0001-8000-00805f9b34fb");
     LOG_INF("📤 File Transfer: 57617368-5503-0001-8000-00805f9b34fb");
+#ifdef CONFIG_JUXTA_PROF
+    LOG_INF("⏱️ Profiler: 57617368-5506-0001-8000-00805f9b34fb");
+#endif
     LOG_INF("📏 MTU: %d bytes, Chunk: %d bytes, Node: %d bytes, Gateway: %d bytes",
             JUXTA_FILE_TRANSFER_CHUNK_SIZE + 3, JUXTA_FILE_TRANSFER_CHUNK_SIZE,
             JUXTA_NODE_RESPONSE_MAX_SIZE, JUXTA_GATEWAY_COMMAND_MAX_SIZE);
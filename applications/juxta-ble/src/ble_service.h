@@ -46,20 +46,28 @@ extern "C"
 #define JUXTA_FILE_TRANSFER_CHAR_UUID 0xFB, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, \
                                       0x01, 0x00, 0x03, 0x55, 0x68, 0x73, 0x61, 0x57
 
+/* Profiler Characteristic UUID: 57617368-5506-0001-8000-00805f9b34fb (READ, CONFIG_JUXTA_PROF) */
+#define JUXTA_PROFILER_CHAR_UUID 0xFB, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, \
+                                 0x01, 0x00, 0x06, 0x55, 0x68, 0x73, 0x61, 0x57
+
 #define BT_UUID_JUXTA_HUBLINK_SERVICE BT_UUID_DECLARE_128(JUXTA_HUBLINK_SERVICE_UUID)
 #define BT_UUID_JUXTA_NODE_CHAR BT_UUID_DECLARE_128(JUXTA_NODE_CHAR_UUID)
 #define BT_UUID_JUXTA_GATEWAY_CHAR BT_UUID_DECLARE_128(JUXTA_GATEWAY_CHAR_UUID)
 #define BT_UUID_JUXTA_FILENAME_CHAR BT_UUID_DECLARE_128(JUXTA_FILENAME_CHAR_UUID)
 #define BT_UUID_JUXTA_FILE_TRANSFER_CHAR BT_UUID_DECLARE_128(JUXTA_FILE_TRANSFER_CHAR_UUID)
+#define BT_UUID_JUXTA_PROFILER_CHAR BT_UUID_DECLARE_128(JUXTA_PROFILER_CHAR_UUID)
 
 /* Firmware version */
 #define JUXTA_FIRMWARE_VERSION "1.0.1"
 
 /* Maximum JSON response sizes */
-#define JUXTA_NODE_RESPONSE_MAX_SIZE 256
+#define JUXTA_NODE_RESPONSE_MAX_SIZE 320
 #define JUXTA_GATEWAY_COMMAND_MAX_SIZE 256
 #define JUXTA_FILENAME_MAX_SIZE 64
 #define JUXTA_FILE_TRANSFER_CHUNK_SIZE 1024
+#define JUXTA_FILE_TRANSFER_BINARY_CHUNK_SIZE 120 /* File bytes per transfer chunk */
+#define JUXTA_FILE_TRANSFER_HEX_CHUNK_SIZE (2 * JUXTA_FILE_TRANSFER_BINARY_CHUNK_SIZE)
+#define JUXTA_PROF_RESPONSE_MAX_SIZE 1024
 
     /**
      * @brief Initialize the JUXTA Hublink BLE service
@@ -114,6 +122,16 @@ extern "C"
      */
     extern void juxta_ble_timing_update_trigger(void);
 
+    /**
+     * @brief Serialize BLE-side FRAMFS changes with the application's writers
+     *
+     * Implemented in main.c on the lock that guards the minute writer, ADC
+     * thread and work queue appends. Hold it around format, clear and
+     * settings writes issued from the BT RX thread.
+     */
+    extern void juxta_ble_framfs_lock(void);
+    extern void juxta_ble_framfs_unlock(void);
+
     /**
      * @brief Get current ADC sampling rate from session configuration
      * @return Current sampling rate in Hz
@@ -170,6 +188,36 @@ extern "C"
      */
     void juxta_set_session_inactivity_doubler_enabled(bool enabled);
 
+    /**
+     * @brief Get current adaptive duty cycling setting
+     * @return true if intervals are chosen by the adaptive controller
+     */
+    bool juxta_get_session_adaptive_duty_enabled(void);
+
+    /**
+     * @brief Set current adaptive duty cycling setting
+     * @param enabled true to let the adaptive controller choose intervals
+     */
+    void juxta_set_session_adaptive_duty_enabled(bool enabled);
+
+    /**
+     * @brief Get current adaptive duty cycling bounds
+     * @param adv_interval_max Pointer to store slowest adv interval (can be NULL)
+     * @param scan_interval_max Pointer to store slowest scan interval (can be NULL)
+     * @param radio_budget_s Pointer to store radio on-time budget per hour (can be NULL)
+     */
+    void juxta_get_session_duty_bounds(uint8_t *adv_interval_max, uint8_t *scan_interval_max,
+                                       uint16_t *radio_budget_s);
+
+    /**
+     * @brief Set current adaptive duty cycling bounds
+     * @param adv_interval_max Slowest adv interval in seconds (0 = 2x advInterval)
+     * @param scan_interval_max Slowest scan interval in seconds (0 = 2x scanInterval)
+     * @param radio_budget_s Radio on-time budget in seconds per hour (0 = unlimited)
+     */
+    void juxta_set_session_duty_bounds(uint8_t adv_interval_max, uint8_t scan_interval_max,
+                                       uint16_t radio_budget_s);
+
     /**
      * @brief Connection established callback
      *
@@ -0,0 +1,200 @@
+/*
+ * JUXTA Adaptive Duty Cycle Controller Implementation
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "duty_cycle.h"
+#include <string.h>
+
+static uint16_t interval_at(uint16_t min_s, uint16_t max_s, uint8_t level)
+{
+    if (min_s == 0)
+    {
+        return 0; /* Disabled stays disabled */
+    }
+
+    uint32_t interval = (uint32_t)min_s << level;
+    uint16_t cap = (max_s > min_s) ? max_s : min_s;
+    return (interval > cap) ? cap : (uint16_t)interval;
+}
+
+static uint32_t on_time_at(const struct juxta_duty_cfg *cfg, uint8_t level)
+{
+    uint32_t on_ms = 0;
+    uint16_t adv_s = interval_at(cfg->adv_min_s, cfg->adv_max_s, level);
+    uint16_t scan_s = interval_at(cfg->scan_min_s, cfg->scan_max_s, level);
+
+    if (adv_s)
+    {
+        on_ms += (3600U / adv_s) * cfg->adv_on_ms;
+    }
+    if (scan_s)
+    {
+        on_ms += (3600U / scan_s) * cfg->scan_on_ms;
+    }
+    return on_ms;
+}
+
+/* Level at which both intervals have reached their maximum */
+static uint8_t max_level(const struct juxta_duty_cfg *cfg)
+{
+    uint8_t level = 0;
+    while (level < JUXTA_DUTY_MAX_LEVEL &&
+           ((cfg->adv_min_s && interval_at(cfg->adv_min_s, cfg->adv_max_s, level) < cfg->adv_max_s) ||
+            (cfg->scan_min_s && interval_at(cfg->scan_min_s, cfg->scan_max_s, level) < cfg->scan_max_s)))
+    {
+        level++;
+    }
+    return level;
+}
+
+static void apply_budget(struct juxta_duty_ctrl *ctrl)
+{
+    uint8_t top = max_level(&ctrl->cfg);
+
+    ctrl->budget_level = 0;
+    if (ctrl->cfg.budget_ms)
+    {
+        while (ctrl->budget_level < top && on_time_at(&ctrl->cfg, ctrl->budget_level) > ctrl->cfg.budget_ms)
+        {
+            ctrl->budget_level++;
+        }
+    }
+
+    if (ctrl->level > top)
+    {
+        ctrl->level = top;
+    }
+    if (ctrl->level < ctrl->budget_level)
+    {
+        ctrl->level = ctrl->budget_level;
+    }
+}
+
+static void step_faster(struct juxta_duty_ctrl *ctrl, bool to_fastest, uint32_t now_s)
+{
+    uint8_t target = to_fastest ? 0 : (ctrl->level ? ctrl->level - 1 : 0);
+    if (target < ctrl->budget_level)
+    {
+        target = ctrl->budget_level;
+    }
+    if (target < ctrl->level)
+    {
+        ctrl->level = target;
+        ctrl->steps_faster++;
+    }
+    ctrl->last_step_s = now_s;
+}
+
+static int find_peer(const uint32_t *ids, uint8_t count, uint32_t id)
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (ids[i] == id)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void juxta_duty_init(struct juxta_duty_ctrl *ctrl, const struct juxta_duty_cfg *cfg)
+{
+    memset(ctrl, 0, sizeof(*ctrl));
+    juxta_duty_set_cfg(ctrl, cfg);
+}
+
+void juxta_duty_set_cfg(struct juxta_duty_ctrl *ctrl, const struct juxta_duty_cfg *cfg)
+{
+    ctrl->cfg = *cfg;
+    apply_budget(ctrl);
+}
+
+void juxta_duty_observe_scan(struct juxta_duty_ctrl *ctrl, const uint32_t *ids,
+                             const int8_t *rssi, uint8_t count, uint32_t now_s)
+{
+    if (count > JUXTA_DUTY_MAX_PEERS)
+    {
+        count = JUXTA_DUTY_MAX_PEERS;
+    }
+
+    uint8_t new_count = 0;
+    uint8_t common = 0;
+    uint32_t churn = 0;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        int j = find_peer(ctrl->prev_ids, ctrl->prev_count, ids[i]);
+        if (j < 0)
+        {
+            new_count++;
+        }
+        else
+        {
+            int diff = rssi[i] - ctrl->prev_rssi[j];
+            churn += (diff < 0) ? -diff : diff;
+            common++;
+        }
+    }
+    uint8_t lost_count = ctrl->prev_count - common;
+
+    ctrl->scans++;
+    if (ctrl->have_prev)
+    {
+        ctrl->new_peers += new_count;
+        ctrl->lost_peers += lost_count;
+
+        if (new_count > 0)
+        {
+            /* Someone arrived: sample the encounter as densely as allowed */
+            step_faster(ctrl, true, now_s);
+        }
+        else if (lost_count > 0 || (common && churn >= (uint32_t)ctrl->cfg.churn_db * common))
+        {
+            step_faster(ctrl, false, now_s);
+        }
+        else if ((uint32_t)(now_s - ctrl->last_step_s) >= ctrl->cfg.hold_s)
+        {
+            if (ctrl->level < max_level(&ctrl->cfg))
+            {
+                ctrl->level++;
+                ctrl->steps_slower++;
+            }
+            ctrl->last_step_s = now_s;
+        }
+    }
+    else
+    {
+        ctrl->last_step_s = now_s;
+    }
+
+    memcpy(ctrl->prev_ids, ids, count * sizeof(ids[0]));
+    memcpy(ctrl->prev_rssi, rssi, count * sizeof(rssi[0]));
+    ctrl->prev_count = count;
+    ctrl->have_prev = true;
+}
+
+void juxta_duty_observe_motion(struct juxta_duty_ctrl *ctrl, uint8_t motion_count, uint32_t now_s)
+{
+    if (ctrl->cfg.motion_threshold && motion_count >= ctrl->cfg.motion_threshold)
+    {
+        step_faster(ctrl, false, now_s);
+    }
+}
+
+uint16_t juxta_duty_adv_interval(const struct juxta_duty_ctrl *ctrl)
+{
+    return interval_at(ctrl->cfg.adv_min_s, ctrl->cfg.adv_max_s, ctrl->level);
+}
+
+uint16_t juxta_duty_scan_interval(const struct juxta_duty_ctrl *ctrl)
+{
+    return interval_at(ctrl->cfg.scan_min_s, ctrl->cfg.scan_max_s, ctrl->level);
+}
+
+uint32_t juxta_duty_on_time_per_hour(const struct juxta_duty_ctrl *ctrl)
+{
+    return on_time_at(&ctrl->cfg, ctrl->level);
+}
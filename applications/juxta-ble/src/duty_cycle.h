@@ -0,0 +1,106 @@
+/*
+ * JUXTA Adaptive Duty Cycle Controller Header
+ * Chooses adv/scan burst intervals from what the scans and the
+ * accelerometer report: new peers snap back to the fastest intervals, lost
+ * peers, RSSI churn and motion step faster, and quiet periods step slower.
+ * Intervals move in power-of-two multiples of the minimum so windows of
+ * different devices stay nested. No Zephyr dependencies.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef JUXTA_DUTY_CYCLE_H_
+#define JUXTA_DUTY_CYCLE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define JUXTA_DUTY_MAX_PEERS 64
+#define JUXTA_DUTY_MAX_LEVEL 7 /* Slowest step: 128x the minimum interval */
+
+    struct juxta_duty_cfg
+    {
+        uint16_t adv_min_s;       /* Fastest adv interval (0 = no advertising) */
+        uint16_t adv_max_s;       /* Slowest adv interval */
+        uint16_t scan_min_s;      /* Fastest scan interval (0 = no scanning) */
+        uint16_t scan_max_s;      /* Slowest scan interval */
+        uint32_t budget_ms;       /* Radio on-time allowed per hour, 0 = unlimited */
+        uint16_t adv_on_ms;       /* Radio on-time of one adv burst */
+        uint16_t scan_on_ms;      /* Radio on-time of one scan burst */
+        uint16_t hold_s;          /* Quiet time before each step slower */
+        uint8_t churn_db;         /* Mean |RSSI change| per peer that counts as activity */
+        uint8_t motion_threshold; /* Motion events per minute that count as activity */
+    };
+
+    struct juxta_duty_ctrl
+    {
+        struct juxta_duty_cfg cfg;
+        uint8_t level;         /* Interval = min << level, clamped to max */
+        uint8_t budget_level;  /* Lowest level that fits the energy budget */
+        uint32_t last_step_s;  /* Time of the last level change or activity */
+        uint32_t prev_ids[JUXTA_DUTY_MAX_PEERS];
+        int8_t prev_rssi[JUXTA_DUTY_MAX_PEERS];
+        uint8_t prev_count;
+        bool have_prev;
+
+        /* Statistics */
+        uint32_t scans;
+        uint32_t new_peers;
+        uint32_t lost_peers;
+        uint32_t steps_faster;
+        uint32_t steps_slower;
+    };
+
+    /**
+     * @brief Initialize the controller at the fastest intervals
+     */
+    void juxta_duty_init(struct juxta_duty_ctrl *ctrl, const struct juxta_duty_cfg *cfg);
+
+    /**
+     * @brief Apply new bounds or budget, keeping the current level
+     */
+    void juxta_duty_set_cfg(struct juxta_duty_ctrl *ctrl, const struct juxta_duty_cfg *cfg);
+
+    /**
+     * @brief Feed the peers seen by one scan burst
+     *
+     * @param ctrl Controller
+     * @param ids Peer identifiers
+     * @param rssi Strongest RSSI per peer
+     * @param count Number of peers
+     * @param now_s Current time in seconds
+     */
+    void juxta_duty_observe_scan(struct juxta_duty_ctrl *ctrl, const uint32_t *ids,
+                                 const int8_t *rssi, uint8_t count, uint32_t now_s);
+
+    /**
+     * @brief Feed one minute's motion event count
+     */
+    void juxta_duty_observe_motion(struct juxta_duty_ctrl *ctrl, uint8_t motion_count, uint32_t now_s);
+
+    /**
+     * @brief Current advertising interval in seconds
+     */
+    uint16_t juxta_duty_adv_interval(const struct juxta_duty_ctrl *ctrl);
+
+    /**
+     * @brief Current scanning interval in seconds
+     */
+    uint16_t juxta_duty_scan_interval(const struct juxta_duty_ctrl *ctrl);
+
+    /**
+     * @brief Estimated radio on-time per hour at the current intervals
+     */
+    uint32_t juxta_duty_on_time_per_hour(const struct juxta_duty_ctrl *ctrl);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JUXTA_DUTY_CYCLE_H_ */
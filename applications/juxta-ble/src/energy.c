@@ -0,0 +1,224 @@
+/*
+ * JUXTA Energy Accounting Implementation
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "energy.h"
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <string.h>
+
+LOG_MODULE_REGISTER(juxta_energy, LOG_LEVEL_INF);
+
+/* Increment over the floor while each state is active */
+static const uint32_t model_ua[JUXTA_ENERGY_SOURCE_COUNT] = {
+    [JUXTA_ENERGY_ADV] = CONFIG_JUXTA_BLE_ENERGY_ADV_UA,
+    [JUXTA_ENERGY_SCAN] = CONFIG_JUXTA_BLE_ENERGY_SCAN_UA,
+    [JUXTA_ENERGY_CONN] = CONFIG_JUXTA_BLE_ENERGY_CONN_UA,
+    [JUXTA_ENERGY_FRAM] = CONFIG_JUXTA_BLE_ENERGY_FRAM_UA,
+    [JUXTA_ENERGY_ACCEL] = CONFIG_JUXTA_BLE_ENERGY_ACCEL_UA,
+    [JUXTA_ENERGY_SAADC] = CONFIG_JUXTA_BLE_ENERGY_SAADC_UA,
+    [JUXTA_ENERGY_CPU] = CONFIG_JUXTA_BLE_ENERGY_CPU_UA,
+    [JUXTA_ENERGY_SLEEP] = CONFIG_JUXTA_BLE_ENERGY_SLEEP_UA,
+};
+
+static const char *const source_names[JUXTA_ENERGY_SOURCE_COUNT] = {
+    "adv", "scan", "conn", "fram", "accel", "saadc", "cpu", "sleep",
+};
+
+#define NC_PER_UAH 3600000ULL
+
+/*
+ * Hooks only count time: enter/exit stamp the cycle counter, and the
+ * open minute accumulates active microseconds per state. Charge is
+ * computed once per minute, when the minute closes.
+ */
+static struct k_spinlock energy_lock;
+static uint8_t depth[JUXTA_ENERGY_SOURCE_COUNT];
+static uint32_t entered_cyc[JUXTA_ENERGY_SOURCE_COUNT];
+static uint64_t open_us[JUXTA_ENERGY_SOURCE_COUNT];
+static uint32_t minute_start_cyc;
+static bool minute_started;
+static struct juxta_energy_totals last_minute;
+static struct juxta_energy_totals today;
+static struct juxta_energy_totals yesterday;
+
+static bool source_enterable(enum juxta_energy_source source)
+{
+    return source < JUXTA_ENERGY_SLEEP;
+}
+
+void juxta_energy_enter(enum juxta_energy_source source)
+{
+    if (!source_enterable(source))
+    {
+        return;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&energy_lock);
+    if (depth[source]++ == 0)
+    {
+        entered_cyc[source] = k_cycle_get_32();
+    }
+    k_spin_unlock(&energy_lock, key);
+}
+
+void juxta_energy_exit(enum juxta_energy_source source)
+{
+    if (!source_enterable(source))
+    {
+        return;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&energy_lock);
+    if (depth[source] > 0 && --depth[source] == 0)
+    {
+        open_us[source] += k_cyc_to_us_floor32(k_cycle_get_32() - entered_cyc[source]);
+    }
+    k_spin_unlock(&energy_lock, key);
+}
+
+void juxta_energy_add_us(enum juxta_energy_source source, uint32_t active_us)
+{
+    if (!source_enterable(source))
+    {
+        return;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&energy_lock);
+    open_us[source] += active_us;
+    k_spin_unlock(&energy_lock, key);
+}
+
+static void totals_add(struct juxta_energy_totals *dst, const struct juxta_energy_totals *src)
+{
+    for (int i = 0; i < JUXTA_ENERGY_SOURCE_COUNT; i++)
+    {
+        dst->charge_nc[i] += src->charge_nc[i];
+    }
+    dst->duration_s += src->duration_s;
+}
+
+void juxta_energy_minute_tick(bool new_day)
+{
+    struct juxta_energy_totals minute = {0};
+
+    k_spinlock_key_t key = k_spin_lock(&energy_lock);
+    uint32_t now = k_cycle_get_32();
+    if (!minute_started)
+    {
+        /* First boundary after boot: start counting from here */
+        minute_started = true;
+        minute_start_cyc = now;
+        memset(open_us, 0, sizeof(open_us));
+        k_spin_unlock(&energy_lock, key);
+        return;
+    }
+
+    uint32_t wall_us = k_cyc_to_us_floor32(now - minute_start_cyc);
+    minute_start_cyc = now;
+    for (int i = 0; i < JUXTA_ENERGY_SLEEP; i++)
+    {
+        if (depth[i] > 0)
+        {
+            open_us[i] += k_cyc_to_us_floor32(now - entered_cyc[i]);
+            entered_cyc[i] = now;
+        }
+        /* uA x us = pC */
+        minute.charge_nc[i] = (open_us[i] * model_ua[i]) / 1000U;
+        open_us[i] = 0;
+    }
+    minute.charge_nc[JUXTA_ENERGY_SLEEP] = ((uint64_t)wall_us * model_ua[JUXTA_ENERGY_SLEEP]) / 1000U;
+    minute.duration_s = (wall_us + 500000U) / 1000000U;
+
+    last_minute = minute;
+    totals_add(&today, &minute);
+    if (new_day)
+    {
+        yesterday = today;
+        memset(&today, 0, sizeof(today));
+    }
+    k_spin_unlock(&energy_lock, key);
+}
+
+void juxta_energy_get_totals(enum juxta_energy_window window, struct juxta_energy_totals *totals)
+{
+    k_spinlock_key_t key = k_spin_lock(&energy_lock);
+    switch (window)
+    {
+    case JUXTA_ENERGY_LAST_MINUTE:
+        *totals = last_minute;
+        break;
+    case JUXTA_ENERGY_TODAY:
+        *totals = today;
+        break;
+    case JUXTA_ENERGY_YESTERDAY:
+    default:
+        *totals = yesterday;
+        break;
+    }
+    k_spin_unlock(&energy_lock, key);
+}
+
+static uint64_t totals_charge_nc(const struct juxta_energy_totals *totals)
+{
+    uint64_t sum = 0;
+
+    for (int i = 0; i < JUXTA_ENERGY_SOURCE_COUNT; i++)
+    {
+        sum += totals->charge_nc[i];
+    }
+    return sum;
+}
+
+uint32_t juxta_energy_avg_ua(void)
+{
+    struct juxta_energy_totals day, prev;
+
+    juxta_energy_get_totals(JUXTA_ENERGY_TODAY, &day);
+    juxta_energy_get_totals(JUXTA_ENERGY_YESTERDAY, &prev);
+
+    const struct juxta_energy_totals *window = &day;
+    if (day.duration_s < 3600 && prev.duration_s > 0)
+    {
+        window = &prev;
+    }
+    if (window->duration_s == 0)
+    {
+        return 0;
+    }
+
+    /* nC / s = nA */
+    return (uint32_t)(totals_charge_nc(window) / window->duration_s / 1000U);
+}
+
+uint32_t juxta_energy_runtime_h(uint8_t battery_percent)
+{
+    uint32_t avg_ua = juxta_energy_avg_ua();
+    if (avg_ua == 0)
+    {
+        return 0;
+    }
+
+    uint64_t remaining_uah = (uint64_t)CONFIG_JUXTA_BLE_ENERGY_BATTERY_MAH * 1000U * MIN(battery_percent, 100) / 100U;
+    return (uint32_t)(remaining_uah / avg_ua);
+}
+
+void juxta_energy_log(void)
+{
+    struct juxta_energy_totals minute, day;
+
+    juxta_energy_get_totals(JUXTA_ENERGY_LAST_MINUTE, &minute);
+    juxta_energy_get_totals(JUXTA_ENERGY_TODAY, &day);
+
+    LOG_INF("🔋 Energy: avg %u uA over %s", juxta_energy_avg_ua(),
+            (day.duration_s >= 3600) ? "today" : "yesterday");
+    for (int i = 0; i < JUXTA_ENERGY_SOURCE_COUNT; i++)
+    {
+        LOG_INF("🔋   %-5s last min %6u uC, today %6u uAh",
+                source_names[i], (uint32_t)(minute.charge_nc[i] / 1000U),
+                (uint32_t)(day.charge_nc[i] / NC_PER_UAH));
+    }
+}
@@ -0,0 +1,127 @@
+/*
+ * JUXTA Energy Accounting Header
+ * Times how long each subsystem is active (radio bursts and connections,
+ * SPI FRAM/accelerometer, SAADC, CPU), multiplies by a per-state current
+ * model and keeps per-minute and per-day charge totals, so scheduling
+ * changes can be judged by projected runtime.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef JUXTA_ENERGY_H_
+#define JUXTA_ENERGY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Charge sources
+     *
+     * The active states overlap freely (a FRAM write runs on the CPU during
+     * a scan burst); each model current is the increment over the sleep
+     * floor while that state is active.
+     */
+    enum juxta_energy_source
+    {
+        JUXTA_ENERGY_ADV = 0, /* Advertising burst (normal or gateway) */
+        JUXTA_ENERGY_SCAN,    /* Scan burst */
+        JUXTA_ENERGY_CONN,    /* Gateway connection */
+        JUXTA_ENERGY_FRAM,    /* SPI bus held by the FRAM */
+        JUXTA_ENERGY_ACCEL,   /* SPI bus held by the accelerometer */
+        JUXTA_ENERGY_SAADC,   /* Battery sample or ADC capture */
+        JUXTA_ENERGY_CPU,     /* Non-idle CPU time */
+        JUXTA_ENERGY_SLEEP,   /* Floor current over wall time (not enterable) */
+        JUXTA_ENERGY_SOURCE_COUNT
+    };
+
+    enum juxta_energy_window
+    {
+        JUXTA_ENERGY_LAST_MINUTE = 0, /* Last closed minute */
+        JUXTA_ENERGY_TODAY,           /* Closed minutes since midnight */
+        JUXTA_ENERGY_YESTERDAY,       /* Previous full day */
+    };
+
+    /**
+     * @brief Charge totals of one window
+     */
+    struct juxta_energy_totals
+    {
+        uint64_t charge_nc[JUXTA_ENERGY_SOURCE_COUNT]; /* Nanocoulombs (uA x ms) per source */
+        uint32_t duration_s;                           /* Wall time covered */
+    };
+
+#ifdef CONFIG_JUXTA_BLE_ENERGY
+
+    /**
+     * @brief Mark a state active (nests per state)
+     */
+    void juxta_energy_enter(enum juxta_energy_source source);
+
+    /**
+     * @brief Mark a state inactive after the matching enter
+     */
+    void juxta_energy_exit(enum juxta_energy_source source);
+
+    /**
+     * @brief Add active time measured elsewhere (SPI bus holds, CPU usage)
+     */
+    void juxta_energy_add_us(enum juxta_energy_source source, uint32_t active_us);
+
+    /**
+     * @brief Close the current minute
+     *
+     * States still active are split at the boundary. Call once per minute.
+     *
+     * @param new_day The closed minute was the last of its day
+     */
+    void juxta_energy_minute_tick(bool new_day);
+
+    /**
+     * @brief Copy the totals of a window
+     */
+    void juxta_energy_get_totals(enum juxta_energy_window window, struct juxta_energy_totals *totals);
+
+    /**
+     * @brief Average current in uA
+     *
+     * Over today once it covers an hour, else yesterday, else the minutes
+     * closed so far; 0 before the first minute closes.
+     */
+    uint32_t juxta_energy_avg_ua(void);
+
+    /**
+     * @brief Projected runtime at the average current
+     *
+     * @param battery_percent Remaining charge of CONFIG_JUXTA_BLE_ENERGY_BATTERY_MAH
+     * @return Hours, or 0 if unknown
+     */
+    uint32_t juxta_energy_runtime_h(uint8_t battery_percent);
+
+    /**
+     * @brief Log the per-source totals (RTT) at INFO level
+     */
+    void juxta_energy_log(void);
+
+#else
+
+static inline void juxta_energy_enter(enum juxta_energy_source source) { (void)source; }
+static inline void juxta_energy_exit(enum juxta_energy_source source) { (void)source; }
+static inline void juxta_energy_add_us(enum juxta_energy_source source, uint32_t active_us)
+{
+    (void)source;
+    (void)active_us;
+}
+
+#endif /* CONFIG_JUXTA_BLE_ENERGY */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JUXTA_ENERGY_H_ */
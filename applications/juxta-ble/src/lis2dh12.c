@@ -6,45 +6,62 @@
  */
 
 #include "lis2dh12.h"
+#include "activity.h"
+#include "work_monitor.h"
+#include <juxta_spi_bus/spi_bus.h>
 #include <zephyr/sys/util.h>
 #include <string.h>
 #include <stdlib.h>
 
-LOG_MODULE_REGISTER(lis2dh12, LOG_LEVEL_DBG);
+LOG_MODULE_REGISTER(lis2dh12, LOG_LEVEL_INF);
 
 /* Global context for platform functions */
 static struct lis2dh12_dev *g_lis2dh12_dev = NULL;
 
+/*
+ * Register access path: CS is driven by the SPI driver (spi_cs_control) and every
+ * access is a single EasyDMA transfer through fixed static buffers. The largest
+ * transfer is a full FIFO drain (32 samples x 6 bytes) after the address byte.
+ * The sensor is the high-priority client of the shared SPI bus; holding the bus
+ * also serializes use of the static buffers.
+ */
+#define LIS2DH12_SPI_READ 0x80
+#define LIS2DH12_SPI_AUTO_INC 0x40
+#define LIS2DH12_SPI_MAX_DATA (32 * 6)
+
+static uint8_t spi_tx_buf[1 + LIS2DH12_SPI_MAX_DATA];
+static uint8_t spi_rx_buf[1 + LIS2DH12_SPI_MAX_DATA];
+static struct juxta_spi_bus_client accel_bus;
+
 /**
  * @brief Platform-specific SPI read function for STMicroelectronics library
  *
- * This function implements the required interface for the library's function pointers.
+ * Reads len consecutive registers starting at reg in one transaction.
  */
 int32_t lis2dh12_platform_read(void *handle, uint8_t reg, uint8_t *data, uint16_t len)
 {
-    /* For SPI, set read bit (bit 7) and increment bit (bit 6) for multi-byte reads */
-    uint8_t tx_reg = reg | 0x80; /* Set read bit */
-    if (len > 1)
+    ARG_UNUSED(handle);
+
+    if (!g_lis2dh12_dev || !g_lis2dh12_dev->initialized)
     {
-        tx_reg |= 0x40; /* Set increment bit for multi-byte reads */
+        return -ENODEV;
+    }
+    if (len == 0 || len > LIS2DH12_SPI_MAX_DATA)
+    {
+        return -EINVAL;
     }
 
-    LOG_DBG("LIS2DH READ: reg=0x%02X, tx_reg=0x%02X, len=%d", reg, tx_reg, len);
-
-    uint8_t tx_buf[1 + len]; /* Register + dummy bytes */
-    uint8_t rx_buf[1 + len]; /* Response */
-
-    tx_buf[0] = tx_reg;
-    memset(&tx_buf[1], 0x00, len); /* Dummy bytes */
+    juxta_spi_bus_acquire(&accel_bus);
 
-    LOG_DBG("LIS2DH READ: tx_buf[0]=0x%02X, tx_buf[1]=0x%02X", tx_buf[0], tx_buf[1]);
+    /* Read bit, plus address auto-increment for multi-byte reads; the data phase clocks out dummies */
+    spi_tx_buf[0] = reg | LIS2DH12_SPI_READ | ((len > 1) ? LIS2DH12_SPI_AUTO_INC : 0);
 
     const struct spi_buf tx_bufs = {
-        .buf = tx_buf,
-        .len = sizeof(tx_buf)};
+        .buf = spi_tx_buf,
+        .len = 1};
     const struct spi_buf rx_bufs = {
-        .buf = rx_buf,
-        .len = sizeof(rx_buf)};
+        .buf = spi_rx_buf,
+        .len = 1 + len};
     const struct spi_buf_set tx = {
         .buffers = &tx_bufs,
         .count = 1};
@@ -52,17 +69,14 @@ int32_t lis2dh12_platform_read(void *handle, uint8_t reg, uint8_t *data, uint16_
         .buffers = &rx_bufs,
         .count = 1};
 
-    /* Set CS low (select device - CS is active low) */
-    gpio_pin_set(g_lis2dh12_dev->cs_gpio.port, g_lis2dh12_dev->cs_gpio.pin, 0);
-    k_sleep(K_USEC(10)); // Small delay for CS setup
-    LOG_DBG("LIS2DH READ: CS set low (selected), starting SPI transaction");
-
-    /* Perform SPI transaction */
-    int ret = spi_transceive(g_lis2dh12_dev->spi_dev, &g_lis2dh12_dev->spi_cfg, &tx, &rx);
+    int ret = juxta_spi_bus_transceive(&accel_bus, &tx, &rx);
+    if (ret == 0)
+    {
+        /* Skip the byte clocked in during the address phase */
+        memcpy(data, &spi_rx_buf[1], len);
+    }
 
-    /* Set CS high (deselect device - CS is active low) */
-    gpio_pin_set(g_lis2dh12_dev->cs_gpio.port, g_lis2dh12_dev->cs_gpio.pin, 1);
-    LOG_DBG("LIS2DH READ: CS set high (deselected), SPI transaction complete");
+    juxta_spi_bus_release(&accel_bus);
 
     if (ret < 0)
     {
@@ -70,55 +84,44 @@ int32_t lis2dh12_platform_read(void *handle, uint8_t reg, uint8_t *data, uint16_
         return ret;
     }
 
-    LOG_DBG("LIS2DH READ: raw rx_buf[0]=0x%02X, rx_buf[1]=0x%02X", rx_buf[0], rx_buf[1]);
-
-    /* Copy received data (skip first byte which is the register echo) */
-    memcpy(data, &rx_buf[1], len);
-
-    LOG_DBG("LIS2DH READ: received data[0]=0x%02X", data[0]);
     return 0;
 }
 
 /**
  * @brief Platform-specific SPI write function for STMicroelectronics library
  *
- * This function implements the required interface for the library's function pointers.
+ * Writes len consecutive registers starting at reg in one transaction.
  */
 int32_t lis2dh12_platform_write(void *handle, uint8_t reg, const uint8_t *data, uint16_t len)
 {
+    ARG_UNUSED(handle);
+
     if (!g_lis2dh12_dev || !g_lis2dh12_dev->initialized)
     {
         LOG_ERR("LIS2DH12 device not initialized");
         return -ENODEV;
     }
-
-    /* For SPI, clear read bit (bit 7) and set increment bit (bit 6) for multi-byte writes */
-    uint8_t tx_reg = reg & 0x7F; /* Clear read bit */
-    if (len > 1)
+    if (len == 0 || len > LIS2DH12_SPI_MAX_DATA)
     {
-        tx_reg |= 0x40; /* Set increment bit for multi-byte writes */
+        return -EINVAL;
     }
 
-    uint8_t tx_buf[1 + len]; /* Register + data */
-    tx_buf[0] = tx_reg;
-    memcpy(&tx_buf[1], data, len);
+    juxta_spi_bus_acquire(&accel_bus);
+
+    /* Write (read bit clear), plus address auto-increment for multi-byte writes */
+    spi_tx_buf[0] = (reg & 0x3F) | ((len > 1) ? LIS2DH12_SPI_AUTO_INC : 0);
+    memcpy(&spi_tx_buf[1], data, len); /* Also keeps const tables out of flash for EasyDMA */
 
     const struct spi_buf tx_bufs = {
-        .buf = tx_buf,
-        .len = sizeof(tx_buf)};
+        .buf = spi_tx_buf,
+        .len = 1 + len};
     const struct spi_buf_set tx = {
         .buffers = &tx_bufs,
         .count = 1};
 
-    /* Set CS low (select device - CS is active low) */
-    gpio_pin_set(g_lis2dh12_dev->cs_gpio.port, g_lis2dh12_dev->cs_gpio.pin, 0);
-    k_sleep(K_USEC(10)); // Small delay for CS setup
+    int ret = juxta_spi_bus_write(&accel_bus, &tx);
 
-    /* Perform SPI transaction */
-    int ret = spi_write(g_lis2dh12_dev->spi_dev, &g_lis2dh12_dev->spi_cfg, &tx);
-
-    /* Set CS high (deselect device - CS is active low) */
-    gpio_pin_set(g_lis2dh12_dev->cs_gpio.port, g_lis2dh12_dev->cs_gpio.pin, 1);
+    juxta_spi_bus_release(&accel_bus);
 
     if (ret < 0)
     {
@@ -150,23 +153,21 @@ int lis2dh12_init(struct lis2dh12_dev *dev)
         return -ENODEV;
     }
 
-    /* Configure CS as output - since device tree shows GPIO_ACTIVE_LOW, we need to set it HIGH to deselect */
-    int ret = gpio_pin_configure(dev->cs_gpio.port, dev->cs_gpio.pin, GPIO_OUTPUT);
-    if (ret < 0)
-    {
-        LOG_ERR("Failed to configure CS GPIO: %d", ret);
-        return ret;
-    }
-
-    /* Set CS high initially (deselect device since CS is active low) */
-    gpio_pin_set(dev->cs_gpio.port, dev->cs_gpio.pin, 1);
-
     /* Configure SPI for LIS2DH12 */
     dev->spi_cfg.frequency = 8000000;                            /* 8MHz max for LIS2DH12 */
     dev->spi_cfg.operation = SPI_WORD_SET(8) | SPI_TRANSFER_MSB; /* Mode 0 (CPOL=0, CPHA=0) */
     dev->spi_cfg.slave = 1;                                      /* Use slave 1 (accel@1 in device tree) */
+
+    /* CS is asserted by the SPI driver around each transaction (active low from the device tree flags) */
+    dev->spi_cfg.cs.gpio = dev->cs_gpio;
     dev->spi_cfg.cs.delay = 0;
 
+    int ret = juxta_spi_bus_client_init(&accel_bus, "accel", dev->spi_dev, &dev->spi_cfg, JUXTA_SPI_BUS_PRIO_HIGH);
+    if (ret < 0)
+    {
+        return ret;
+    }
+
     /* Set global context for platform functions */
     g_lis2dh12_dev = dev;
     dev->initialized = true;
@@ -210,8 +211,8 @@ int lis2dh12_init(struct lis2dh12_dev *dev)
         return ret;
     }
 
-    /* Temperature sensor will be enabled on-demand during minute logging */
-    /* TEMP_CFG_REG (0x1F): Keep TEMP_EN[1:0] = 00 (disabled) for power efficiency */
+    /* Temperature sensor is enabled by the background sampler once motion detection is configured */
+    /* TEMP_CFG_REG (0x1F): Keep TEMP_EN[1:0] = 00 (disabled) until then */
     uint8_t temp_cfg = 0x00;                                 // 0b00000000: TEMP_EN[1:0] = 00 (disabled)
     ret = lis2dh12_platform_write(NULL, 0x1F, &temp_cfg, 1); // TEMP_CFG_REG
     if (ret < 0)
@@ -283,28 +284,20 @@ int lis2dh12_read_temperature_lowres(struct lis2dh12_dev *dev, int8_t *temperatu
         return -EINVAL;
     }
 
-    /* Read both temperature registers */
-    uint8_t temp_l, temp_h;
-    int ret = lis2dh12_platform_read(NULL, 0x0C, &temp_l, 1); // OUT_TEMP_L
-    if (ret < 0)
-    {
-        LOG_ERR("Failed to read OUT_TEMP_L: %d", ret);
-        return ret;
-    }
-    ret = lis2dh12_platform_read(NULL, 0x0D, &temp_h, 1); // OUT_TEMP_H
+    /* Read both temperature registers in one burst */
+    uint8_t raw[2];
+    int ret = lis2dh12_platform_read(NULL, 0x0C, raw, sizeof(raw)); // OUT_TEMP_L, OUT_TEMP_H
     if (ret < 0)
     {
-        LOG_ERR("Failed to read OUT_TEMP_H: %d", ret);
+        LOG_ERR("Failed to read OUT_TEMP: %d", ret);
         return ret;
     }
 
     /* Combine into 16-bit LSB value */
-    int16_t lsb = ((int16_t)temp_h << 8) | temp_l;
-    LOG_DBG("LIS2DH temp raw: L=0x%02X H=0x%02X LSB=%d", temp_l, temp_h, lsb);
+    int16_t lsb = ((int16_t)raw[1] << 8) | raw[0];
 
     /* Convert using low-power mode formula */
     float_t temp_celsius = lis2dh12_from_lsb_lp_to_celsius(lsb);
-    LOG_DBG("LIS2DH temp conversion: LSB=%d -> %d°C", lsb, (int)temp_celsius);
 
     /* Convert to 8-bit signed for compatibility */
     *temperature = (int8_t)temp_celsius;
@@ -312,103 +305,6 @@ int lis2dh12_read_temperature_lowres(struct lis2dh12_dev *dev, int8_t *temperatu
     return 0;
 }
 
-/**
- * @brief Get temperature reading from global LIS2DH device
- * Public interface for motion system temperature access
- */
-/**
- * @brief Enable temperature sensor for reading
- * This function enables the temperature sensor, waits for stabilization, then reads the temperature
- */
-int lis2dh12_enable_and_read_temperature(int8_t *temperature)
-{
-    if (!temperature)
-    {
-        return -EINVAL;
-    }
-
-    if (!g_lis2dh12_dev || !g_lis2dh12_dev->initialized)
-    {
-        LOG_WRN("LIS2DH device not initialized for temperature reading");
-        *temperature = 0; /* Default to 0 if not available */
-        return -ENODEV;
-    }
-
-    /* Enable temperature sensor */
-    uint8_t temp_cfg = 0xC0;                                     // 0b11000000: TEMP_EN[1:0] = 11 (enable temp sensor)
-    int ret = lis2dh12_platform_write(NULL, 0x1F, &temp_cfg, 1); // TEMP_CFG_REG
-    if (ret < 0)
-    {
-        LOG_ERR("Failed to enable temperature sensor: %d", ret);
-        *temperature = 0;
-        return ret;
-    }
-
-    /* Ensure device is in low power mode for temperature sensor */
-    uint8_t ctrl_reg1 = 0x2F;                                 // 0b00101111: ODR=10Hz, XYZ enabled, LPen=1 (low power mode)
-    ret = lis2dh12_platform_write(NULL, 0x20, &ctrl_reg1, 1); // CTRL_REG1
-    if (ret < 0)
-    {
-        LOG_ERR("Failed to set CTRL_REG1 for temperature: %d", ret);
-        *temperature = 0;
-        return ret;
-    }
-
-    /* Set BDU bit in CTRL_REG4 - REQUIRED for temperature sensor operation */
-    uint8_t ctrl_reg4 = 0x80;                                 // 0b10000000: BDU=1 (Block Data Update enabled)
-    ret = lis2dh12_platform_write(NULL, 0x23, &ctrl_reg4, 1); // CTRL_REG4
-    if (ret < 0)
-    {
-        LOG_ERR("Failed to set CTRL_REG4 BDU for temperature: %d", ret);
-        *temperature = 0;
-        return ret;
-    }
-
-    /* Wait for temperature sensor to stabilize (200ms for better results) */
-    k_sleep(K_MSEC(200));
-
-    /* Read temperature using the low-resolution function */
-    ret = lis2dh12_read_temperature_lowres(g_lis2dh12_dev, temperature);
-    if (ret < 0)
-    {
-        LOG_WRN("Failed to read LIS2DH temperature: %d", ret);
-        *temperature = 0; /* Default to 0 if read fails */
-    }
-
-    /* Disable temperature sensor to save power */
-    temp_cfg = 0x00;                                         // 0b00000000: TEMP_EN[1:0] = 00 (disabled)
-    ret = lis2dh12_platform_write(NULL, 0x1F, &temp_cfg, 1); // TEMP_CFG_REG
-    if (ret < 0)
-    {
-        LOG_WRN("Failed to disable temperature sensor: %d", ret);
-    }
-
-    /* Restore device to motion detection mode */
-    uint8_t ctrl_reg1_restore = 0x57;                                 // 0b01010111: ODR=100Hz, XYZ enabled, LPen=0 (motion detection mode)
-    ret = lis2dh12_platform_write(NULL, 0x20, &ctrl_reg1_restore, 1); // CTRL_REG1
-    if (ret < 0)
-    {
-        LOG_WRN("Failed to restore CTRL_REG1 after temperature: %d", ret);
-    }
-
-    /* Restore CTRL_REG4 to motion detection mode (BDU=0) */
-    uint8_t ctrl_reg4_restore = 0x00;                                 // 0b00000000: BDU=0 (motion detection mode)
-    ret = lis2dh12_platform_write(NULL, 0x23, &ctrl_reg4_restore, 1); // CTRL_REG4
-    if (ret < 0)
-    {
-        LOG_WRN("Failed to restore CTRL_REG4 after temperature: %d", ret);
-    }
-
-    LOG_DBG("LIS2DH temperature: %d°C (sensor enabled on-demand)", *temperature);
-    return 0;
-}
-
-int lis2dh12_get_temperature(int8_t *temperature)
-{
-    /* Use the new on-demand temperature reading function */
-    return lis2dh12_enable_and_read_temperature(temperature);
-}
-
 int lis2dh12_configure_motion_detection(struct lis2dh12_dev *dev,
                                         uint8_t threshold, uint8_t duration)
 {
@@ -421,64 +317,27 @@ int lis2dh12_configure_motion_detection(struct lis2dh12_dev *dev,
 
     /* Configure motion detection using high-pass filter - following ST AN5005 section 6.3.3 */
 
-    /* Step 1: Write 57h into CTRL_REG1 - Turn on sensor, enable X, Y, Z, ODR = 100 Hz, LPen = 0 (motion detection mode) */
-    uint8_t ctrl_reg1 = 0x57; // 0b01010111: ODR=100Hz, XYZ enabled, LPen=0 (motion detection mode)
-    ret = lis2dh12_platform_write(NULL, 0x20, &ctrl_reg1, 1);
+    /* Steps 1-5: CTRL_REG1..CTRL_REG5 (0x20-0x24) in one burst write */
+    const uint8_t ctrl_regs[5] = {
+        0x57, /* CTRL_REG1: ODR=100Hz, XYZ enabled, LPen=0 (motion detection mode) */
+        0x09, /* CTRL_REG2: High-pass filter enabled on interrupt activity 1 */
+        0x40, /* CTRL_REG3: Interrupt activity 1 driven to INT1 pin */
+        0x80, /* CTRL_REG4: FS = ±2 g, BDU = 1 (keeps OUT_TEMP_L/H paired; interrupts use internal data) */
+        0x08, /* CTRL_REG5: Interrupt 1 pin latched */
+    };
+    ret = lis2dh12_platform_write(NULL, 0x20, ctrl_regs, sizeof(ctrl_regs));
     if (ret < 0)
     {
-        LOG_ERR("Failed to configure CTRL_REG1: %d", ret);
+        LOG_ERR("Failed to configure CTRL_REG1-5: %d", ret);
         return ret;
     }
 
-    /* Step 2: Write 09h into CTRL_REG2 - High-pass filter enabled on interrupt activity 1 */
-    uint8_t ctrl_reg2 = 0x09; // 0b00001001: HP filter enabled on INT1
-    ret = lis2dh12_platform_write(NULL, 0x21, &ctrl_reg2, 1);
+    /* Steps 6-7: INT1_THS (mg) and INT1_DURATION (samples) in one burst write */
+    const uint8_t int1_ths_dur[2] = {threshold, duration};
+    ret = lis2dh12_platform_write(NULL, 0x32, int1_ths_dur, sizeof(int1_ths_dur));
     if (ret < 0)
     {
-        LOG_ERR("Failed to configure CTRL_REG2: %d", ret);
-        return ret;
-    }
-
-    /* Step 3: Write 40h into CTRL_REG3 - Interrupt activity 1 driven to INT1 pin */
-    uint8_t ctrl_reg3 = 0x40; // 0b01000000: INT1 activity routed to INT1 pin
-    ret = lis2dh12_platform_write(NULL, 0x22, &ctrl_reg3, 1);
-    if (ret < 0)
-    {
-        LOG_ERR("Failed to configure CTRL_REG3: %d", ret);
-        return ret;
-    }
-
-    /* Step 4: Write 00h into CTRL_REG4 - FS = ±2 g, BDU = 0 (motion detection mode) */
-    uint8_t ctrl_reg4 = 0x00; // 0b00000000: ±2g scale, BDU=0 (motion detection mode)
-    ret = lis2dh12_platform_write(NULL, 0x23, &ctrl_reg4, 1);
-    if (ret < 0)
-    {
-        LOG_ERR("Failed to configure CTRL_REG4: %d", ret);
-        return ret;
-    }
-
-    /* Step 5: Write 08h into CTRL_REG5 - Interrupt 1 pin latched */
-    uint8_t ctrl_reg5 = 0x08; // 0b00001000: INT1 latched
-    ret = lis2dh12_platform_write(NULL, 0x24, &ctrl_reg5, 1);
-    if (ret < 0)
-    {
-        LOG_ERR("Failed to configure CTRL_REG5: %d", ret);
-        return ret;
-    }
-
-    /* Step 6: Write threshold into INT1_THS - Threshold in mg */
-    ret = lis2dh12_platform_write(NULL, 0x32, &threshold, 1);
-    if (ret < 0)
-    {
-        LOG_ERR("Failed to set INT1 threshold: %d", ret);
-        return ret;
-    }
-
-    /* Step 7: Write duration into INT1_DURATION - Duration in samples */
-    ret = lis2dh12_platform_write(NULL, 0x33, &duration, 1);
-    if (ret < 0)
-    {
-        LOG_ERR("Failed to set INT1 duration: %d", ret);
+        LOG_ERR("Failed to set INT1 threshold/duration: %d", ret);
         return ret;
     }
 
@@ -500,7 +359,7 @@ int lis2dh12_configure_motion_detection(struct lis2dh12_dev *dev,
         return ret;
     }
 
-    LOG_INF("LIS2DH: High-pass filtered motion detection configured: threshold=%d mg, duration=%d samples (temperature on-demand)",
+    LOG_INF("LIS2DH: High-pass filtered motion detection configured: threshold=%d mg, duration=%d samples (temperature in background)",
             threshold, duration);
 
     /* Clear any pending interrupts by reading INT1_SRC register */
@@ -668,50 +527,379 @@ int lis2dh12_test_interrupt_clearing(struct lis2dh12_dev *dev)
     return ret;
 }
 
+/* ========================================================================
+ * Background Temperature Sampling
+ * ======================================================================== */
+
+/* The sensor stays enabled in motion mode (normal mode, BDU=1); a
+ * delayable work item reads it periodically and keeps an EMA in 1/256 °C */
+#define TEMP_SAMPLE_INTERVAL_MS 10000
+#define TEMP_FIRST_SAMPLE_MS 1000 /* Let a few ODR periods pass after enabling */
+#define TEMP_FILTER_SHIFT 2       /* EMA weight 1/4: ~40 s time constant */
+
+static struct k_work_delayable temp_work;
+static int32_t temp_filtered_q8;
+static bool temp_valid = false;
+static uint32_t temp_read_errors = 0;
+
+static void temp_work_handler(struct k_work *work)
+{
+    ARG_UNUSED(work);
+
+    /* OUT_TEMP_L/H in one auto-increment read */
+    uint8_t raw[2];
+    int ret = lis2dh12_platform_read(NULL, 0x0C, raw, sizeof(raw));
+    if (ret < 0)
+    {
+        temp_read_errors++;
+        LOG_WRN("LIS2DH temperature read failed: %d (%u errors)", ret, temp_read_errors);
+    }
+    else
+    {
+        /* Normal mode: 10-bit left-justified, 4 LSB/°C, 0 = 25 °C */
+        int16_t lsb = (int16_t)((raw[1] << 8) | raw[0]);
+        int32_t sample_q8 = (25 << 8) + ((int32_t)(lsb >> 6) << 6);
+
+        if (!temp_valid)
+        {
+            temp_filtered_q8 = sample_q8;
+            temp_valid = true;
+        }
+        else
+        {
+            temp_filtered_q8 += (sample_q8 - temp_filtered_q8) >> TEMP_FILTER_SHIFT;
+        }
+        LOG_DBG("LIS2DH temp sample: LSB=%d -> %d/256 °C, filtered %d/256 °C", lsb, sample_q8, temp_filtered_q8);
+    }
+
+    k_work_reschedule(&temp_work, K_MSEC(TEMP_SAMPLE_INTERVAL_MS));
+}
+
+static int lis2dh12_start_temperature_sampling(void)
+{
+    uint8_t temp_cfg = 0xC0;                                     // 0b11000000: TEMP_EN[1:0] = 11 (enable temp sensor)
+    int ret = lis2dh12_platform_write(NULL, 0x1F, &temp_cfg, 1); // TEMP_CFG_REG
+    if (ret < 0)
+    {
+        LOG_ERR("Failed to enable temperature sensor: %d", ret);
+        return ret;
+    }
+
+    k_work_init_delayable(&temp_work, temp_work_handler);
+    k_work_reschedule(&temp_work, K_MSEC(TEMP_FIRST_SAMPLE_MS));
+    return 0;
+}
+
+void lis2dh12_log_bus_stats(void)
+{
+    juxta_spi_bus_log_stats(&accel_bus);
+}
+
+uint32_t lis2dh12_bus_hold_us(void)
+{
+    return accel_bus.stats.hold_total_us;
+}
+
+/**
+ * @brief Get the filtered temperature from the background sampler
+ *
+ * Never touches the sensor, so it is safe on the minute record path.
+ *
+ * @return 0 on success, -EAGAIN before the first sample
+ */
+int lis2dh12_get_temperature(int8_t *temperature)
+{
+    if (!temperature)
+    {
+        return -EINVAL;
+    }
+
+    if (!temp_valid)
+    {
+        *temperature = 0;
+        return -EAGAIN;
+    }
+
+    int32_t celsius = (temp_filtered_q8 + 128) >> 8;
+    *temperature = (int8_t)CLAMP(celsius, INT8_MIN, INT8_MAX);
+    return 0;
+}
+
+
 /* ========================================================================
  * Motion System Management
  * ======================================================================== */
 
 /* Motion system state */
 static uint8_t motion_count = 0;
-static volatile bool lis2dh_interrupt_pending = false;
 static struct lis2dh12_dev motion_dev;
-static struct k_work motion_work;
-static struct k_timer motion_timer;
-static bool motion_based_intervals = false;
+static struct k_work_delayable motion_work;
+static volatile bool motion_based_intervals = false;
 static struct gpio_callback lis2dh_int_cb;
 
-/* Motion work handler - runs in work queue context (safe for longer operations) */
-static void motion_work_handler(struct k_work *work)
+#if IS_ENABLED(CONFIG_JUXTA_BLE_ACCEL_SLEEP_TO_WAKE) && DT_NODE_EXISTS(DT_PATH(gpio_keys, accel_int2))
+#define LIS2DH_HW_ACTIVITY 1
+#define ACT_ODR_HZ 100 /* CTRL_REG1 ODR of the motion detection configuration */
+
+static const struct gpio_dt_spec act_gpio = GPIO_DT_SPEC_GET(DT_PATH(gpio_keys, accel_int2), gpios);
+static struct gpio_callback lis2dh_act_cb;
+static uint32_t inactive_transitions = 0;
+
+/**
+ * @brief Read the sleep-to-wake state from INT2
+ *
+ * The chip drives INT2 high while it sits in its inactive 10 Hz mode
+ * (CTRL_REG6 polarity bit clear), whatever active level the board gives
+ * the line, so the logical level is mapped back to the line level.
+ *
+ * @return 1 if inactive, 0 if active, negative errno on read failure
+ */
+static int lis2dh_act_read_inactive(void)
+{
+    int level = gpio_pin_get_dt(&act_gpio);
+
+    if (level < 0)
+    {
+        return level;
+    }
+    return (level > 0) != ((act_gpio.dt_flags & GPIO_ACTIVE_LOW) != 0);
+}
+
+/* INT2 follows the sleep-to-wake state */
+static void lis2dh_act_callback(const struct device *dev, struct gpio_callback *cb, uint32_t pins)
+{
+    int state = lis2dh_act_read_inactive();
+
+    if (state < 0)
+    {
+        return;
+    }
+
+    bool inactive = state > 0;
+    if (inactive && !motion_based_intervals)
+    {
+        inactive_transitions++;
+    }
+    motion_based_intervals = inactive;
+}
+
+static int lis2dh12_configure_sleep_to_wake(void)
+{
+    /* ACT_THS (0x3E): 16 mg/LSB at ±2 g; ACT_DUR (0x3F): (8 * ACT_DUR + 1) / ODR seconds */
+    uint32_t dur = ((uint32_t)CONFIG_JUXTA_BLE_ACCEL_INACTIVE_S * ACT_ODR_HZ - 1) / 8;
+    const uint8_t act[2] = {
+        (uint8_t)MIN(CONFIG_JUXTA_BLE_ACCEL_ACT_THS_MG / 16, 0x7F),
+        (uint8_t)MIN(dur, 0xFF),
+    };
+    int ret = lis2dh12_platform_write(NULL, 0x3E, act, sizeof(act));
+    if (ret < 0)
+    {
+        LOG_ERR("Failed to set ACT_THS/ACT_DUR: %d", ret);
+        return ret;
+    }
+
+    uint8_t ctrl_reg6 = 0x08; // 0b00001000: P2_ACT, activity state on INT2 (active high)
+    ret = lis2dh12_platform_write(NULL, 0x25, &ctrl_reg6, 1);
+    if (ret < 0)
+    {
+        LOG_ERR("Failed to configure CTRL_REG6: %d", ret);
+        return ret;
+    }
+
+    if (!gpio_is_ready_dt(&act_gpio))
+    {
+        LOG_ERR("LIS2DH INT2 GPIO not ready");
+        return -ENODEV;
+    }
+
+    ret = gpio_pin_configure_dt(&act_gpio, GPIO_INPUT);
+    if (ret == 0)
+    {
+        ret = gpio_pin_interrupt_configure_dt(&act_gpio, GPIO_INT_EDGE_BOTH);
+    }
+    if (ret == 0)
+    {
+        gpio_init_callback(&lis2dh_act_cb, lis2dh_act_callback, BIT(act_gpio.pin));
+        ret = gpio_add_callback(act_gpio.port, &lis2dh_act_cb);
+    }
+    if (ret < 0)
+    {
+        LOG_ERR("Failed to configure LIS2DH INT2 interrupt: %d", ret);
+        return ret;
+    }
+
+    motion_based_intervals = lis2dh_act_read_inactive() > 0;
+    LOG_INF("✅ LIS2DH sleep-to-wake on INT2: threshold=%d mg, inactivity=%d s",
+            act[0] * 16, CONFIG_JUXTA_BLE_ACCEL_INACTIVE_S);
+    return 0;
+}
+#endif
+
+#if IS_ENABLED(CONFIG_JUXTA_BLE_ACCEL_FIFO)
+/* ========================================================================
+ * FIFO Stream Capture
+ * ======================================================================== */
+
+/* 25 Hz normal mode; the watermark leaves 16 samples (640 ms) of slack
+ * before the stream FIFO starts overwriting */
+#define FIFO_ODR_HZ 25
+#define FIFO_WATERMARK 16
+#define FIFO_DEPTH 32
+#define FIFO_MOTION_THRESHOLD_MG 160 /* INT1_THS of 10 at ±2 g, 16 mg/LSB */
+#define FIFO_MG_PER_LSB 4            /* Normal mode (10-bit) at ±2 g */
+
+static struct k_work fifo_work;
+static struct juxta_activity activity;
+static uint8_t fifo_buf[FIFO_DEPTH * 6];
+static uint32_t fifo_reads = 0;
+static uint32_t fifo_overruns = 0;
+
+static int lis2dh12_configure_fifo_stream(struct lis2dh12_dev *dev)
 {
-    if (lis2dh_interrupt_pending)
+    if (!dev || !dev->initialized)
     {
-        lis2dh_interrupt_pending = false;
+        return -EINVAL;
+    }
 
-        // Clear the interrupt so we can detect new ones
-        lis2dh12_clear_int1_interrupt(&motion_dev);
+    static const struct
+    {
+        uint8_t reg;
+        uint8_t val;
+    } seq[] = {
+        {0x20, 0x37},                  /* CTRL_REG1: ODR=25Hz, LPen=0, XYZ enabled */
+        {0x21, 0x00},                  /* CTRL_REG2: no high-pass filter */
+        {0x23, 0x80},                  /* CTRL_REG4: BDU=1, ±2g, normal mode */
+        {0x30, 0x00},                  /* INT1_CFG: no activity interrupt */
+        {0x2E, 0x00},                  /* FIFO_CTRL_REG: bypass mode clears the FIFO */
+        {0x24, 0x40},                  /* CTRL_REG5: FIFO_EN */
+        {0x2E, 0x80 | FIFO_WATERMARK}, /* FIFO_CTRL_REG: stream mode, watermark */
+        {0x22, 0x04},                  /* CTRL_REG3: I1_WTM on INT1 */
+    };
 
-        // Reset to default intervals when motion is detected
-        motion_based_intervals = false;
-        LOG_INF("🏃 Motion interrupt cleared (count: %d) - reset to default intervals", motion_count);
+    for (size_t i = 0; i < ARRAY_SIZE(seq); i++)
+    {
+        int ret = lis2dh12_platform_write(NULL, seq[i].reg, &seq[i].val, 1);
+        if (ret < 0)
+        {
+            LOG_ERR("Failed to write FIFO config reg 0x%02X: %d", seq[i].reg, ret);
+            return ret;
+        }
     }
+
+    LOG_INF("LIS2DH: FIFO stream mode configured: ODR=%d Hz, watermark=%d samples, motion threshold=%d mg",
+            FIFO_ODR_HZ, FIFO_WATERMARK, FIFO_MOTION_THRESHOLD_MG);
+    return 0;
 }
 
-/* Motion timer callback - starts work queue after 1 second delay */
-static void motion_timer_callback(struct k_timer *timer)
+static void fifo_submit(void)
 {
-    k_work_submit(&motion_work);
+    juxta_wmon_submitted(JUXTA_WMON_ACCEL_FIFO);
+    k_work_submit(&fifo_work);
+}
+
+/* Drain the FIFO in one burst read and feed the activity metrics */
+static void fifo_drain(void)
+{
+    /* FIFO_SRC and the data burst run back to back in one bus hold */
+    juxta_wmon_block_begin("accel bus acquire");
+    juxta_spi_bus_acquire(&accel_bus);
+    juxta_wmon_block_end();
+
+    uint8_t fifo_src;
+    int ret = lis2dh12_platform_read(NULL, 0x2F, &fifo_src, 1); // FIFO_SRC_REG
+    if (ret < 0)
+    {
+        juxta_spi_bus_release(&accel_bus);
+        LOG_ERR("Failed to read FIFO_SRC: %d", ret);
+        return;
+    }
+
+    /* FSS counts unread samples; OVRN means all 32 are full and older ones were lost */
+    uint8_t count = (fifo_src & 0x40) ? FIFO_DEPTH : (fifo_src & 0x1F);
+    if (fifo_src & 0x40)
+    {
+        fifo_overruns++;
+    }
+    if (count == 0)
+    {
+        juxta_spi_bus_release(&accel_bus);
+        return;
+    }
+
+    /* OUT_X_L..OUT_Z_H roll over to the next FIFO slot with auto-increment */
+    ret = lis2dh12_platform_read(NULL, 0x28, fifo_buf, count * 6);
+    juxta_spi_bus_release(&accel_bus);
+    if (ret < 0)
+    {
+        LOG_ERR("Failed to read FIFO (%u samples): %d", count, ret);
+        return;
+    }
+    fifo_reads++;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        const uint8_t *p = &fifo_buf[i * 6];
+        int16_t x = (int16_t)((p[1] << 8) | p[0]) >> 6;
+        int16_t y = (int16_t)((p[3] << 8) | p[2]) >> 6;
+        int16_t z = (int16_t)((p[5] << 8) | p[4]) >> 6;
+
+        if (juxta_activity_add(&activity, x * FIFO_MG_PER_LSB, y * FIFO_MG_PER_LSB, z * FIFO_MG_PER_LSB))
+        {
+            motion_count++;
+            motion_based_intervals = false;
+        }
+    }
+
+    /* INT1 is edge-triggered here: if another watermark filled meanwhile the
+     * line never dropped, so drain again now */
+    ret = lis2dh12_platform_read(NULL, 0x2F, &fifo_src, 1);
+    if (ret == 0 && (fifo_src & 0x80))
+    {
+        fifo_submit();
+    }
+}
+
+static void fifo_work_handler(struct k_work *work)
+{
+    ARG_UNUSED(work);
+
+    juxta_wmon_begin(JUXTA_WMON_ACCEL_FIFO);
+    fifo_drain();
+    juxta_wmon_end(JUXTA_WMON_ACCEL_FIFO);
+}
+
+void lis2dh12_take_activity(struct juxta_activity_minute *out)
+{
+    juxta_activity_take(&activity, out);
+    LOG_DBG("LIS2DH activity: samples=%u odba=%u vedba=%u sd=%u mg, fifo reads=%u overruns=%u",
+            out->samples, out->odba_mg, out->vedba_mg, out->sd_mg, fifo_reads, fifo_overruns);
+}
+#endif /* CONFIG_JUXTA_BLE_ACCEL_FIFO */
+
+/* Motion work handler - clears the latched INT1 one second after the first event */
+static void motion_work_handler(struct k_work *work)
+{
+    lis2dh12_clear_int1_interrupt(&motion_dev);
+
+#if !defined(LIS2DH_HW_ACTIVITY)
+    // Reset to default intervals when motion is detected
+    motion_based_intervals = false;
+#endif
+    LOG_DBG("🏃 Motion interrupt cleared (count: %d)", motion_count);
 }
 
 /* GPIO interrupt callback for LIS2DH motion detection */
 static void lis2dh_int_callback(const struct device *dev, struct gpio_callback *cb, uint32_t pins)
 {
+#if IS_ENABLED(CONFIG_JUXTA_BLE_ACCEL_FIFO)
+    /* Watermark reached: one wakeup per FIFO fill, motion is counted from the samples */
+    fifo_submit();
+    return;
+#endif
+    /* INT1 is latched and cannot fire again until the work clears it,
+     * which limits counting (and MCU wakeups) to one event per second */
     motion_count++;
-    lis2dh_interrupt_pending = true;
-    printk("🏃 Motion detected via GPIO! Count: %d\n", motion_count);
-
-    // Start 1-second timer to process interrupt (self-limiting to 60 events/minute)
-    k_timer_start(&motion_timer, K_SECONDS(1), K_NO_WAIT);
+    k_work_schedule(&motion_work, K_SECONDS(1));
 }
 
 int lis2dh12_init_motion_system(void)
@@ -735,8 +923,14 @@ int lis2dh12_init_motion_system(void)
         return ret;
     }
 
+#if IS_ENABLED(CONFIG_JUXTA_BLE_ACCEL_FIFO)
+    juxta_activity_init(&activity, FIFO_ODR_HZ, FIFO_MOTION_THRESHOLD_MG);
+    k_work_init(&fifo_work, fifo_work_handler);
+    ret = lis2dh12_configure_fifo_stream(&motion_dev);
+#else
     // Configure motion detection with high-pass filter for mouse collar sensitivity (0.01g = ~10 in LIS2DH units)
     ret = lis2dh12_configure_motion_detection(&motion_dev, 10, 0);
+#endif
     if (ret < 0)
     {
         LOG_ERR("Failed to configure LIS2DH motion detection: %d", ret);
@@ -772,11 +966,30 @@ int lis2dh12_init_motion_system(void)
         return ret;
     }
 
-    // Initialize work and timer
-    k_work_init(&motion_work, motion_work_handler);
-    k_timer_init(&motion_timer, motion_timer_callback, NULL);
+    k_work_init_delayable(&motion_work, motion_work_handler);
+
+#if defined(LIS2DH_HW_ACTIVITY)
+    ret = lis2dh12_configure_sleep_to_wake();
+    if (ret < 0)
+    {
+        LOG_ERR("Failed to configure LIS2DH sleep-to-wake: %d", ret);
+        return ret;
+    }
+#endif
+
+    ret = lis2dh12_start_temperature_sampling();
+    if (ret < 0)
+    {
+        LOG_WRN("LIS2DH temperature sampling unavailable: %d", ret);
+    }
 
+#if IS_ENABLED(CONFIG_JUXTA_BLE_ACCEL_FIFO)
+    /* Drain anything that reached the watermark before the interrupt was armed */
+    fifo_submit();
+    LOG_INF("✅ LIS2DH FIFO capture configured (ODR=%dHz, watermark=%d)", FIFO_ODR_HZ, FIFO_WATERMARK);
+#else
     LOG_INF("✅ LIS2DH motion detection configured (ODR=100Hz, HP filtered, threshold=0.01g, duration=0)");
+#endif
 
     // Test GPIO interrupt setup
     int gpio_state = gpio_pin_get(motion_dev.int_gpio.port, motion_dev.int_gpio.pin);
@@ -787,6 +1000,16 @@ int lis2dh12_init_motion_system(void)
 
 void lis2dh12_process_motion_events(void)
 {
+#if defined(LIS2DH_HW_ACTIVITY)
+    /* Extended intervals follow the INT2 activity state; only the minute count restarts here */
+    if (motion_count > 0)
+    {
+        LOG_INF("Motion events in last minute: %d", motion_count);
+    }
+    LOG_DBG("LIS2DH activity state: %s, inactive transitions=%u",
+            motion_based_intervals ? "inactive" : "active", inactive_transitions);
+    motion_count = 0;
+#else
     // This function is called from main.c minute processing
     // Handle motion count reporting and interval adjustment
     if (motion_count > 0)
@@ -801,6 +1024,7 @@ void lis2dh12_process_motion_events(void)
         motion_based_intervals = true;
         LOG_INF("No motion detected in last minute - switching to extended intervals (2x)");
     }
+#endif
 }
 
 bool lis2dh12_should_use_extended_intervals(void)
@@ -46,9 +46,22 @@ bool lis2dh12_should_use_extended_intervals(void);
 uint8_t lis2dh12_get_motion_count(void);
 void lis2dh12_reset_motion_count(void);
 
-/* Temperature reading function for motion system */
+/* Cached, filtered temperature from the background sampler (non-blocking) */
 int lis2dh12_get_temperature(int8_t *temperature);
 
+/* Log shared SPI bus statistics for the accelerometer client */
+void lis2dh12_log_bus_stats(void);
+
+/* Total time the accelerometer has held the SPI bus (wraps; diff successive reads) */
+uint32_t lis2dh12_bus_hold_us(void);
+
+#if IS_ENABLED(CONFIG_JUXTA_BLE_ACCEL_FIFO)
+struct juxta_activity_minute;
+
+/* Per-minute activity metrics from the FIFO stream; restarts the minute */
+void lis2dh12_take_activity(struct juxta_activity_minute *out);
+#endif
+
 /* Platform functions for direct register access */
 int32_t lis2dh12_platform_read(void *handle, uint8_t reg, uint8_t *data, uint16_t len);
 int32_t lis2dh12_platform_write(void *handle, uint8_t reg, const uint8_t *data, uint16_t len);
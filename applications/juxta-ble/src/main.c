@@ -24,6 +24,7 @@
 #include "juxta_vitals_nrf52/vitals.h"
 #include "juxta_framfs/framfs.h"
 #include "juxta_fram/fram.h"
+#include "juxta_spi_bus/spi_bus.h"
 #include "ble_service.h"
 #include "adc.h"
 #include <zephyr/drivers/adc.h>
@@ -38,7 +39,7 @@
 #include <nrfx_saadc.h>
 #include <hal/nrf_saadc.h>
 #endif
-#if IS_ENABLED(CONFIG_NRFX_TIMER1) || IS_ENABLED(CONFIG_NRFX_TIMER2)
+#if IS_ENABLED(CONFIG_NRFX_TIMER1) || IS_ENABLED(CONFIG_NRFX_TIMER2) || IS_ENABLED(CONFIG_NRFX_TIMER3)
 #include <nrfx_timer.h>
 #endif
 #if IS_ENABLED(CONFIG_NRFX_PPI)
@@ -47,14 +48,27 @@
 #include <stdio.h>
 #include <time.h>
 #include "lis2dh12.h"
-
-/* Forward declare ring-buffer feeder for early users */
-static void adc_ring_add_samples(const int16_t *samples, uint32_t count);
+#include "adc_pipeline.h"
+#include "sched_dispatch.h"
+#include "sync_slots.h"
+#include "duty_cycle.h"
+#include "peer_sync.h"
+#include "rssi_series.h"
+#include "activity.h"
+#include "energy.h"
+#include "work_monitor.h"
+#include "scratch.h"
+#include "juxta_prof/prof.h"
+
+/* Forward declare block timestamp source for early users */
+static uint32_t adc_timestamp_last_end_us(void);
 
 LOG_MODULE_REGISTER(main, LOG_LEVEL_INF);
 
-/* Forward declaration to avoid implicit calls before static definition */
-static void adc_ring_add_samples(const int16_t *samples, uint32_t count);
+JUXTA_PROF_DEFINE(scan_cb);
+JUXTA_PROF_DEFINE(scan_process);
+JUXTA_PROF_DEFINE(adc_block);
+JUXTA_PROF_DEFINE(minute_write);
 
 typedef enum
 {
@@ -67,9 +81,42 @@ typedef enum
 
 static ble_state_t ble_state = BLE_STATE_IDLE;
 
-// Add gateway advertising flag and timer
+static enum juxta_energy_source ble_state_energy_source(ble_state_t state)
+{
+    switch (state)
+    {
+    case BLE_STATE_ADVERTISING:
+    case BLE_STATE_GATEWAY_ADVERTISING:
+        return JUXTA_ENERGY_ADV;
+    case BLE_STATE_SCANNING:
+        return JUXTA_ENERGY_SCAN;
+    default:
+        return JUXTA_ENERGY_SOURCE_COUNT;
+    }
+}
+
+/* All burst state changes go through here so the radio time is accounted */
+static void ble_set_state(ble_state_t state)
+{
+    enum juxta_energy_source from = ble_state_energy_source(ble_state);
+    enum juxta_energy_source to = ble_state_energy_source(state);
+
+    if (from != to)
+    {
+        if (from != JUXTA_ENERGY_SOURCE_COUNT)
+        {
+            juxta_energy_exit(from);
+        }
+        if (to != JUXTA_ENERGY_SOURCE_COUNT)
+        {
+            juxta_energy_enter(to);
+        }
+    }
+    ble_state = state;
+}
+
+// Add gateway advertising flag
 static bool doGatewayAdvertise = false;
-static struct k_timer ten_minute_timer;
 static bool ble_connected = false; // Track connection state
 
 // Production flow tracking
@@ -83,8 +130,7 @@ static struct k_work datetime_sync_restart_work;
 // Track whether connectable advertising is currently active
 static bool connectable_adv_active = false;
 
-// LED feedback timer for connectable advertising
-static struct k_timer connectable_adv_led_timer;
+// LED feedback for connectable advertising (JUXTA_SCHED_LED_BLINK)
 static bool led_blink_state = false;
 
 // Hardware state
@@ -181,11 +227,21 @@ static void test_fram_functionality(void)
 static struct juxta_vitals_ctx vitals_ctx;
 static struct juxta_framfs_context framfs_ctx;
 static struct juxta_framfs_ctx time_ctx; /* Time-aware file system context */
+/* Serializes FRAMFS appends from the minute writer, ADC thread and work queue */
+static K_MUTEX_DEFINE(framfs_write_lock);
 
 // Unused burst tracking variables removed - state machine handles this
 static uint32_t last_adv_timestamp = 0;
 static uint32_t last_scan_timestamp = 0;
 
+/* Synchronized discovery state (CONFIG_JUXTA_BLE_SYNC_SLOTS) */
+static uint32_t sync_device_id = 0;      /* Picks our slot order per window */
+static bool gateway_time_synced = false; /* Clock set by a gateway, not the boot default */
+static uint32_t gateway_sync_uptime_ms = 0;
+static bool sync_slots_active = false;
+static uint32_t sync_adv_end_ms = 0;  /* Uptime end of the planned adv slot */
+static uint32_t sync_scan_end_ms = 0; /* Uptime end of the planned scan slot */
+
 /* Simple JUXTA device tracking for single scan burst */
 #define MAX_JUXTA_DEVICES 64
 static uint16_t last_logged_minute = 0xFFFF;
@@ -218,29 +274,122 @@ static void juxta_scan_table_print_and_clear(void)
     memset(juxta_scan_table, 0, sizeof(juxta_scan_table));
 }
 
-static struct k_work state_work;
-static struct k_timer state_timer;
+/* Unified event scheduler: one k_timer armed for the earliest required
+ * wakeup and one work item that runs the dispatch pass (sched_dispatch.c) */
+#define HEALTH_CHECK_INTERVAL_MS 30000
+#define LED_BLINK_INTERVAL_MS 500
+#define BATTERY_SAMPLE_INTERVAL_MS (CONFIG_JUXTA_VITALS_NRF52_BATTERY_UPDATE_INTERVAL * 1000)
+#define BATTERY_SAMPLE_RETRY_MS 500
+
+static const uint32_t sched_slack_ms[JUXTA_SCHED_EVENT_COUNT] = {
+    [JUXTA_SCHED_HEALTH_CHECK] = 5000, /* Diagnostics tolerate seconds of slip */
+    [JUXTA_SCHED_LED_BLINK] = 0,       /* Visible blink cadence */
+    [JUXTA_SCHED_MINUTE_LOG] = 500,
+    [JUXTA_SCHED_ADC_TRIGGER] = 50,
+    [JUXTA_SCHED_BURST_END] = 20,
+    [JUXTA_SCHED_SCAN_BURST] = 250, /* Burst starts already carry 0-1000 ms jitter */
+    [JUXTA_SCHED_ADV_BURST] = 250,
+    [JUXTA_SCHED_BATTERY_SAMPLE] = 5000,
+};
+
+static struct juxta_sched_dispatch sched_disp;
+static struct k_spinlock sched_lock;
+static struct k_timer sched_timer;
+static struct k_work sched_work;
 static bool state_system_ready = false;
 
 // Work queue health monitoring
-static struct k_work health_check_work;
-static struct k_timer health_check_timer;
 static uint32_t last_state_work_time = 0;
 static uint32_t last_adc_work_time = 0;
 static uint32_t state_work_count = 0;
 static uint32_t adc_work_count = 0;
 static uint32_t stuck_work_detections = 0;
 
-// ADC timer for mode 1 (ADC_ONLY mode)
-static struct k_timer adc_k_timer;
-static struct k_work adc_work;
+// ADC_ONLY mode capture service interval (JUXTA_SCHED_ADC_TRIGGER)
+static uint32_t adc_trigger_interval_ms = 5000;
+
+/* Port for the dispatch pass: uptime clock, spinlock and the one-shot k_timer */
+static uint32_t sched_port_now_ms(void)
+{
+    return k_uptime_get_32();
+}
+
+static uint32_t sched_port_lock(void)
+{
+    return (uint32_t)k_spin_lock(&sched_lock).key;
+}
+
+static void sched_port_unlock(uint32_t key)
+{
+    k_spin_unlock(&sched_lock, (k_spinlock_key_t){.key = (int)key});
+}
+
+static void sched_port_timer_start(uint32_t delay_ms)
+{
+    k_timer_start(&sched_timer, K_MSEC(delay_ms), K_NO_WAIT);
+}
+
+static void sched_port_timer_stop(void)
+{
+    k_timer_stop(&sched_timer);
+}
+
+static const struct juxta_sched_port sched_port = {
+    .now_ms = sched_port_now_ms,
+    .lock = sched_port_lock,
+    .unlock = sched_port_unlock,
+    .timer_start = sched_port_timer_start,
+    .timer_stop = sched_port_timer_stop,
+};
+
+static void sched_at(enum juxta_sched_event event, uint32_t deadline_ms)
+{
+    juxta_sched_dispatch_at(&sched_disp, event, deadline_ms);
+}
+
+static void sched_after(enum juxta_sched_event event, uint32_t delay_ms)
+{
+    sched_at(event, k_uptime_get_32() + delay_ms);
+}
+
+static void sched_cancel(enum juxta_sched_event event)
+{
+    juxta_sched_dispatch_cancel(&sched_disp, JUXTA_SCHED_EVENT_BIT(event));
+}
+
+static void sched_set_slack(enum juxta_sched_event event, uint32_t slack_ms)
+{
+    juxta_sched_dispatch_set_slack(&sched_disp, event, slack_ms);
+}
+
+static bool sched_pending(enum juxta_sched_event event, uint32_t *deadline_ms)
+{
+    return juxta_sched_dispatch_pending(&sched_disp, event, deadline_ms);
+}
+
+/* Stop the NORMAL-mode state machine (minute records and bursts) */
+static void sched_cancel_state_events(void)
+{
+    juxta_sched_dispatch_cancel(&sched_disp, JUXTA_SCHED_STATE_EVENTS);
+}
+
+/* Timer expiry of the current pass; state and ADC latency is measured from here */
+static uint32_t sched_fired_cyc;
+
+static void sched_timer_callback(struct k_timer *timer)
+{
+    // Only submit work, dispatch happens in thread context
+    sched_fired_cyc = k_cycle_get_32();
+    juxta_wmon_submitted(JUXTA_WMON_SCHED);
+    k_work_submit(&sched_work);
+}
 
 /* Phase B1: Threshold detection thread for peri-event capture */
 static struct k_thread adc_threshold_thread;
 static K_THREAD_STACK_DEFINE(adc_threshold_stack, 2048);
 static volatile bool adc_threshold_thread_active = false;
-/* removed: superseded by next_allowed_trigger_ms */
-static uint32_t next_allowed_trigger_ms = 0;             /* Absolute time gate for trigger */
+static bool adc_threshold_thread_exiting = false; /* Stopped but not yet joined */
+static struct adc_pipeline_detector adc_detector;        /* Debounce gate + search start */
 static uint32_t next_allowed_trigger_ms_last_logged = 0; /* For change detection */
 
 // Magnet reset state for ADC mode
@@ -256,24 +405,38 @@ static magnet_reset_state_t magnet_reset_state = MAGNET_RESET_STATE_NORMAL;
 static uint32_t magnet_reset_start_time = 0;
 static bool adc_operations_paused = false;
 
-/* Static buffers for ADC sampling to avoid sysworkq stack overflow */
-#define ADC_MAX_SAMPLES 500
-static uint8_t adc_scaled_buffer[ADC_MAX_SAMPLES];
+/* Interleaved SAADC scan: channels sampled back-to-back on every trigger */
+#define ADC_CHANNEL_COUNT ADC_PIPELINE_CHANNELS
+BUILD_ASSERT(ADC_CHANNEL_COUNT >= 1 && ADC_CHANNEL_COUNT <= JUXTA_FRAMFS_ADC_MAX_CHANNELS,
+             "Unsupported ADC channel count");
+BUILD_ASSERT(ADC_PIPELINE_EVENT_HEADER_SIZE == JUXTA_FRAMFS_ADC_HEADER_SIZE,
+             "ADC pipeline record layout out of sync with framfs");
+
+/* Event windows and their scaled copies are taken from the scratch arena */
+#define ADC_MAX_SAMPLES ADC_PIPELINE_WINDOW_MAX
 
 /* Phase A1: DMA Ring Buffer Configuration for peri-event capture */
-#define ADC_RING_BUFFER_SIZE 500 /* Ring buffer size (configurable sampling rate) */
-#define ADC_DMA_BLOCK_SIZE 100   /* DMA block size */
+#define ADC_RING_BUFFER_SIZE ADC_PIPELINE_RING_SIZE /* Ring buffer size (configurable sampling rate) */
+#define ADC_DMA_BLOCK_SIZE ADC_PIPELINE_BLOCK_SIZE  /* DMA block size */
 
 /* Buffer size validation limits */
-#define ADC_MIN_BUFFER_SIZE 100     /* Minimum: 1 DMA block */
-#define ADC_DEFAULT_BUFFER_SIZE 200 /* Recommended default */
-#define ADC_MAX_BUFFER_SIZE 500     /* Maximum: matches ring buffer size */
+#define ADC_MIN_BUFFER_SIZE ADC_PIPELINE_WINDOW_MIN         /* Minimum: 1 DMA block */
+#define ADC_DEFAULT_BUFFER_SIZE ADC_PIPELINE_WINDOW_DEFAULT /* Recommended default */
+#define ADC_MAX_BUFFER_SIZE ADC_PIPELINE_WINDOW_MAX         /* Maximum: half the ring */
+
+/* Ring buffer storage: per-channel rings plus per-block timestamps (see adc_pipeline.h) */
+static struct adc_pipeline_ring adc_ring;
 
-/* Ring buffer storage (Phase A1: just variables) */
-static int16_t adc_ring_buffer[ADC_RING_BUFFER_SIZE];
-static volatile uint32_t adc_ring_head = 0;  /* Write position (ISR updates) */
-static volatile uint32_t adc_ring_tail = 0;  /* Read position (thread updates) */
-static volatile uint32_t adc_ring_count = 0; /* Number of samples in buffer */
+/* Block timestamp timer: free-running 1 MHz TIMER3, CAPTURE0 latched by
+ * SAADC END through PPI. Runs only while ADC capture is active.
+ */
+#if IS_ENABLED(CONFIG_NRFX_TIMER3) && IS_ENABLED(CONFIG_NRFX_PPI)
+#define ADC_BLOCK_TIMESTAMPS_ENABLED 1
+static const nrfx_timer_t adc_ts_timer = NRFX_TIMER_INSTANCE(3);
+static nrf_ppi_channel_t adc_ppi_ts_ch; /* SAADC END -> TIMER3 CAPTURE0 */
+static bool adc_ts_initialized = false;
+#endif
+static bool adc_ts_active = false;
 
 /* DMA ping-pong buffers (Phase A1: ready for hardware implementation) */
 #pragma GCC diagnostic push
@@ -286,6 +449,36 @@ static volatile bool adc_dma_active = false;
 static bool vitals_batt_disabled_for_adc = false;
 #endif
 
+/* Capture channel map. SAADC channel 1 is reserved for the vitals VDD
+ * measurement, so capture channels use ids 0, 2, 3 and 4. Results are
+ * interleaved in ascending channel id order, which matches this table.
+ */
+struct adc_capture_channel
+{
+    uint8_t channel_id;
+    uint8_t input_positive;
+    uint8_t input_negative;
+    bool differential;
+    const char *label;
+};
+
+static const struct adc_capture_channel adc_capture_channels[JUXTA_FRAMFS_ADC_MAX_CHANNELS] = {
+    {0, SAADC_CH_PSELP_PSELP_AnalogInput1, SAADC_CH_PSELN_PSELN_AnalogInput0, true, "diff AIN1-AIN0"},
+    {2, SAADC_CH_PSELP_PSELP_AnalogInput3, SAADC_CH_PSELN_PSELN_AnalogInput2, true, "diff AIN3-AIN2"},
+    {3, SAADC_CH_PSELP_PSELP_AnalogInput4, SAADC_CH_PSELN_PSELN_NC, false, "AIN4 reference"},
+    {4, SAADC_CH_PSELP_PSELP_AnalogInput5, SAADC_CH_PSELN_PSELN_NC, false, "AIN5"},
+};
+
+static uint32_t adc_capture_channel_mask(void)
+{
+    uint32_t mask = 0;
+    for (uint32_t ch = 0; ch < ADC_CHANNEL_COUNT; ch++)
+    {
+        mask |= BIT(adc_capture_channels[ch].channel_id);
+    }
+    return mask;
+}
+
 #if IS_ENABLED(CONFIG_ADC)
 /* Zephyr ADC async capture thread (uses Zephyr SAADC driver) */
 static struct k_thread zephyr_adc_thread;
@@ -293,7 +486,6 @@ static K_THREAD_STACK_DEFINE(zephyr_adc_stack, 2048);
 static volatile bool zephyr_adc_thread_active = false;
 static const struct device *adc_dev_main = NULL;
 static bool zephyr_adc_configured = false;
-static void adc_ring_add_samples(const int16_t *samples, uint32_t count);
 static int zephyr_adc_configure_channel(void)
 {
     adc_dev_main = DEVICE_DT_GET(DT_NODELABEL(adc));
@@ -303,23 +495,29 @@ static int zephyr_adc_configure_channel(void)
         return -ENODEV;
     }
 
-    struct adc_channel_cfg cfg = {0};
-    cfg.gain = ADC_GAIN_1_6;
-    cfg.reference = ADC_REF_INTERNAL;
-    cfg.acquisition_time = ADC_ACQ_TIME(ADC_ACQ_TIME_MICROSECONDS, 3);
-    cfg.channel_id = 0;
-    cfg.differential = 1;
-    cfg.input_positive = SAADC_CH_PSELP_PSELP_AnalogInput1;
-    cfg.input_negative = SAADC_CH_PSELN_PSELN_AnalogInput0;
-
-    int ret = adc_channel_setup(adc_dev_main, &cfg);
-    if (ret)
+    for (uint32_t ch = 0; ch < ADC_CHANNEL_COUNT; ch++)
     {
-        LOG_ERR("📊 adc_channel_setup failed: %d", ret);
-        return ret;
+        const struct adc_capture_channel *cc = &adc_capture_channels[ch];
+        __ASSERT(cc->differential == ADC_PIPELINE_CHANNEL_IS_DIFFERENTIAL(ch),
+                 "Channel map out of sync with ADC_PIPELINE_DIFFERENTIAL_MASK");
+        struct adc_channel_cfg cfg = {0};
+        cfg.gain = ADC_GAIN_1_6;
+        cfg.reference = ADC_REF_INTERNAL;
+        cfg.acquisition_time = ADC_ACQ_TIME(ADC_ACQ_TIME_MICROSECONDS, 3);
+        cfg.channel_id = cc->channel_id;
+        cfg.differential = cc->differential;
+        cfg.input_positive = cc->input_positive;
+        cfg.input_negative = cc->input_negative;
+
+        int ret = adc_channel_setup(adc_dev_main, &cfg);
+        if (ret)
+        {
+            LOG_ERR("📊 adc_channel_setup(%u) failed: %d", cc->channel_id, ret);
+            return ret;
+        }
+        LOG_INF("📊 Zephyr ADC channel %u configured (%s)", cc->channel_id, cc->label);
     }
     zephyr_adc_configured = true;
-    LOG_INF("📊 Zephyr ADC channel configured (diff AIN1-AIN0)");
     return 0;
 }
 
@@ -328,8 +526,10 @@ static void zephyr_adc_thread_entry(void *p1, void *p2, void *p3)
     ARG_UNUSED(p1);
     ARG_UNUSED(p2);
     ARG_UNUSED(p3);
-    int16_t local_buf[ADC_DMA_BLOCK_SIZE];
-    int16_t mv_buf[ADC_DMA_BLOCK_SIZE];
+    /* Interleaved frames: [ch0, ch1, ...] per sampling */
+    /* Static: one block per buffer is 1600 B at four channels, too big for the 2 KB stack */
+    static int16_t local_buf[ADC_DMA_BLOCK_SIZE * ADC_CHANNEL_COUNT];
+    static int16_t mv_buf[ADC_DMA_BLOCK_SIZE * ADC_CHANNEL_COUNT];
 
     while (zephyr_adc_thread_active)
     {
@@ -343,7 +543,7 @@ static void zephyr_adc_thread_entry(void *p1, void *p2, void *p3)
         }
 
         struct adc_sequence seq = {0};
-        seq.channels = BIT(0);
+        seq.channels = adc_capture_channel_mask();
         seq.buffer = local_buf;
         seq.buffer_size = sizeof(local_buf);
         seq.resolution = 12;
@@ -368,19 +568,14 @@ static void zephyr_adc_thread_entry(void *p1, void *p2, void *p3)
             if (pret == 0 && sig.signaled)
             {
                 k_poll_signal_reset(&sig);
-                /* Convert raw SAADC counts to millivolts for thresholding and storage
-                 * SAADC: 12-bit, gain=1/6, Vref=0.6V → full-scale ≈ ±3.6V, LSB ≈ 3600/2048 mV
-                 */
-                for (uint32_t i = 0; i < ADC_DMA_BLOCK_SIZE; i++)
-                {
-                    int32_t mv = (int32_t)local_buf[i] * 3600 / 2048; /* differential signed */
-                    if (mv > 2000)
-                        mv = 2000; /* limit to expected app range */
-                    if (mv < -2000)
-                        mv = -2000;
-                    mv_buf[i] = (int16_t)mv;
-                }
-                adc_ring_add_samples(mv_buf, ADC_DMA_BLOCK_SIZE);
+                JUXTA_PROF_START(block_start);
+                /* Convert raw SAADC counts to millivolts for thresholding and storage */
+                adc_pipeline_raw_to_mv(local_buf, mv_buf, ADC_DMA_BLOCK_SIZE);
+                /* CAPTURE0 holds the END of the block's last sample; read it
+                 * before the next sequence is queued */
+                adc_pipeline_ring_add_block(&adc_ring, mv_buf, ADC_DMA_BLOCK_SIZE,
+                                            adc_timestamp_last_end_us(), adc_ts_active);
+                JUXTA_PROF_STOP(adc_block, block_start);
             }
             else
             {
@@ -401,8 +596,10 @@ static void zephyr_adc_thread_entry(void *p1, void *p2, void *p3)
 
 #if IS_ENABLED(CONFIG_NRFX_SAADC) && !IS_ENABLED(CONFIG_ADC)
 /* SAADC EasyDMA buffers (ping-pong) */
-static int16_t saadc_buf0[ADC_DMA_BLOCK_SIZE];
-static int16_t saadc_buf1[ADC_DMA_BLOCK_SIZE];
+static int16_t saadc_buf0[ADC_DMA_BLOCK_SIZE * ADC_CHANNEL_COUNT];
+static int16_t saadc_buf1[ADC_DMA_BLOCK_SIZE * ADC_CHANNEL_COUNT];
+/* Finished block converted to millivolts before it enters the ring */
+static int16_t saadc_mv_buf[ADC_DMA_BLOCK_SIZE * ADC_CHANNEL_COUNT];
 /* SAADC event handler */
 static void saadc_evt_handler(nrfx_saadc_evt_t const *p_event);
 #endif
@@ -421,9 +618,9 @@ static nrf_ppi_channel_t adc_ppi_start_on_end_ch; /* SAADC END -> SAADC START */
 #endif
 
 /* Forward declarations for ring buffer system */
-static void adc_ring_add_samples(const int16_t *samples, uint32_t count);
 static void adc_process_peri_event_data(const int16_t *raw_samples, uint32_t sample_count,
-                                        const struct juxta_framfs_adc_config *config);
+                                        const struct juxta_framfs_adc_config *config,
+                                        uint32_t trigger_pos);
 static void adc_stop_threshold_thread(void);
 
 /* Operating mode definitions */
@@ -437,52 +634,25 @@ static void adc_stop_threshold_thread(void);
 #define ADV_INTERVAL_SECONDS 5
 #define SCAN_INTERVAL_SECONDS 20
 
-/* Minute write safe zone configuration */
-#define MINUTE_WRITE_SAFE_ZONE_MS 3000 /* 3 seconds before/after minute boundary */
-#define MINUTE_WRITE_DURATION_MS 1000  /* 1 second for FRAM operations */
-#define MINUTE_WRITE_BUFFER_MS 1000    /* 1 second additional buffer */
-
-/* Minute write safe zone helper functions */
-static bool is_in_minute_write_safe_zone(uint32_t current_time)
-{
-    uint32_t seconds_in_minute = current_time % 60;
-    uint32_t safe_zone_start = 60 - (MINUTE_WRITE_SAFE_ZONE_MS / 1000);
-    uint32_t safe_zone_end = MINUTE_WRITE_SAFE_ZONE_MS / 1000;
-
-    return (seconds_in_minute >= safe_zone_start) || (seconds_in_minute <= safe_zone_end);
-}
-
-static bool is_approaching_minute_boundary(uint32_t current_time, uint32_t time_until_next_action)
-{
-    uint32_t seconds_in_minute = current_time % 60;
-    uint32_t time_to_boundary = 60 - seconds_in_minute;
-
-    // If next action would occur within the safe zone, defer it
-    return time_until_next_action >= time_to_boundary - (MINUTE_WRITE_SAFE_ZONE_MS / 1000);
-}
-
-static uint32_t calculate_time_to_exit_safe_zone(uint32_t current_time)
-{
-    uint32_t seconds_in_minute = current_time % 60;
-
-    if (seconds_in_minute >= (60 - (MINUTE_WRITE_SAFE_ZONE_MS / 1000)))
-    {
-        // We're in the end-of-minute safe zone
-        return (60 - seconds_in_minute) + (MINUTE_WRITE_SAFE_ZONE_MS / 1000);
-    }
-    else
-    {
-        // We're in the beginning-of-minute safe zone
-        return (MINUTE_WRITE_SAFE_ZONE_MS / 1000) - seconds_in_minute;
-    }
-}
-
 /* Global session-based variables (not persisted in FRAM) */
 static uint8_t current_mode = OPERATING_MODE_UNDEFINED; /* Must be set via BLE */
 static uint8_t session_adv_interval = ADV_INTERVAL_SECONDS;
 static uint8_t session_scan_interval = SCAN_INTERVAL_SECONDS;
 static bool session_inactivity_doubler_enabled = true; /* Enable motion-based interval doubling by default */
 
+/* Adaptive duty cycling (replaces the inactivity doubler while enabled) */
+#define ADV_BURST_RADIO_ON_MS 20                            /* ~13 adv events x 3 channels */
+#define SCAN_BURST_RADIO_ON_MS (SCAN_BURST_DURATION_MS / 4) /* 25% scan window duty */
+#define DUTY_DEFAULT_MAX_FACTOR 2                           /* Default slowest interval vs session interval */
+#define DUTY_HOLD_S 120                                     /* Quiet time before each step slower */
+#define DUTY_CHURN_DB 6                                     /* Mean RSSI change per peer that counts as activity */
+#define DUTY_MOTION_THRESHOLD 3                             /* Motion events per minute that count as activity */
+static bool session_adaptive_duty_enabled = IS_ENABLED(CONFIG_JUXTA_BLE_ADAPTIVE_DUTY);
+static uint8_t session_adv_interval_max = 0;  /* 0 = DUTY_DEFAULT_MAX_FACTOR x advInterval */
+static uint8_t session_scan_interval_max = 0; /* 0 = DUTY_DEFAULT_MAX_FACTOR x scanInterval */
+static uint16_t session_radio_budget_s = 0;   /* Radio on-time per hour, 0 = unlimited */
+static struct juxta_duty_ctrl duty_ctrl;
+
 static uint32_t session_adc_sampling_rate = 10000; /* ADC sampling rate in Hz (default 10kHz) */
 #define GATEWAY_ADV_TIMEOUT_SECONDS 30
 #define WDT_TIMEOUT_MS 30000
@@ -513,8 +683,8 @@ typedef struct
 
 K_MSGQ_DEFINE(scan_event_q, sizeof(scan_event_t), SCAN_EVENT_QUEUE_SIZE, 4);
 
-/* Scan callback for BLE scanning - runs in ISR context */
-__no_optimization static void scan_cb(const bt_addr_le_t *addr, int8_t rssi, uint8_t adv_type, struct net_buf_simple *ad)
+/* Scan report parsing - runs in ISR context */
+__no_optimization static void scan_report_handle(const bt_addr_le_t *addr, int8_t rssi, uint8_t adv_type, struct net_buf_simple *ad)
 {
     ARG_UNUSED(adv_type);
     if (!addr || !ad || ad->len == 0)
@@ -577,16 +747,29 @@ __no_optimization static void scan_cb(const bt_addr_le_t *addr, int8_t rssi, uin
             scan_event_t evt = {.mac_id = mac_id, .rssi = rssi};
             (void)k_msgq_put(&scan_event_q, &evt, K_NO_WAIT);
 
-            // Use printk for ISR context logging
-            char addr_str[BT_ADDR_LE_STR_LEN];
-            bt_addr_le_to_str(addr, addr_str, sizeof(addr_str));
-            printk("Found JUXTA device: %s (%s), RSSI: %d\n", mac_str, addr_str, rssi);
+            /* Per advertising report: compiled out below DEBUG */
+            LOG_DBG("Found JUXTA device: %s, RSSI: %d", mac_str, rssi);
         }
     }
 }
 
+/* Scan callback for BLE scanning */
+static void scan_cb(const bt_addr_le_t *addr, int8_t rssi, uint8_t adv_type, struct net_buf_simple *ad)
+{
+    juxta_wmon_begin(JUXTA_WMON_BT_RX);
+    JUXTA_PROF_START(start);
+    scan_report_handle(addr, rssi, adv_type, ad);
+    JUXTA_PROF_STOP(scan_cb, start);
+    juxta_wmon_end(JUXTA_WMON_BT_RX);
+}
+
 static uint32_t get_adv_interval(void)
 {
+    if (session_adaptive_duty_enabled)
+    {
+        return juxta_duty_adv_interval(&duty_ctrl);
+    }
+
     uint8_t adv_interval = session_adv_interval; /* Use session variable */
 
     /* Apply motion-based interval adjustment (only if enabled) */
@@ -596,22 +779,16 @@ static uint32_t get_adv_interval(void)
         LOG_DBG("📡 No motion detected, using extended adv_interval: %d", adv_interval);
     }
 
-    /* Apply minute safety adjustment */
-    uint32_t current_time = get_rtc_timestamp();
-    if (is_approaching_minute_boundary(current_time, adv_interval))
-    {
-        uint32_t seconds_in_minute = current_time % 60;
-        uint32_t time_to_boundary = 60 - seconds_in_minute;
-        uint32_t safe_interval = time_to_boundary + (MINUTE_WRITE_SAFE_ZONE_MS / 1000);
-        adv_interval = MAX(adv_interval, safe_interval);
-        LOG_INF("⏰ Adjusted adv_interval to %u for minute safety", adv_interval);
-    }
-
     return adv_interval;
 }
 
 static uint32_t get_scan_interval(void)
 {
+    if (session_adaptive_duty_enabled)
+    {
+        return juxta_duty_scan_interval(&duty_ctrl);
+    }
+
     uint8_t scan_interval = session_scan_interval; /* Use session variable */
 
     /* Apply motion-based interval adjustment (only if enabled) */
@@ -621,18 +798,62 @@ static uint32_t get_scan_interval(void)
         LOG_DBG("🔍 No motion detected, using extended scan_interval: %d", scan_interval);
     }
 
-    /* Apply minute safety adjustment */
-    uint32_t current_time = get_rtc_timestamp();
-    if (is_approaching_minute_boundary(current_time, scan_interval))
+    return scan_interval;
+}
+
+/* Push session intervals, bounds and budget into the duty controller */
+static void duty_configure(void)
+{
+    struct juxta_duty_cfg cfg = {
+        .adv_min_s = session_adv_interval,
+        .adv_max_s = session_adv_interval_max ? session_adv_interval_max
+                                              : session_adv_interval * DUTY_DEFAULT_MAX_FACTOR,
+        .scan_min_s = session_scan_interval,
+        .scan_max_s = session_scan_interval_max ? session_scan_interval_max
+                                                : session_scan_interval * DUTY_DEFAULT_MAX_FACTOR,
+        .budget_ms = session_radio_budget_s * 1000U,
+        .adv_on_ms = ADV_BURST_RADIO_ON_MS,
+        .scan_on_ms = SCAN_BURST_RADIO_ON_MS,
+        .hold_s = DUTY_HOLD_S,
+        .churn_db = DUTY_CHURN_DB,
+        .motion_threshold = DUTY_MOTION_THRESHOLD,
+    };
+    juxta_duty_set_cfg(&duty_ctrl, &cfg);
+}
+
+/* Feed the peers of the scan burst that just ended to the duty controller */
+static void duty_observe_scan(uint32_t current_time)
+{
+    static uint32_t ids[MAX_JUXTA_DEVICES];
+    static int8_t rssi[MAX_JUXTA_DEVICES];
+
+    for (uint8_t i = 0; i < juxta_scan_count; i++)
     {
-        uint32_t seconds_in_minute = current_time % 60;
-        uint32_t time_to_boundary = 60 - seconds_in_minute;
-        uint32_t safe_interval = time_to_boundary + (MINUTE_WRITE_SAFE_ZONE_MS / 1000);
-        scan_interval = MAX(scan_interval, safe_interval);
-        LOG_INF("⏰ Adjusted scan_interval to %u for minute safety", scan_interval);
+        ids[i] = juxta_scan_table[i].mac_id;
+        rssi[i] = juxta_scan_table[i].rssi;
     }
+    juxta_duty_observe_scan(&duty_ctrl, ids, rssi, juxta_scan_count, current_time);
 
-    return scan_interval;
+    if (session_adaptive_duty_enabled)
+    {
+        LOG_DBG("📶 Duty: level=%u adv=%u s scan=%u s, est. radio on-time %u ms/h",
+                duty_ctrl.level, juxta_duty_adv_interval(&duty_ctrl), juxta_duty_scan_interval(&duty_ctrl),
+                juxta_duty_on_time_per_hour(&duty_ctrl));
+    }
+}
+
+/**
+ * @brief Take the FRAMFS write lock for BLE service changes
+ * Called from the BT RX thread around format, clear and settings writes
+ */
+void juxta_ble_framfs_lock(void)
+{
+    k_mutex_lock(&framfs_write_lock, K_FOREVER);
+}
+
+void juxta_ble_framfs_unlock(void)
+{
+    k_mutex_unlock(&framfs_write_lock);
 }
 
 /**
@@ -676,7 +897,7 @@ void juxta_set_operating_mode(uint8_t mode)
     /* Stop LED feedback when mode is defined */
     if (old_mode == OPERATING_MODE_UNDEFINED && mode != OPERATING_MODE_UNDEFINED)
     {
-        k_timer_stop(&connectable_adv_led_timer);
+        sched_cancel(JUXTA_SCHED_LED_BLINK);
         led_blink_state = false;
         /* Access LED through device tree reference */
         const struct gpio_dt_spec led_spec = GPIO_DT_SPEC_GET(DT_PATH(leds, led_0), gpios);
@@ -707,6 +928,7 @@ void juxta_set_session_intervals(uint8_t adv_interval, uint8_t scan_interval)
 {
     session_adv_interval = adv_interval;
     session_scan_interval = scan_interval;
+    duty_configure();
     LOG_INF("🔧 Session intervals updated: adv=%d, scan=%d", adv_interval, scan_interval);
 }
 
@@ -729,6 +951,55 @@ void juxta_set_session_inactivity_doubler_enabled(bool enabled)
     LOG_INF("🔧 Session inactivity doubler %s", enabled ? "enabled" : "disabled");
 }
 
+/**
+ * @brief Get current adaptive duty cycling setting
+ * Called from BLE service to report current setting
+ */
+bool juxta_get_session_adaptive_duty_enabled(void)
+{
+    return session_adaptive_duty_enabled;
+}
+
+/**
+ * @brief Set current adaptive duty cycling setting
+ * Called from BLE service when setting is changed
+ */
+void juxta_set_session_adaptive_duty_enabled(bool enabled)
+{
+    session_adaptive_duty_enabled = enabled;
+    LOG_INF("🔧 Session adaptive duty cycling %s", enabled ? "enabled" : "disabled");
+}
+
+/**
+ * @brief Get current adaptive duty cycling bounds
+ * Called from BLE service to apply partial updates
+ */
+void juxta_get_session_duty_bounds(uint8_t *adv_interval_max, uint8_t *scan_interval_max,
+                                   uint16_t *radio_budget_s)
+{
+    if (adv_interval_max)
+        *adv_interval_max = session_adv_interval_max;
+    if (scan_interval_max)
+        *scan_interval_max = session_scan_interval_max;
+    if (radio_budget_s)
+        *radio_budget_s = session_radio_budget_s;
+}
+
+/**
+ * @brief Set current adaptive duty cycling bounds
+ * Called from BLE service when bounds are changed
+ */
+void juxta_set_session_duty_bounds(uint8_t adv_interval_max, uint8_t scan_interval_max,
+                                   uint16_t radio_budget_s)
+{
+    session_adv_interval_max = adv_interval_max;
+    session_scan_interval_max = scan_interval_max;
+    session_radio_budget_s = radio_budget_s;
+    duty_configure();
+    LOG_INF("🔧 Session duty bounds updated: adv_max=%d, scan_max=%d, budget=%u s/h",
+            adv_interval_max, scan_interval_max, radio_budget_s);
+}
+
 /**
  * @brief Get current ADC sampling rate from session configuration
  * @return Current sampling rate in Hz (default 10kHz)
@@ -738,6 +1009,32 @@ uint32_t juxta_get_adc_sampling_rate(void)
     return session_adc_sampling_rate;
 }
 
+/**
+ * @brief Sample period the capture path actually runs at
+ *
+ * The Zephyr driver paces extra_samplings with a k_timer, so the interval
+ * rounds up to whole system clock ticks: 10 kHz runs at ~122 us per sample
+ * with the 32768 Hz clock. TIMER1 on the nrfx path runs at the requested
+ * period.
+ *
+ * @return Period in microseconds, 0 if no rate is set
+ */
+static uint32_t adc_sample_period_us(void)
+{
+    uint32_t rate_hz = juxta_get_adc_sampling_rate();
+    if (rate_hz == 0)
+    {
+        return 0;
+    }
+
+    uint32_t interval_us = 1000000UL / rate_hz;
+#if IS_ENABLED(CONFIG_ADC)
+    return k_ticks_to_us_near32(k_us_to_ticks_ceil32(interval_us));
+#else
+    return interval_us;
+#endif
+}
+
 /**
  * @brief Set ADC sampling rate in session configuration
  * @param sampling_rate_hz Sampling rate in Hz (will be clamped to 10kHz-100kHz range)
@@ -792,9 +1089,9 @@ void juxta_ble_adc_config_update_trigger(void)
                 interval_seconds = 1; /* Minimum 1 second */
             }
 
-            /* Restart ADC timer with new interval */
-            k_timer_stop(&adc_k_timer);
-            k_timer_start(&adc_k_timer, K_SECONDS(interval_seconds), K_SECONDS(interval_seconds));
+            /* Reschedule ADC service with new interval */
+            adc_trigger_interval_ms = interval_seconds * 1000;
+            sched_after(JUXTA_SCHED_ADC_TRIGGER, adc_trigger_interval_ms);
             LOG_INF("📊 ADC timer updated: %u second intervals", interval_seconds);
         }
         else
@@ -811,6 +1108,9 @@ void juxta_ble_adc_config_update_trigger(void)
 static void init_randomization(void)
 {
     LOG_INF("🎲 Randomization enabled for state machine timing");
+#if IS_ENABLED(CONFIG_JUXTA_BLE_SYNC_SLOTS)
+    LOG_INF("🕒 Synchronized discovery slots enabled after gateway time sync");
+#endif
 }
 
 static uint32_t get_rtc_timestamp(void)
@@ -820,75 +1120,6 @@ static uint32_t get_rtc_timestamp(void)
     return timestamp;
 }
 
-/* Phase A2: Ring buffer management functions */
-static void adc_ring_add_samples(const int16_t *samples, uint32_t count)
-{
-    /* Add samples to ring buffer with overflow handling */
-    for (uint32_t i = 0; i < count; i++)
-    {
-        adc_ring_buffer[adc_ring_head] = samples[i];
-        adc_ring_head = (adc_ring_head + 1) % ADC_RING_BUFFER_SIZE;
-
-        if (adc_ring_count < ADC_RING_BUFFER_SIZE)
-        {
-            adc_ring_count++;
-        }
-        else
-        {
-            /* Buffer full - advance tail to drop oldest sample */
-            adc_ring_tail = (adc_ring_tail + 1) % ADC_RING_BUFFER_SIZE;
-        }
-    }
-}
-
-static uint32_t adc_ring_extract_centered(uint32_t trigger_pos, int16_t *output, uint32_t output_size)
-{
-    /* Extract samples centered around trigger position */
-    if (adc_ring_count < output_size)
-    {
-        LOG_DBG("📊 Not enough samples: have %u, need %u", adc_ring_count, output_size);
-        return 0; /* Not enough samples in buffer */
-    }
-
-    uint32_t half_samples = output_size / 2;
-    uint32_t start_pos = (trigger_pos + ADC_RING_BUFFER_SIZE - half_samples) % ADC_RING_BUFFER_SIZE;
-
-    LOG_DBG("📊 Extracting: trigger_pos=%u, start_pos=%u, samples=%u, ring_count=%u",
-            trigger_pos, start_pos, output_size, adc_ring_count);
-
-    for (uint32_t i = 0; i < output_size; i++)
-    {
-        uint32_t src_pos = (start_pos + i) % ADC_RING_BUFFER_SIZE;
-        output[i] = adc_ring_buffer[src_pos];
-
-        /* Debug: Check for suspicious values */
-        if (i < 10 && (output[i] == 127 || output[i] == 0))
-        {
-            LOG_DBG("📊 Sample[%u] from pos[%u]: %d (suspicious?)", i, src_pos, output[i]);
-        }
-    }
-
-    return output_size;
-}
-
-static uint32_t adc_ring_find_trigger(uint32_t start_offset, uint32_t search_count, int32_t threshold_mv)
-{
-    /* Search for threshold crossing in ring buffer */
-    for (uint32_t i = 0; i < search_count && i < adc_ring_count; i++)
-    {
-        uint32_t pos = (start_offset + i) % ADC_RING_BUFFER_SIZE;
-        int16_t sample = adc_ring_buffer[pos];
-
-        /* Convert to mV and check threshold */
-        int32_t voltage_mv = sample; /* Will need proper conversion */
-        if (abs(voltage_mv) > threshold_mv)
-        {
-            return pos; /* Return position of trigger */
-        }
-    }
-    return UINT32_MAX; /* No trigger found */
-}
-
 /* Phase A3: DMA callback implementation */
 /* Phase E1: Enhanced DMA callback implementation (ready for hardware DMA) */
 #pragma GCC diagnostic push
@@ -908,7 +1139,7 @@ static void adc_dma_callback(const struct device *dev, uint32_t channel, int sta
     int16_t *completed_buffer = (int16_t *)user_data;
 
     /* Add completed DMA block to ring buffer */
-    adc_ring_add_samples(completed_buffer, ADC_DMA_BLOCK_SIZE);
+    adc_pipeline_ring_add(&adc_ring, completed_buffer, ADC_DMA_BLOCK_SIZE);
 
     /* Optional: Log ring buffer status periodically for debugging */
     static uint32_t callback_count = 0;
@@ -916,7 +1147,7 @@ static void adc_dma_callback(const struct device *dev, uint32_t channel, int sta
     if (callback_count % 100 == 0) /* Log every 100 callbacks (~1 second at 10kSPS) */
     {
         LOG_DBG("📊 DMA callback #%u: ring buffer count=%u, head=%u",
-                callback_count, adc_ring_count, adc_ring_head);
+                callback_count, adc_ring.count, adc_ring.head);
     }
 
     /* Re-queue the same buffer for next DMA transfer */
@@ -924,6 +1155,86 @@ static void adc_dma_callback(const struct device *dev, uint32_t channel, int sta
 }
 #pragma GCC diagnostic pop
 
+/* Block timestamp timer: SAADC END -> PPI -> TIMER3 CAPTURE0 */
+static int adc_timestamp_start(void)
+{
+#ifdef ADC_BLOCK_TIMESTAMPS_ENABLED
+    if (!adc_ts_initialized)
+    {
+        nrfx_timer_config_t tcfg = NRFX_TIMER_DEFAULT_CONFIG(NRF_TIMER_FREQ_1MHz);
+        tcfg.bit_width = NRF_TIMER_BIT_WIDTH_32;
+        nrfx_err_t te = nrfx_timer_init(&adc_ts_timer, &tcfg, NULL);
+        if (te != NRFX_SUCCESS && te != NRFX_ERROR_ALREADY)
+        {
+            LOG_WRN("📊 Timestamp timer init failed (%d) - using processing time", te);
+            return -EIO;
+        }
+
+        nrfx_err_t pe = nrfx_ppi_channel_alloc(&adc_ppi_ts_ch);
+        if (pe != NRFX_SUCCESS)
+        {
+            LOG_WRN("📊 nrfx_ppi_channel_alloc(timestamp) failed: %d", pe);
+            return -EIO;
+        }
+        uint32_t eep = nrf_saadc_event_address_get(NRF_SAADC, NRF_SAADC_EVENT_END);
+        uint32_t tep = nrfx_timer_capture_task_address_get(&adc_ts_timer, NRF_TIMER_CC_CHANNEL0);
+        pe = nrfx_ppi_channel_assign(adc_ppi_ts_ch, eep, tep);
+        if (pe != NRFX_SUCCESS)
+        {
+            LOG_WRN("📊 nrfx_ppi_channel_assign(timestamp) failed: %d", pe);
+            return -EIO;
+        }
+        adc_ts_initialized = true;
+    }
+
+    nrfx_timer_clear(&adc_ts_timer);
+    nrfx_timer_enable(&adc_ts_timer);
+    (void)nrfx_ppi_channel_enable(adc_ppi_ts_ch);
+    adc_ts_active = true;
+    LOG_INF("📊 Block timestamps active (SAADC END -> TIMER3 CAPTURE0)");
+    return 0;
+#else
+    return -ENOTSUP;
+#endif
+}
+
+static void adc_timestamp_stop(void)
+{
+#ifdef ADC_BLOCK_TIMESTAMPS_ENABLED
+    if (adc_ts_active)
+    {
+        (void)nrfx_ppi_channel_disable(adc_ppi_ts_ch);
+        nrfx_timer_disable(&adc_ts_timer);
+    }
+#endif
+    adc_ts_active = false;
+    memset(adc_ring.block_time_valid, 0, sizeof(adc_ring.block_time_valid));
+}
+
+/* Timer value latched by the most recent SAADC END event */
+static uint32_t adc_timestamp_last_end_us(void)
+{
+#ifdef ADC_BLOCK_TIMESTAMPS_ENABLED
+    if (adc_ts_active)
+    {
+        return nrfx_timer_capture_get(&adc_ts_timer, NRF_TIMER_CC_CHANNEL0);
+    }
+#endif
+    return 0;
+}
+
+/* Current timestamp timer value (software capture on CC1) */
+static uint32_t adc_timestamp_now_us(void)
+{
+#ifdef ADC_BLOCK_TIMESTAMPS_ENABLED
+    if (adc_ts_active)
+    {
+        return nrfx_timer_capture(&adc_ts_timer, NRF_TIMER_CC_CHANNEL1);
+    }
+#endif
+    return 0;
+}
+
 /* Simplified DMA configuration using existing ADC setup */
 static int adc_configure_dma_sampling(void)
 {
@@ -956,22 +1267,37 @@ static int adc_configure_dma_sampling(void)
             return -EIO;
         }
 
-        /* Channel 0 differential AIN1/AIN0 */
-        nrfx_saadc_channel_t ch = NRFX_SAADC_DEFAULT_CHANNEL_DIFFERENTIAL(
-            NRF_SAADC_INPUT_AIN1, /* P0.03 */
-            NRF_SAADC_INPUT_AIN0, /* P0.02 */
-            0 /* channel index */);
-        /* Adjust defaults */
-        ch.channel_config.gain = NRF_SAADC_GAIN1_6;
-        ch.channel_config.reference = NRF_SAADC_REFERENCE_INTERNAL;
-        ch.channel_config.acq_time = NRF_SAADC_ACQTIME_10US;
+        /* Capture channels from the shared channel map (PSEL values match the HAL inputs) */
+        nrfx_saadc_channel_t channels[ADC_CHANNEL_COUNT];
+        for (uint32_t i = 0; i < ADC_CHANNEL_COUNT; i++)
+        {
+            const struct adc_capture_channel *cc = &adc_capture_channels[i];
+            if (cc->differential)
+            {
+                channels[i] = (nrfx_saadc_channel_t)NRFX_SAADC_DEFAULT_CHANNEL_DIFFERENTIAL(
+                    (nrf_saadc_input_t)cc->input_positive,
+                    (nrf_saadc_input_t)cc->input_negative,
+                    cc->channel_id);
+            }
+            else
+            {
+                channels[i] = (nrfx_saadc_channel_t)NRFX_SAADC_DEFAULT_CHANNEL_SE(
+                    (nrf_saadc_input_t)cc->input_positive,
+                    cc->channel_id);
+            }
+            /* Adjust defaults */
+            channels[i].channel_config.gain = NRF_SAADC_GAIN1_6;
+            channels[i].channel_config.reference = NRF_SAADC_REFERENCE_INTERNAL;
+            channels[i].channel_config.acq_time = NRF_SAADC_ACQTIME_10US;
+            LOG_INF("📊 adc_configure_dma_sampling: configuring SAADC channel %u (%s)",
+                    cc->channel_id, cc->label);
+        }
         /* Note: NCS v3.0.2 SAADC channel struct does not expose an event handler field */
 
-        LOG_INF("📊 adc_configure_dma_sampling: configuring SAADC channel 0 (diff AIN1-AIN0)");
-        nrfx_err_t ce = nrfx_saadc_channel_config(&ch);
+        nrfx_err_t ce = nrfx_saadc_channels_config(channels, ADC_CHANNEL_COUNT);
         if (ce != NRFX_SUCCESS)
         {
-            LOG_ERR("📊 nrfx_saadc_channel_config failed: %d", ce);
+            LOG_ERR("📊 nrfx_saadc_channels_config failed: %d", ce);
             return -EIO;
         }
 
@@ -1005,13 +1331,10 @@ static int adc_start_dma_sampling(void)
     LOG_INF("📊 adc_start_dma_sampling: adc_configure_dma_sampling ok");
 
     /* Reset and initialize ring buffer */
-    adc_ring_head = 0;
-    adc_ring_tail = 0;
-    adc_ring_count = 0;
-    for (int i = 0; i < ADC_RING_BUFFER_SIZE; i++)
-    {
-        adc_ring_buffer[i] = 0;
-    }
+    adc_pipeline_ring_reset(&adc_ring);
+
+    /* Optional: events fall back to processing-time stamps without it */
+    (void)adc_timestamp_start();
 
 #if IS_ENABLED(CONFIG_NRFX_SAADC) && !IS_ENABLED(CONFIG_ADC)
     LOG_INF("📊 adc_start_dma_sampling: Phase 2 wiring begin (TIMER1->PPI->SAADC)");
@@ -1036,7 +1359,7 @@ static int adc_start_dma_sampling(void)
     }
 
     /* Advanced mode: external SAMPLE via PPI */
-    uint32_t ch_mask = BIT(0);
+    uint32_t ch_mask = adc_capture_channel_mask();
     nrfx_saadc_adv_config_t adv_cfg = NRFX_SAADC_DEFAULT_ADV_CONFIG;
 
     /* Get current sampling rate from configuration */
@@ -1055,7 +1378,7 @@ static int adc_start_dma_sampling(void)
     }
 
     /* Queue first buffer; second will be supplied on BUF_REQ */
-    nrfx_err_t be = nrfx_saadc_buffer_set(saadc_buf0, ADC_DMA_BLOCK_SIZE);
+    nrfx_err_t be = nrfx_saadc_buffer_set(saadc_buf0, ADC_DMA_BLOCK_SIZE * ADC_CHANNEL_COUNT);
     if (be != NRFX_SUCCESS)
     {
         LOG_ERR("📊 nrfx_saadc_buffer_set buf0 failed: %d", be);
@@ -1123,6 +1446,7 @@ static int adc_start_dma_sampling(void)
 #endif
 
     adc_dma_active = true;
+    juxta_energy_enter(JUXTA_ENERGY_SAADC);
     LOG_INF("📊 adc_start_dma_sampling: done (adc_dma_active=%d)", adc_dma_active);
     return 0;
 }
@@ -1148,6 +1472,7 @@ static int adc_stop_dma_sampling(void)
 #endif
 
     adc_dma_active = false;
+    juxta_energy_exit(JUXTA_ENERGY_SAADC);
 #if IS_ENABLED(CONFIG_ADC)
     if (zephyr_adc_thread_active)
     {
@@ -1162,6 +1487,7 @@ static int adc_stop_dma_sampling(void)
         LOG_INF("📊 Resumed vitals battery monitoring after ADC capture");
     }
 #endif
+    adc_timestamp_stop();
     LOG_INF("📊 Ring buffer system stopped");
     return 0;
 }
@@ -1181,7 +1507,7 @@ static void saadc_evt_handler(nrfx_saadc_evt_t const *p_event)
     {
         /* Supply the next buffer for continuous conversion */
         nrf_saadc_value_t *next = next_buf_is_0 ? saadc_buf0 : saadc_buf1;
-        nrfx_err_t r = nrfx_saadc_buffer_set(next, ADC_DMA_BLOCK_SIZE);
+        nrfx_err_t r = nrfx_saadc_buffer_set(next, ADC_DMA_BLOCK_SIZE * ADC_CHANNEL_COUNT);
         if (r != NRFX_SUCCESS)
         {
             LOG_ERR("📊 nrfx_saadc_buffer_set(next) failed: %d", r);
@@ -1192,11 +1518,15 @@ static void saadc_evt_handler(nrfx_saadc_evt_t const *p_event)
     case NRFX_SAADC_EVT_DONE:
     {
         nrf_saadc_value_t *finished = p_event->data.done.p_buffer;
-        uint16_t num = p_event->data.done.size;
+        uint16_t num = p_event->data.done.size / ADC_CHANNEL_COUNT; /* Frames */
         if (finished && num > 0)
         {
-            adc_ring_add_samples((const int16_t *)finished, num);
-            LOG_INF("📊 SAADC DONE: +%u samples → ring_count=%u", num, adc_ring_count);
+            JUXTA_PROF_START(block_start);
+            adc_pipeline_raw_to_mv((const int16_t *)finished, saadc_mv_buf, num);
+            adc_pipeline_ring_add_block(&adc_ring, saadc_mv_buf, num,
+                                        adc_timestamp_last_end_us(), adc_ts_active);
+            JUXTA_PROF_STOP(adc_block, block_start);
+            LOG_DBG("📊 SAADC DONE: +%u samples → ring_count=%u", num, adc_ring.count);
         }
         break;
     }
@@ -1225,11 +1555,13 @@ static void adc_threshold_thread_entry(void *p1, void *p2, void *p3)
     static uint32_t thread_instance = 0;
     thread_instance++;
     LOG_DBG("Threshold detection thread started (instance %u)", thread_instance);
-    uint32_t scan_position = 0;
     uint32_t loop_count = 0;
+    uint32_t wake_due_cyc = k_cycle_get_32();
 
     while (adc_threshold_thread_active)
     {
+        /* Latency is oversleep past the 10 ms period */
+        juxta_wmon_begin_since(JUXTA_WMON_THRESHOLD, wake_due_cyc);
         loop_count++;
         if (loop_count % 100 == 1)
         { // Log every 100th iteration to avoid spam
@@ -1280,97 +1612,72 @@ static void adc_threshold_thread_entry(void *p1, void *p2, void *p3)
         }
 
         /* Check if enough samples available for processing */
-        /* Require at least one full window worth of samples in the ring */
         // Only log every 100th iteration to reduce spam
         if (loop_count % 100 == 1)
         {
-            LOG_DBG("Thread loop: ring_count=%u, window_samples=%u", adc_ring_count, window_samples);
+            LOG_DBG("Thread loop: ring_count=%u, window_samples=%u", adc_ring.count, window_samples);
         }
-        if (adc_ring_count >= window_samples)
+
+        /* Debounce gate, threshold search / timer trigger (see adc_pipeline_detect) */
+        uint32_t current_time = k_uptime_get_32();
+        uint32_t trigger_pos = ADC_PIPELINE_NO_TRIGGER;
+        bool threshold_mode = (adc_config.mode == JUXTA_FRAMFS_ADC_MODE_THRESHOLD_EVENT);
+        bool trigger_found = adc_pipeline_detect(&adc_detector, &adc_ring, threshold_mode,
+                                                 adc_config.threshold_mv, adc_config.debounce_ms,
+                                                 window_samples, current_time, &trigger_pos);
+
+        if (adc_detector.next_allowed_ms != next_allowed_trigger_ms_last_logged)
         {
-            /* Check debounce timer */
-            uint32_t current_time = k_uptime_get_32();
-            if (next_allowed_trigger_ms != next_allowed_trigger_ms_last_logged)
-            {
-                LOG_DBG("next_allowed_trigger_ms changed: %u -> %u", next_allowed_trigger_ms_last_logged, next_allowed_trigger_ms);
-                next_allowed_trigger_ms_last_logged = next_allowed_trigger_ms;
-            }
-            // Only log debounce check when it changes state or every 100th iteration
-            if (loop_count % 100 == 1 || current_time >= next_allowed_trigger_ms)
-            {
-                LOG_DBG("Debounce check: current=%u ms, next_allowed=%u ms, delta=%d ms",
-                        current_time, next_allowed_trigger_ms, (int32_t)(current_time - next_allowed_trigger_ms));
-            }
-            if (current_time >= next_allowed_trigger_ms)
-            {
-                LOG_DBG("DEBOUNCE EXPIRED - allowing trigger");
+            LOG_DBG("next_allowed_trigger_ms changed: %u -> %u (current=%u + debounce=%u)",
+                    next_allowed_trigger_ms_last_logged, adc_detector.next_allowed_ms,
+                    current_time, (unsigned)adc_config.debounce_ms);
+            next_allowed_trigger_ms_last_logged = adc_detector.next_allowed_ms;
+        }
 
-                /* Update debounce timer FIRST - this prevents rapid re-triggering */
-                next_allowed_trigger_ms = current_time + adc_config.debounce_ms;
-                LOG_DBG("Debounce timer updated: next_allowed=%u ms (current=%u + debounce=%u)",
-                        next_allowed_trigger_ms, current_time, (unsigned)adc_config.debounce_ms);
+        if (trigger_found)
+        {
+            /* Trigger found - extract and save data */
+            LOG_DBG("!! Peri-event trigger at position %u (%s mode)", trigger_pos,
+                    threshold_mode ? "threshold" : "timer");
 
-                /* Search for threshold crossing or timer trigger */
-                uint32_t trigger_pos = UINT32_MAX;
-                bool trigger_found = false;
+            if (threshold_mode)
+            {
+                /* Debug: Show some sample values to understand signal levels */
+                LOG_INF("📊 Sample values around trigger: [%d, %d, %d, %d, %d] mV",
+                        adc_ring.samples[0][trigger_pos % ADC_RING_BUFFER_SIZE],
+                        adc_ring.samples[0][(trigger_pos + 1) % ADC_RING_BUFFER_SIZE],
+                        adc_ring.samples[0][(trigger_pos + 2) % ADC_RING_BUFFER_SIZE],
+                        adc_ring.samples[0][(trigger_pos + 3) % ADC_RING_BUFFER_SIZE],
+                        adc_ring.samples[0][(trigger_pos + 4) % ADC_RING_BUFFER_SIZE]);
+            }
 
-                if (adc_config.mode == JUXTA_FRAMFS_ADC_MODE_THRESHOLD_EVENT)
-                {
-                    /* Threshold mode - search for crossing */
-                    LOG_DBG("Using threshold mode: searching for %u mV crossing", (unsigned)adc_config.threshold_mv);
-                    trigger_pos = adc_ring_find_trigger(scan_position, ADC_DMA_BLOCK_SIZE, adc_config.threshold_mv);
-                    trigger_found = (trigger_pos != UINT32_MAX);
-
-                    /* Debug: Show some sample values to understand signal levels */
-                    if (trigger_found && adc_ring_count > 0)
-                    {
-                        uint32_t debug_pos = adc_ring_head;
-                        LOG_INF("📊 Sample values around trigger: [%d, %d, %d, %d, %d] mV",
-                                adc_ring_buffer[debug_pos % ADC_RING_BUFFER_SIZE],
-                                adc_ring_buffer[(debug_pos + 1) % ADC_RING_BUFFER_SIZE],
-                                adc_ring_buffer[(debug_pos + 2) % ADC_RING_BUFFER_SIZE],
-                                adc_ring_buffer[(debug_pos + 3) % ADC_RING_BUFFER_SIZE],
-                                adc_ring_buffer[(debug_pos + 4) % ADC_RING_BUFFER_SIZE]);
-                    }
-                }
-                else
+            /* Extract centered data around trigger; the window lives on the
+             * scratch arena until the event is stored */
+            struct juxta_scratch_scope scratch;
+            if (juxta_scratch_begin(&scratch, K_FOREVER) == 0)
+            {
+                int16_t *extracted_samples = juxta_scratch_alloc(&scratch, ADC_CHANNEL_COUNT * window_samples *
+                                                                               sizeof(int16_t));
+                uint32_t extracted_count = 0;
+                if (extracted_samples)
                 {
-                    /* Timer mode (mode = 0) - always trigger, but still respect debounce */
-                    LOG_DBG("Using timer mode: mode=%d, always triggering (with debounce)", adc_config.mode);
-                    trigger_pos = adc_ring_head; /* Use current position */
-                    trigger_found = true;        /* Always trigger in timer mode */
+                    extracted_count = adc_pipeline_extract_centered(&adc_ring, trigger_pos,
+                                                                    extracted_samples, window_samples);
                 }
 
-                if (trigger_found)
-                {
-                    /* Trigger found - extract and save data */
-                    LOG_DBG("!! Peri-event trigger at position %u", trigger_pos);
-
-                    /* Extract centered data around trigger */
-                    static int16_t extracted_samples[ADC_MAX_SAMPLES];
-                    uint32_t extracted_count = adc_ring_extract_centered(trigger_pos, extracted_samples, window_samples);
-
-                    if (extracted_count > 0)
-                    {
-                        /* Phase C1: Process extracted peri-event data */
-                        adc_process_peri_event_data(extracted_samples, extracted_count, &adc_config);
-                    }
-                }
-            }
-            else
-            {
-                // Only log debounce active every 100th iteration to reduce spam
-                if (loop_count % 100 == 1)
+                if (extracted_count > 0)
                 {
-                    LOG_DBG("DEBOUNCE ACTIVE - blocking trigger (delta=%d ms)", (int32_t)(current_time - next_allowed_trigger_ms));
+                    /* Phase C1: Process extracted peri-event data */
+                    adc_process_peri_event_data(extracted_samples, extracted_count, &adc_config, trigger_pos);
                 }
+                juxta_scratch_end(&scratch);
             }
         }
 
-        /* Update scan position for next iteration */
-        scan_position = adc_ring_head;
+        juxta_wmon_end(JUXTA_WMON_THRESHOLD);
 
         /* Sleep to prevent excessive CPU usage */
+        wake_due_cyc = k_cycle_get_32() + k_ms_to_cyc_ceil32(10);
         k_sleep(K_MSEC(10)); /* Check every 10ms */
     }
 
@@ -1384,12 +1691,24 @@ static int adc_start_threshold_thread(void)
         return 0; /* Already running */
     }
 
+    /* The thread object is reused, so a previous instance must have exited */
+    if (adc_threshold_thread_exiting)
+    {
+        if (k_thread_join(&adc_threshold_thread, K_NO_WAIT) != 0)
+        {
+            LOG_DBG("Threshold thread still exiting, start deferred");
+            return -EBUSY;
+        }
+        adc_threshold_thread_exiting = false;
+    }
+
     adc_threshold_thread_active = true;
 
     k_thread_create(&adc_threshold_thread, adc_threshold_stack,
                     K_THREAD_STACK_SIZEOF(adc_threshold_stack),
                     adc_threshold_thread_entry, NULL, NULL, NULL,
                     K_PRIO_COOP(7), 0, K_NO_WAIT);
+    k_thread_name_set(&adc_threshold_thread, "adc_threshold");
 
     LOG_DBG("Threshold detection thread created");
     return 0;
@@ -1400,98 +1719,114 @@ static void adc_stop_threshold_thread(void)
     if (adc_threshold_thread_active)
     {
         adc_threshold_thread_active = false;
-        k_thread_abort(&adc_threshold_thread);
-        LOG_INF("📊 Threshold detection thread stopped");
+        /* Never abort it: mid-event that would leave the scratch arena or
+         * the FRAMFS lock held by a dead thread. If it is still busy, it
+         * exits at the end of its pass and the next start joins it. */
+        if (k_thread_join(&adc_threshold_thread, K_SECONDS(1)) != 0)
+        {
+            adc_threshold_thread_exiting = true;
+            LOG_WRN("📊 Threshold thread still busy after 1 s, left to exit on its own");
+        }
     }
 }
 
 /* Phase C1: Peri-event data processing function - simplified for now */
 static void adc_process_peri_event_data(const int16_t *raw_samples, uint32_t sample_count,
-                                        const struct juxta_framfs_adc_config *config)
+                                        const struct juxta_framfs_adc_config *config,
+                                        uint32_t trigger_pos)
 {
     if (!raw_samples || sample_count == 0 || !config)
     {
         return;
     }
 
-    /* Simple conversion: treat raw samples as already scaled for now */
-    uint8_t peak_positive = 0;
-    uint8_t peak_negative = 255;
+    if (sample_count > ADC_MAX_SAMPLES)
+    {
+        sample_count = ADC_MAX_SAMPLES;
+    }
 
-    /* Convert samples to scaled format and find peaks */
-    for (uint32_t i = 0; i < sample_count && i < ADC_MAX_SAMPLES; i++)
+    /* Scale mV samples to 8 bits and find per-channel peaks (channel-major);
+     * nests inside the caller's scratch scope */
+    struct juxta_scratch_scope scratch;
+    if (juxta_scratch_begin(&scratch, K_FOREVER) != 0)
+    {
+        return;
+    }
+    uint8_t *adc_scaled_buffer = juxta_scratch_alloc(&scratch, ADC_CHANNEL_COUNT * sample_count);
+    if (!adc_scaled_buffer)
     {
-        /* Proper scaling: raw_samples[i] contains mV values, not raw ADC */
-        /* Convert mV range (-2000 to +2000) to 0-255 */
-        int32_t voltage_mv = raw_samples[i];
-        int32_t scaled = (voltage_mv + 2000) * 255 / 4000;
-        if (scaled < 0)
-            scaled = 0;
-        if (scaled > 255)
-            scaled = 255;
-        adc_scaled_buffer[i] = (uint8_t)scaled;
+        juxta_scratch_end(&scratch);
+        return;
+    }
+    uint8_t peak_positive[ADC_CHANNEL_COUNT];
+    uint8_t peak_negative[ADC_CHANNEL_COUNT];
+    adc_pipeline_scale(raw_samples, sample_count, adc_scaled_buffer, peak_positive, peak_negative);
+
+    /* Get timing information */
+    uint32_t unix_timestamp, microsecond_offset;
+    juxta_vitals_get_unix_time(&vitals_ctx, &unix_timestamp, &microsecond_offset);
 
-        /* Debug: Log first few samples to check for mid-voltage issue */
-        if (i < 5)
+    /* Back-date to the trigger sample using its hardware block timestamp */
+    uint32_t trigger_time_us;
+    uint32_t period_us = adc_sample_period_us();
+    if (adc_pipeline_ring_sample_time(&adc_ring, trigger_pos, period_us, &trigger_time_us))
+    {
+        uint32_t age_us = adc_timestamp_now_us() - trigger_time_us;
+        uint64_t now_us = (uint64_t)unix_timestamp * 1000000ULL + microsecond_offset;
+        if (age_us <= now_us)
         {
-            LOG_DBG("📊 Sample[%u]: %d mV → scaled %u (0x%02X)",
-                    i, voltage_mv, (unsigned)scaled, (unsigned)adc_scaled_buffer[i]);
+            uint64_t trigger_unix_us = now_us - age_us;
+            unix_timestamp = (uint32_t)(trigger_unix_us / 1000000ULL);
+            microsecond_offset = (uint32_t)(trigger_unix_us % 1000000ULL);
         }
-
-        /* Track peaks */
-        if (adc_scaled_buffer[i] > peak_positive)
-            peak_positive = adc_scaled_buffer[i];
-        if (adc_scaled_buffer[i] < peak_negative)
-            peak_negative = adc_scaled_buffer[i];
+        LOG_DBG("📊 Trigger sample time: %u.%06u (age %u us)",
+                (unsigned)unix_timestamp, (unsigned)microsecond_offset, (unsigned)age_us);
     }
 
-    /* Get timing information */
-    uint32_t unix_timestamp = juxta_vitals_get_timestamp(&vitals_ctx);
-    uint32_t microsecond_offset = juxta_vitals_get_rel_microseconds_to_unix(&vitals_ctx);
-
-    /* Calculate duration for saved data; guard against zero rate */
-    uint32_t rate_hz = juxta_get_adc_sampling_rate();
-    if (rate_hz == 0)
-        rate_hz = 1; /* Guard against zero rate */
-    uint32_t duration_us = (sample_count > 0)
-                               ? (uint32_t)((uint64_t)sample_count * 1000000ULL / rate_hz)
-                               : 0u;
+    /* Duration of the saved window at the period the samples were taken at */
+    uint64_t window_us = (uint64_t)sample_count * period_us;
 
     /* Cap duration to prevent FRAMFS overflow (max 10 seconds) */
-    if (duration_us > 10000000)
+    uint32_t duration_us = (uint32_t)MIN(window_us, 10000000ULL);
+    if (window_us > 10000000ULL)
     {
-        duration_us = 10000000;
-        LOG_WRN("📊 Duration capped to 10 seconds for %u samples at %u Hz", sample_count, rate_hz);
+        LOG_WRN("📊 Duration capped to 10 seconds for %u samples at %u us", sample_count, period_us);
     }
 
     /* Store data based on output mode */
     int ret = 0;
+    juxta_wmon_block_begin("framfs lock");
+    k_mutex_lock(&framfs_write_lock, K_FOREVER);
+    juxta_wmon_block_end();
     if (config->output_peaks_only)
     {
         /* Min/Max mode - store peaks only */
-        ret = juxta_framfs_append_adc_event_data(&time_ctx, unix_timestamp, microsecond_offset,
-                                                 JUXTA_FRAMFS_ADC_EVENT_SINGLE_EVENT,
-                                                 NULL, 0, duration_us,
-                                                 peak_positive, peak_negative);
+        ret = juxta_framfs_append_adc_event_channels(&time_ctx, unix_timestamp, microsecond_offset,
+                                                     JUXTA_FRAMFS_ADC_EVENT_SINGLE_EVENT, ADC_CHANNEL_COUNT,
+                                                     NULL, 0, duration_us,
+                                                     peak_positive, peak_negative);
         if (ret == 0)
         {
-            LOG_INF("📊 Peri-event peaks saved: [%u, %u], threshold=%u mV (trigger centered)",
-                    peak_positive, peak_negative, (unsigned)config->threshold_mv);
+            LOG_INF("📊 Peri-event peaks saved: ch0 [%u, %u], channels=%u, threshold=%u mV (trigger centered)",
+                    peak_positive[0], peak_negative[0], ADC_CHANNEL_COUNT, (unsigned)config->threshold_mv);
         }
     }
     else
     {
         /* Full buffer mode - store complete waveform */
-        ret = juxta_framfs_append_adc_event_data(&time_ctx, unix_timestamp, microsecond_offset,
-                                                 JUXTA_FRAMFS_ADC_EVENT_PERI_EVENT,
-                                                 adc_scaled_buffer, (uint16_t)sample_count, duration_us,
-                                                 peak_positive, peak_negative);
+        ret = juxta_framfs_append_adc_event_channels(&time_ctx, unix_timestamp, microsecond_offset,
+                                                     JUXTA_FRAMFS_ADC_EVENT_PERI_EVENT, ADC_CHANNEL_COUNT,
+                                                     adc_scaled_buffer, (uint16_t)sample_count, duration_us,
+                                                     peak_positive, peak_negative);
         if (ret == 0)
         {
-            LOG_INF("*** FRAM WRITE SUCCESS *** Peri-event waveform saved: %u samples, peaks [%u, %u], threshold=%u mV",
-                    (unsigned)sample_count, peak_positive, peak_negative, (unsigned)config->threshold_mv);
+            LOG_INF("*** FRAM WRITE SUCCESS *** Peri-event waveform saved: %u samples x %u channels, ch0 peaks [%u, %u], threshold=%u mV",
+                    (unsigned)sample_count, ADC_CHANNEL_COUNT, peak_positive[0], peak_negative[0],
+                    (unsigned)config->threshold_mv);
         }
     }
+    k_mutex_unlock(&framfs_write_lock);
+    juxta_scratch_end(&scratch);
 
     if (ret < 0)
     {
@@ -1499,21 +1834,22 @@ static void adc_process_peri_event_data(const int16_t *raw_samples, uint32_t sam
     }
 }
 
-/* Battery check helper for FRAM operations */
+/* Battery check helper for FRAM operations (cached snapshot, no ADC access) */
 static bool should_allow_fram_write(void)
 {
-    uint16_t battery_mv = juxta_vitals_get_battery_mv(&vitals_ctx);
+    struct juxta_vitals_battery battery;
+    juxta_vitals_get_battery(&vitals_ctx, &battery);
 
     // Validate battery reading (should be 2000-4200 mV for Li-ion)
-    if (battery_mv < 1000 || battery_mv > 5000)
+    if (!battery.valid || battery.mv < 1000 || battery.mv > 5000)
     {
-        LOG_ERR("🚨 Invalid battery reading: %d mV - allowing FRAM write", battery_mv);
+        LOG_ERR("🚨 Invalid battery reading: %d mV - allowing FRAM write", battery.mv);
         return true; // Allow operations if battery reading is invalid
     }
 
-    if (juxta_vitals_is_low_battery(&vitals_ctx))
+    if (battery.low)
     {
-        LOG_WRN("⚠️ Battery critically low (%d mV) - preventing FRAM write", battery_mv);
+        LOG_WRN("⚠️ Battery critically low (%d mV) - preventing FRAM write", battery.mv);
         return false;
     }
     return true;
@@ -1522,27 +1858,55 @@ static bool should_allow_fram_write(void)
 /* Battery system health monitoring */
 static void check_battery_system_health(void)
 {
-    uint16_t battery_mv = juxta_vitals_get_battery_mv(&vitals_ctx);
-    if (battery_mv < 1000 || battery_mv > 5000)
+    struct juxta_vitals_battery battery;
+    juxta_vitals_get_battery(&vitals_ctx, &battery);
+    if (battery.valid && (battery.mv < 1000 || battery.mv > 5000))
     {
-        LOG_ERR("🚨 Battery system failure detected: %d mV", battery_mv);
+        LOG_ERR("🚨 Battery system failure detected: %d mV", battery.mv);
         juxta_log_simple(JUXTA_FRAMFS_RECORD_TYPE_ERROR);
     }
 }
 
-// Phase D1: New ring buffer-based ADC work handler
-static void adc_work_handler(struct k_work *work)
+/*
+ * Background battery sample (JUXTA_SCHED_BATTERY_SAMPLE). Sampling waits out
+ * advertising/scan bursts so the filter tracks the resting voltage rather
+ * than the sag under radio load; while ADC capture owns the SAADC, vitals
+ * skips the sample and readers keep the last snapshot.
+ */
+static void battery_sample_handler(uint32_t now_ms)
+{
+    if (ble_state == BLE_STATE_ADVERTISING || ble_state == BLE_STATE_SCANNING ||
+        ble_state == BLE_STATE_GATEWAY_ADVERTISING)
+    {
+        sched_at(JUXTA_SCHED_BATTERY_SAMPLE, now_ms + BATTERY_SAMPLE_RETRY_MS);
+        return;
+    }
+
+    sched_at(JUXTA_SCHED_BATTERY_SAMPLE, now_ms + BATTERY_SAMPLE_INTERVAL_MS);
+    juxta_energy_enter(JUXTA_ENERGY_SAADC);
+    juxta_wmon_block_begin("battery sample");
+    int ret = juxta_vitals_sample_battery(&vitals_ctx);
+    juxta_wmon_block_end();
+    juxta_energy_exit(JUXTA_ENERGY_SAADC);
+    if (ret != 0 && ret != JUXTA_VITALS_ERROR_NOT_READY)
+    {
+        LOG_WRN("🔋 Battery sample failed: %d", ret);
+    }
+}
+
+// Phase D1: Ring buffer-based ADC service (JUXTA_SCHED_ADC_TRIGGER)
+static void adc_trigger_handler(void)
 {
     uint32_t work_start_time = k_uptime_get_32();
     last_adc_work_time = work_start_time;
     adc_work_count++;
 
-    LOG_INF("📊 adc_work_handler: ENTRY - verified=%d, framfs=%d, ble=%d, dma_active=%d, ring_count=%u, count=%u",
-            hardware_verified, framfs_ctx.initialized, ble_connected, adc_dma_active, adc_ring_count, adc_work_count);
+    LOG_DBG("📊 adc_trigger_handler: ENTRY - verified=%d, framfs=%d, ble=%d, dma_active=%d, ring_count=%u, count=%u",
+            hardware_verified, framfs_ctx.initialized, ble_connected, adc_dma_active, adc_ring.count, adc_work_count);
 
     if (!framfs_ctx.initialized || ble_connected)
     {
-        LOG_DBG("ADC work handler: deferred (preconditions not met: framfs=%d, ble=%d)",
+        LOG_DBG("ADC trigger handler: deferred (preconditions not met: framfs=%d, ble=%d)",
                 framfs_ctx.initialized, ble_connected);
         return;
     }
@@ -1553,8 +1917,10 @@ static void adc_work_handler(struct k_work *work)
      */
     if (!adc_dma_active)
     {
-        LOG_INF("📊 adc_work_handler: starting DMA scaffolding");
+        LOG_INF("📊 adc_trigger_handler: starting DMA scaffolding");
+        juxta_wmon_block_begin("adc dma start");
         (void)adc_start_dma_sampling();
+        juxta_wmon_block_end();
 #if IS_ENABLED(CONFIG_ADC)
         /* Prevent SAADC contention: pause vitals battery ADC while capturing */
         if (!vitals_batt_disabled_for_adc)
@@ -1568,30 +1934,22 @@ static void adc_work_handler(struct k_work *work)
             zephyr_adc_thread_active = true;
             k_thread_create(&zephyr_adc_thread, zephyr_adc_stack, K_THREAD_STACK_SIZEOF(zephyr_adc_stack),
                             zephyr_adc_thread_entry, NULL, NULL, NULL, K_PRIO_COOP(7), 0, K_NO_WAIT);
+            k_thread_name_set(&zephyr_adc_thread, "adc_capture");
             LOG_INF("📊 Zephyr ADC capture thread started");
         }
 #endif
     }
 
     /* Start threshold thread only when we have at least one DMA block worth of samples */
-    if (!adc_threshold_thread_active && adc_ring_count >= ADC_DMA_BLOCK_SIZE)
+    if (!adc_threshold_thread_active && adc_ring.count >= ADC_DMA_BLOCK_SIZE)
     {
-        LOG_DBG("Starting threshold detection (ring has %u samples)", adc_ring_count);
+        LOG_DBG("Starting threshold detection (ring has %u samples)", adc_ring.count);
         (void)adc_start_threshold_thread();
     }
 
-    LOG_DBG("Ring buffer status: head=%u, count=%u", adc_ring_head, adc_ring_count);
-
-    LOG_INF("📊 adc_work_handler: EXIT");
-}
+    LOG_DBG("Ring buffer status: head=%u, count=%u", adc_ring.head, adc_ring.count);
 
-// ADC timer callback - triggers ADC work in thread context
-static void adc_timer_callback(struct k_timer *timer)
-{
-    // Only submit work, do not call FRAMFS functions in ISR context
-    LOG_INF("⏰ adc_timer_callback: ENTRY - submitting adc_work");
-    int ret = k_work_submit(&adc_work);
-    LOG_INF("⏰ adc_timer_callback: EXIT - work submission result: %d", ret);
+    LOG_DBG("📊 adc_trigger_handler: EXIT");
 }
 
 // Magnet reset functions for both operating modes
@@ -1612,7 +1970,13 @@ static void juxta_log_simple(uint8_t type)
     if (type == JUXTA_FRAMFS_RECORD_TYPE_ERROR || should_allow_fram_write())
     {
         uint16_t minute = juxta_vitals_get_minute_of_day(&vitals_ctx);
+        juxta_wmon_block_begin("framfs lock");
+        k_mutex_lock(&framfs_write_lock, K_FOREVER);
+        juxta_wmon_block_end();
+        juxta_wmon_block_begin("framfs simple record");
         (void)juxta_framfs_append_simple_record_data(&time_ctx, minute, type);
+        juxta_wmon_block_end();
+        k_mutex_unlock(&framfs_write_lock);
     }
 }
 
@@ -1635,12 +1999,14 @@ static void setup_dynamic_adv_name(void)
     {
         snprintf(adv_name, sizeof(adv_name), "JX_%02X%02X%02X",
                  addr.a.val[3], addr.a.val[2], addr.a.val[1]);
+        sync_device_id = ((uint32_t)addr.a.val[3] << 16) | ((uint32_t)addr.a.val[2] << 8) | addr.a.val[1];
         LOG_INF("📛 Set advertising name: %s", adv_name);
     }
     else
     {
         LOG_WRN("Failed to get BLE MAC address, using default");
         strcpy(adv_name, "JX_DEFAULT");
+        sync_device_id = sys_rand32_get();
     }
 
     // Set the device name in the Bluetooth stack
@@ -1670,442 +2036,683 @@ static void setup_dynamic_adv_name(void)
     }
 }
 
-static bool is_time_to_advertise(void)
+#if IS_ENABLED(CONFIG_JUXTA_BLE_RSSI_SERIES)
+/* Per-burst RSSI of this minute, encoded as each scan burst ends */
+static struct juxta_rssi_series rssi_series;
+BUILD_ASSERT(JUXTA_RSSI_SERIES_MAX_PEERS == JUXTA_FRAMFS_RSSI_SERIES_MAX_PEERS &&
+                 JUXTA_RSSI_SERIES_MAX_BURSTS == JUXTA_FRAMFS_RSSI_SERIES_MAX_BURSTS,
+             "RSSI series encoder and record format disagree");
+#endif
+
+static void scan_table_add(uint32_t mac_id, int8_t rssi)
 {
-    uint32_t current_time = get_rtc_timestamp();
-    if (current_time == 0)
-        return false;
-    return (current_time - last_adv_timestamp) >= get_adv_interval();
+    if (mac_id == 0)
+    {
+        LOG_WRN("⚠️ Ignoring scan event with MAC ID 0");
+        return;
+    }
+#if IS_ENABLED(CONFIG_JUXTA_BLE_RSSI_SERIES)
+    (void)juxta_rssi_series_observe(&rssi_series, mac_id, rssi);
+#endif
+    for (uint8_t i = 0; i < juxta_scan_count; i++)
+    {
+        if (juxta_scan_table[i].mac_id == mac_id)
+        {
+            // Update RSSI if this one is stronger (higher value)
+            if (rssi > juxta_scan_table[i].rssi)
+            {
+                LOG_DBG("🔍 Updated RSSI for MAC %06X: %d -> %d (stronger signal)",
+                        mac_id, juxta_scan_table[i].rssi, rssi);
+                juxta_scan_table[i].rssi = rssi;
+            }
+            return;
+        }
+    }
+    if (juxta_scan_count >= MAX_JUXTA_DEVICES)
+    {
+        LOG_ERR("⚠️ Scan table full (%u/%u), cannot add MAC %06X", juxta_scan_count, MAX_JUXTA_DEVICES, mac_id);
+        return;
+    }
+    juxta_scan_table[juxta_scan_count].mac_id = mac_id;
+    juxta_scan_table[juxta_scan_count].rssi = rssi;
+    LOG_INF("🔍 Added to scan table: MAC: %06X, RSSI: %d, count: %u", mac_id, rssi, juxta_scan_count + 1);
+    juxta_scan_count++;
 }
 
-static bool is_time_to_scan(void)
+static void process_scan_events(void)
 {
-    uint32_t current_time = get_rtc_timestamp();
-    if (current_time == 0)
-        return false;
-    return (current_time - last_scan_timestamp) >= get_scan_interval();
+    JUXTA_PROF_START(start);
+    scan_event_t evt;
+    while (k_msgq_get(&scan_event_q, &evt, K_NO_WAIT) == 0)
+    {
+        scan_table_add(evt.mac_id, evt.rssi);
+    }
+
+#if IS_ENABLED(CONFIG_JUXTA_BLE_PERIODIC_ADV)
+    /* Peers followed over periodic advertising count as seen without a scan */
+    uint32_t ids[CONFIG_BT_PER_ADV_SYNC_MAX];
+    int8_t rssi[CONFIG_BT_PER_ADV_SYNC_MAX];
+    uint8_t count = juxta_peer_sync_collect(ids, rssi, ARRAY_SIZE(ids));
+    for (uint8_t i = 0; i < count; i++)
+    {
+        scan_table_add(ids[i], rssi[i]);
+    }
+#endif
+    JUXTA_PROF_STOP(scan_process, start);
 }
 
-// Harden timer/event scheduling
-// Only post events to the workqueue from timer callbacks
-static enum {
-    EVENT_NONE = 0,
-    EVENT_TIMER_EXPIRED,
-} state_event;
+/* Minute records are snapshotted on the work queue and persisted by a
+ * low-priority writer thread, so the radio keeps running across the boundary */
+#define MINUTE_RECORD_QUEUE_DEPTH 4
+#if IS_ENABLED(CONFIG_JUXTA_BLE_RSSI_SERIES)
+#define MINUTE_WRITER_STACK_SIZE 2048 /* RSSI series record is assembled on the stack */
+#else
+#define MINUTE_WRITER_STACK_SIZE 1536
+#endif
+#define MINUTE_WRITER_PRIORITY K_LOWEST_APPLICATION_THREAD_PRIO
 
-static void state_timer_callback(struct k_timer *timer)
+struct minute_record_snapshot
 {
-    // Only post an event, do not call BLE APIs or change state here
-    LOG_INF("⏰ state_timer_callback: ENTRY - setting EVENT_TIMER_EXPIRED");
-    state_event = EVENT_TIMER_EXPIRED;
-    int ret = k_work_submit(&state_work);
-    LOG_INF("⏰ state_timer_callback: EXIT - work submission result: %d", ret);
-}
+    uint16_t minute;
+    uint8_t motion_count;
+    uint8_t battery_level;
+    int8_t temperature;
+    uint8_t device_count;
+    uint8_t mac_ids[MAX_JUXTA_DEVICES][3];
+    int8_t rssi_values[MAX_JUXTA_DEVICES];
+    uint32_t queued_cyc; /* Enqueue time, for the work monitor */
+#if IS_ENABLED(CONFIG_JUXTA_BLE_ACCEL_FIFO)
+    struct juxta_activity_minute activity;
+#endif
+#if IS_ENABLED(CONFIG_JUXTA_BLE_RSSI_SERIES)
+    uint8_t series_bursts;
+    uint8_t series_peers;
+    uint16_t series_len;
+    uint8_t series_mac_ids[JUXTA_RSSI_SERIES_MAX_PEERS][3];
+    uint8_t series[JUXTA_RSSI_SERIES_MAX_PEERS * JUXTA_RSSI_SERIES_PEER_MAX_BYTES];
+#endif
+};
 
-static void process_scan_events(void)
+K_MSGQ_DEFINE(minute_record_q, sizeof(struct minute_record_snapshot), MINUTE_RECORD_QUEUE_DEPTH, 4);
+static struct k_thread minute_writer_thread;
+static K_THREAD_STACK_DEFINE(minute_writer_stack, MINUTE_WRITER_STACK_SIZE);
+static uint32_t minute_records_dropped = 0;
+
+static void minute_writer_thread_entry(void *p1, void *p2, void *p3)
 {
-    scan_event_t evt;
-    while (k_msgq_get(&scan_event_q, &evt, K_NO_WAIT) == 0)
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+
+    /* Only this thread dequeues, so the receive buffer can be static */
+    static struct minute_record_snapshot rec;
+
+    for (;;)
     {
-        if (evt.mac_id == 0)
+        k_msgq_get(&minute_record_q, &rec, K_FOREVER);
+        juxta_wmon_begin_since(JUXTA_WMON_MINUTE_WRITER, rec.queued_cyc);
+
+        /* The gateway owns FRAMFS while connected; hold the record until it
+         * leaves. A connect can land between the check and the lock, so check
+         * again under the lock and keep holding the record if it did. */
+        for (;;)
         {
-            LOG_WRN("⚠️ Ignoring scan event with MAC ID 0");
-            continue;
+            juxta_wmon_block_begin("gateway connected");
+            while (ble_connected)
+            {
+                k_sleep(K_MSEC(500));
+            }
+            juxta_wmon_block_end();
+
+            juxta_wmon_block_begin("framfs lock");
+            k_mutex_lock(&framfs_write_lock, K_FOREVER);
+            juxta_wmon_block_end();
+            if (!ble_connected)
+            {
+                break;
+            }
+            k_mutex_unlock(&framfs_write_lock);
         }
-        if (juxta_scan_count >= MAX_JUXTA_DEVICES)
+        juxta_wmon_block_begin("framfs minute append");
+        uint32_t framfs_start = k_uptime_get_32();
+        JUXTA_PROF_START(write_start);
+        int ret = juxta_framfs_append_device_scan_data(&time_ctx, rec.minute, rec.motion_count,
+                                                       rec.battery_level, rec.temperature,
+                                                       rec.device_count ? rec.mac_ids : NULL,
+                                                       rec.device_count ? rec.rssi_values : NULL,
+                                                       rec.device_count);
+#if IS_ENABLED(CONFIG_JUXTA_BLE_ACCEL_FIFO)
+        if (ret == 0 && rec.activity.samples > 0)
         {
-            LOG_ERR("⚠️ Scan table full (%u/%u), cannot add MAC %06X", juxta_scan_count, MAX_JUXTA_DEVICES, evt.mac_id);
-            continue;
+            struct juxta_framfs_activity_record activity = {
+                .minute = rec.minute,
+                .samples = rec.activity.samples,
+                .odba_mg = rec.activity.odba_mg,
+                .vedba_mg = rec.activity.vedba_mg,
+                .sd_mg = rec.activity.sd_mg,
+                .posture = {rec.activity.posture[0], rec.activity.posture[1], rec.activity.posture[2]},
+            };
+            int activity_ret = juxta_framfs_append_activity_data(&time_ctx, &activity);
+            if (activity_ret < 0)
+            {
+                LOG_ERR("📊 Activity record %u failed: %d", rec.minute, activity_ret);
+            }
         }
-        bool found = false;
-        uint8_t found_index = 0;
-        for (uint8_t i = 0; i < juxta_scan_count; i++)
+#endif
+#if IS_ENABLED(CONFIG_JUXTA_BLE_RSSI_SERIES)
+        if (ret == 0 && rec.series_peers > 0)
         {
-            if (juxta_scan_table[i].mac_id == evt.mac_id)
+            int series_ret = juxta_framfs_append_rssi_series_data(&time_ctx, rec.minute, rec.series_bursts,
+                                                                  rec.series_mac_ids, rec.series_peers,
+                                                                  rec.series, rec.series_len);
+            if (series_ret < 0)
             {
-                found = true;
-                found_index = i;
-                break;
+                LOG_ERR("📊 RSSI series record %u failed: %d", rec.minute, series_ret);
             }
         }
-        if (!found)
+#endif
+        JUXTA_PROF_STOP(minute_write, write_start);
+        uint32_t framfs_duration = k_uptime_get_32() - framfs_start;
+        juxta_wmon_block_end();
+        k_mutex_unlock(&framfs_write_lock);
+
+        if (ret == 0)
         {
-            juxta_scan_table[juxta_scan_count].mac_id = evt.mac_id;
-            juxta_scan_table[juxta_scan_count].rssi = evt.rssi;
-            LOG_INF("🔍 Added to scan table: MAC: %06X, RSSI: %d, count: %u", evt.mac_id, evt.rssi, juxta_scan_count + 1);
-            juxta_scan_count++;
+            LOG_INF("📊 FRAM minute record %u completed in %u ms: devices=%d, motion=%d, battery=%d%%, temp=%d°C",
+                    rec.minute, framfs_duration, rec.device_count, rec.motion_count,
+                    rec.battery_level, rec.temperature);
         }
         else
         {
-            // Update RSSI if this one is stronger (higher value)
-            if (evt.rssi > juxta_scan_table[found_index].rssi)
-            {
-                LOG_DBG("🔍 Updated RSSI for MAC %06X: %d -> %d (stronger signal)",
-                        evt.mac_id, juxta_scan_table[found_index].rssi, evt.rssi);
-                juxta_scan_table[found_index].rssi = evt.rssi;
-            }
+            LOG_ERR("📊 FRAM minute record %u failed: %d (took %u ms)", rec.minute, ret, framfs_duration);
         }
+        juxta_wmon_end(JUXTA_WMON_MINUTE_WRITER);
     }
 }
 
-static void state_work_handler(struct k_work *work)
+static void minute_writer_start(void)
 {
-    uint32_t work_start_time = k_uptime_get_32();
-    last_state_work_time = work_start_time;
-    state_work_count++;
+    k_thread_create(&minute_writer_thread, minute_writer_stack,
+                    K_THREAD_STACK_SIZEOF(minute_writer_stack),
+                    minute_writer_thread_entry, NULL, NULL, NULL,
+                    MINUTE_WRITER_PRIORITY, 0, K_NO_WAIT);
+    k_thread_name_set(&minute_writer_thread, "minute_writer");
+}
+
+/* Next minute record at the next boundary. RTC seconds truncate, so the
+ * wakeup lands 0-1 s after the real boundary and never before it. */
+static void minute_log_schedule(uint32_t current_time)
+{
+    uint32_t seconds_to_boundary = 60 - (current_time % 60);
+    sched_after(JUXTA_SCHED_MINUTE_LOG, seconds_to_boundary * 1000);
+}
 
+#if IS_ENABLED(CONFIG_JUXTA_BLE_ENERGY)
+/*
+ * Close the energy minute. SPI and CPU time are not hooked per call: the
+ * bus manager and the scheduler already count them, so only the deltas
+ * since the previous minute are fed in.
+ */
+static void energy_minute_close(bool new_day)
+{
+    static uint32_t last_fram_hold_us;
+    static uint32_t last_accel_hold_us;
+    uint32_t fram_hold_us = fram_dev.bus.stats.hold_total_us;
+    uint32_t accel_hold_us = lis2dh12_bus_hold_us();
+
+    juxta_energy_add_us(JUXTA_ENERGY_FRAM, fram_hold_us - last_fram_hold_us);
+    juxta_energy_add_us(JUXTA_ENERGY_ACCEL, accel_hold_us - last_accel_hold_us);
+    last_fram_hold_us = fram_hold_us;
+    last_accel_hold_us = accel_hold_us;
+
+#if IS_ENABLED(CONFIG_SCHED_THREAD_USAGE_ALL)
+    static uint64_t last_busy_cycles;
+    k_thread_runtime_stats_t stats;
+
+    if (k_thread_runtime_stats_all_get(&stats) == 0)
+    {
+        juxta_energy_add_us(JUXTA_ENERGY_CPU,
+                            (uint32_t)k_cyc_to_us_floor64(stats.total_cycles - last_busy_cycles));
+        last_busy_cycles = stats.total_cycles;
+    }
+#endif
+
+    juxta_energy_minute_tick(new_day);
+}
+#endif
+
+/* Minute-of-day record (devices + motion + battery + temperature).
+ * tools/day_sim models this, the writer thread and the burst handlers by
+ * hand; keep it in step when they change. */
+static void minute_log_handler(void)
+{
     uint32_t current_time = get_rtc_timestamp();
     uint32_t seconds_in_minute = current_time % 60;
-    bool in_safe_zone = is_in_minute_write_safe_zone(current_time);
-
-    LOG_INF("🔄 state_work_handler: ENTRY - state_system_ready=%s, count=%u, time=%u, sec_in_min=%u, safe_zone=%s",
-            state_system_ready ? "true" : "false", state_work_count, current_time, seconds_in_minute,
-            in_safe_zone ? "true" : "false");
+    uint16_t current_minute = juxta_vitals_get_minute_of_day(&vitals_ctx);
 
-    if (!state_system_ready)
+    if (current_minute == last_logged_minute)
     {
-        LOG_WRN("⚠️ state_work_handler: State system not ready, exiting");
+        /* Woke before the RTC rolled over - try again at the next boundary */
+        minute_log_schedule(current_time);
         return;
     }
 
-    // Process all scan events from the queue
-    process_scan_events();
+    LOG_INF("📊 Minute boundary detected: %u -> %u (time=%u, sec_in_min=%u)",
+            last_logged_minute, current_minute, current_time, seconds_in_minute);
 
-    // Minute-of-day logging and scan table clearing
-    uint16_t current_minute = juxta_vitals_get_minute_of_day(&vitals_ctx);
-    if (current_minute != last_logged_minute)
+#if IS_ENABLED(CONFIG_JUXTA_BLE_ENERGY)
+    energy_minute_close(last_logged_minute != 0xFFFF && current_minute < last_logged_minute);
+#endif
+
+#if IS_ENABLED(CONFIG_JUXTA_BLE_ACCEL_FIFO)
+    /* Close the accelerometer minute even when no record is written */
+    struct juxta_activity_minute activity;
+    lis2dh12_take_activity(&activity);
+#endif
+
+    /* Snapshot the minute record (devices + motion + battery + temperature) for the writer */
+    if (framfs_ctx.initialized && !ble_connected && !should_allow_fram_write())
+    {
+        /* No record, but the minute still closes below so the next record
+         * does not carry this minute's scans and series */
+        LOG_INF("📊 Skipping FRAMFS minute logging due to low battery");
+    }
+    else if (framfs_ctx.initialized && !ble_connected)
     {
-        LOG_INF("📊 Minute boundary detected: %u -> %u (time=%u, sec_in_min=%u)",
-                last_logged_minute, current_minute, current_time, seconds_in_minute);
+        static struct minute_record_snapshot snap;
+        snap.minute = current_minute;
+        snap.motion_count = lis2dh12_get_motion_count();
+#if IS_ENABLED(CONFIG_JUXTA_BLE_ACCEL_FIFO)
+        snap.activity = activity;
+#endif
 
-        // Ensure we're NOT in a safe zone for FRAM operations
-        if (is_in_minute_write_safe_zone(current_time))
+        /* Get battery level from the background-sampled snapshot */
+        snap.battery_level = 0;
+        if (juxta_vitals_get_validated_battery_level(&vitals_ctx, &snap.battery_level) != 0)
         {
-            LOG_WRN("⚠️ Minute boundary detected in safe zone - deferring FRAM logging");
-            // Calculate time to exit safe zone and reschedule
-            uint32_t time_to_exit_safe_zone = calculate_time_to_exit_safe_zone(current_time);
-            if (time_to_exit_safe_zone == 0)
-            {
-                time_to_exit_safe_zone = 1; // Minimum 1 second delay
-            }
-            k_timer_start(&state_timer, K_SECONDS(time_to_exit_safe_zone), K_NO_WAIT);
-            LOG_INF("⏰ Deferring minute logging for %u seconds to exit safe zone", time_to_exit_safe_zone);
-            return;
+            snap.battery_level = 0; // Default if read fails
+            LOG_ERR("🚨 Battery level read failed during minute logging");
+            juxta_log_simple(JUXTA_FRAMFS_RECORD_TYPE_ERROR);
         }
 
-        /* Consolidated minute logging to FRAMFS (devices + motion + battery + temperature) */
-        if (framfs_ctx.initialized && !ble_connected)
+        /* Get temperature from LIS2DH */
+        snap.temperature = 0;
+        if (lis2dh12_get_temperature(&snap.temperature) != 0)
         {
-            /* Check battery before FRAM operations */
-            if (!should_allow_fram_write())
-            {
-                LOG_INF("📊 Skipping FRAMFS minute logging due to low battery");
-                return;
-            }
-
-            // Add a small delay to ensure we're past any BLE operations
-            k_sleep(K_MSEC(100));
+            LOG_WRN("📊 Failed to read LIS2DH temperature, using 0°C");
+            snap.temperature = 0; /* Default if read fails */
+        }
 
-            /* Get battery level */
-            uint8_t battery_level = 0;
-            (void)juxta_vitals_update(&vitals_ctx);
-            if (juxta_vitals_get_validated_battery_level(&vitals_ctx, &battery_level) != 0)
-            {
-                battery_level = 0; // Default if read fails
-                LOG_ERR("🚨 Battery level read failed during minute logging");
-                juxta_log_simple(JUXTA_FRAMFS_RECORD_TYPE_ERROR);
-            }
+        /* Convert scan table to FRAMFS packed format; zero devices becomes NO_ACTIVITY */
+        snap.device_count = MIN(juxta_scan_count, (uint8_t)MAX_JUXTA_DEVICES);
+        for (uint8_t i = 0; i < snap.device_count; i++)
+        {
+            snap.mac_ids[i][0] = (juxta_scan_table[i].mac_id >> 16) & 0xFF;
+            snap.mac_ids[i][1] = (juxta_scan_table[i].mac_id >> 8) & 0xFF;
+            snap.mac_ids[i][2] = juxta_scan_table[i].mac_id & 0xFF;
+            snap.rssi_values[i] = juxta_scan_table[i].rssi;
+        }
 
-            /* Get temperature from LIS2DH */
-            int8_t temperature = 0;
-            if (lis2dh12_get_temperature(&temperature) != 0)
-            {
-                LOG_WRN("📊 Failed to read LIS2DH temperature, using 0°C");
-                temperature = 0; /* Default if read fails */
-            }
+#if IS_ENABLED(CONFIG_JUXTA_BLE_RSSI_SERIES)
+        /* Already encoded burst by burst; only the open burst is left to close */
+        juxta_rssi_series_finish(&rssi_series);
+        int series_len = juxta_rssi_series_serialize(&rssi_series, snap.series_mac_ids,
+                                                     snap.series, sizeof(snap.series));
+        snap.series_bursts = rssi_series.burst_count;
+        snap.series_peers = (series_len > 0) ? rssi_series.peer_count : 0;
+        snap.series_len = (series_len > 0) ? (uint16_t)series_len : 0;
+#endif
 
-            if (juxta_scan_count > 0)
-            {
-                /* Convert scan table to FRAMFS packed format */
-                uint8_t mac_ids[MAX_JUXTA_DEVICES][3];
-                int8_t rssi_values[MAX_JUXTA_DEVICES];
-                uint8_t device_count = MIN(juxta_scan_count, (uint8_t)MAX_JUXTA_DEVICES);
-                for (uint8_t i = 0; i < device_count; i++)
-                {
-                    mac_ids[i][0] = (juxta_scan_table[i].mac_id >> 16) & 0xFF;
-                    mac_ids[i][1] = (juxta_scan_table[i].mac_id >> 8) & 0xFF;
-                    mac_ids[i][2] = juxta_scan_table[i].mac_id & 0xFF;
-                    rssi_values[i] = juxta_scan_table[i].rssi;
-                }
-                uint32_t framfs_start = k_uptime_get_32();
-                int ret = juxta_framfs_append_device_scan_data(&time_ctx, current_minute, lis2dh12_get_motion_count(),
-                                                               battery_level, temperature,
-                                                               mac_ids, rssi_values, device_count);
-                uint32_t framfs_duration = k_uptime_get_32() - framfs_start;
-                if (ret == 0)
-                {
-                    LOG_INF("📊 FRAM minute record completed in %u ms: devices=%d, motion=%d, battery=%d%%, temp=%d°C",
-                            framfs_duration, device_count, lis2dh12_get_motion_count(), battery_level, temperature);
-                }
-                else
-                {
-                    LOG_ERR("📊 FRAM minute record failed: %d (took %u ms)", ret, framfs_duration);
-                }
-            }
-            else
-            {
-                /* No devices found - use NO_ACTIVITY type but still include battery/temperature */
-                uint32_t framfs_start = k_uptime_get_32();
-                int ret = juxta_framfs_append_device_scan_data(&time_ctx, current_minute, lis2dh12_get_motion_count(),
-                                                               battery_level, temperature,
-                                                               NULL, NULL, 0);
-                uint32_t framfs_duration = k_uptime_get_32() - framfs_start;
-                if (ret == 0)
-                {
-                    LOG_INF("📊 FRAM minute record completed in %u ms: no activity, battery=%d%%, temp=%d°C",
-                            framfs_duration, battery_level, temperature);
-                }
-                else
-                {
-                    LOG_ERR("📊 FRAM minute record failed: %d (took %u ms)", ret, framfs_duration);
-                }
-            }
-        }
-        else if (ble_connected)
+        snap.queued_cyc = k_cycle_get_32();
+        if (k_msgq_put(&minute_record_q, &snap, K_NO_WAIT) != 0)
         {
-            LOG_DBG("⏸️ FRAMFS minute logging paused during BLE connection");
+            minute_records_dropped++;
+            LOG_ERR("📊 Minute record queue full - dropped minute %u (%u dropped total)",
+                    current_minute, minute_records_dropped);
         }
+    }
+    else if (ble_connected)
+    {
+        LOG_DBG("⏸️ FRAMFS minute logging paused during BLE connection");
+    }
+
+    /* Print and clear after the snapshot to preserve contents */
+    juxta_scan_table_print_and_clear();
+#if IS_ENABLED(CONFIG_JUXTA_BLE_RSSI_SERIES)
+    juxta_rssi_series_reset(&rssi_series);
+#endif
+
+    // Process motion events and adjust intervals based on activity
+    juxta_duty_observe_motion(&duty_ctrl, lis2dh12_get_motion_count(), current_time);
+    lis2dh12_process_motion_events();
+
+    last_logged_minute = current_minute;
+    LOG_INF("Minute of day: %u", current_minute);
+
+    minute_log_schedule(current_time);
+}
+
+/* Seconds until a burst with @p interval is due again */
+static uint32_t ble_seconds_until(uint32_t current_time, uint32_t last_timestamp, uint32_t interval)
+{
+    uint32_t time_since = current_time - last_timestamp;
+    return (time_since >= interval) ? 0 : (interval - time_since);
+}
+
+/* Uptime deadline for a burst @p until_s seconds from now, spaced from the previous burst */
+static uint32_t ble_burst_deadline(uint32_t until_s)
+{
+    /* Add minimum delay to prevent rapid start/stop cycles */
+    uint32_t delay_ms = MAX(until_s * 1000, BLE_MIN_INTER_BURST_DELAY_MS);
+
+    /* Add small random offset (0-1000ms) to prevent device synchronization */
+    uint32_t random_offset = sys_rand32_get() % 1000;
+    LOG_DBG("🎲 Random delay applied: +%u ms (total delay: %u ms) to prevent device sync",
+            random_offset, delay_ms + random_offset);
+
+    return k_uptime_get_32() + delay_ms + random_offset;
+}
+
+#if IS_ENABLED(CONFIG_JUXTA_BLE_SYNC_SLOTS)
+/* Burst starts must hit aligned slots, so give up coalescing slack for them */
+#define SYNC_SLOT_SCHED_SLACK_MS 5
+
+static const struct juxta_sync_cfg sync_cfg = {
+    .slot_ms = CONFIG_JUXTA_BLE_SYNC_SLOT_MS,
+    .gap_ms = CONFIG_JUXTA_BLE_SYNC_GAP_MS,
+    .drift_ppm = CONFIG_JUXTA_BLE_SYNC_DRIFT_PPM,
+    .sync_error_ms = CONFIG_JUXTA_BLE_SYNC_ERROR_MS,
+};
+
+static void ble_set_sync_slots_active(bool active, uint32_t guard_ms)
+{
+    if (active == sync_slots_active)
+    {
+        return;
+    }
 
-        /* Print and clear after logging to preserve contents */
-        juxta_scan_table_print_and_clear();
+    sync_slots_active = active;
+    sched_set_slack(JUXTA_SCHED_SCAN_BURST, active ? SYNC_SLOT_SCHED_SLACK_MS : sched_slack_ms[JUXTA_SCHED_SCAN_BURST]);
+    sched_set_slack(JUXTA_SCHED_ADV_BURST, active ? SYNC_SLOT_SCHED_SLACK_MS : sched_slack_ms[JUXTA_SCHED_ADV_BURST]);
+
+    if (active)
+    {
+        LOG_INF("🕒 Synchronized discovery slots active (guard %u ms)", guard_ms);
+    }
+    else
+    {
+        LOG_INF("🕒 Synchronized discovery slots off (guard %u ms) - using randomized bursts", guard_ms);
+    }
+}
+
+/* Guard from the measured drift bound (3 sigma) once there is one, else the configured worst case */
+static uint32_t ble_sync_guard_ms(uint32_t sync_age_s)
+{
+    struct juxta_sync_cfg cfg = sync_cfg;
+    struct juxta_vitals_drift drift;
+
+    if (juxta_vitals_get_drift(&vitals_ctx, &drift) == 0 && drift.samples > 0)
+    {
+        cfg.drift_ppm = CLAMP(DIV_ROUND_UP(3 * drift.sigma_ppb, 1000), 1, sync_cfg.drift_ppm);
+    }
+    return juxta_sync_guard_ms(&cfg, sync_age_s);
+}
 
-        // Process motion events and adjust intervals based on activity
-        lis2dh12_process_motion_events();
+/* Uptime deadline for a Unix-ms slot time, clamped to now for slots in progress */
+static uint32_t ble_sync_uptime(uint64_t unix_ms, uint64_t now_unix_ms, uint32_t now_ms)
+{
+    return now_ms + ((unix_ms > now_unix_ms) ? (uint32_t)(unix_ms - now_unix_ms) : 0);
+}
 
-        last_logged_minute = current_minute;
-        LOG_INF("Minute of day: %u", current_minute);
+/* Plan both bursts on aligned slots; false to fall back to randomized bursts */
+static bool ble_schedule_sync_bursts(void)
+{
+    if (!gateway_time_synced)
+    {
+        return false;
     }
 
-    // Pause state machine if connected
-    if (ble_connected)
+    uint32_t now_ms = k_uptime_get_32();
+    uint64_t now_unix_ms = juxta_vitals_get_unix_ms(&vitals_ctx);
+    uint32_t sync_age_s = (now_ms - gateway_sync_uptime_ms) / 1000;
+    uint32_t guard_ms = ble_sync_guard_ms(sync_age_s);
+    uint32_t adv_period_ms = get_adv_interval() * 1000;
+    uint32_t scan_period_ms = get_scan_interval() * 1000;
+    uint32_t window_ms = 2 * sync_cfg.slot_ms + sync_cfg.gap_ms + 2 * guard_ms;
+
+    if (now_unix_ms == 0 || !juxta_sync_usable(&sync_cfg, guard_ms) ||
+        MIN(adv_period_ms, scan_period_ms) < window_ms)
     {
-        LOG_DBG("⏸️ State machine paused - BLE connection active");
-        return;
+        ble_set_sync_slots_active(false, guard_ms);
+        return false;
     }
+    ble_set_sync_slots_active(true, guard_ms);
+
+    uint64_t start_ms;
+    uint64_t end_ms;
+    juxta_sync_next_slot(&sync_cfg, JUXTA_SYNC_ROLE_SCAN, scan_period_ms, sync_device_id,
+                         now_unix_ms, guard_ms, &start_ms, &end_ms);
+    sync_scan_end_ms = ble_sync_uptime(end_ms, now_unix_ms, now_ms);
+    sched_at(JUXTA_SCHED_SCAN_BURST, ble_sync_uptime(start_ms, now_unix_ms, now_ms));
+
+    juxta_sync_next_slot(&sync_cfg, JUXTA_SYNC_ROLE_ADV, adv_period_ms, sync_device_id,
+                         now_unix_ms, guard_ms, &start_ms, &end_ms);
+    sync_adv_end_ms = ble_sync_uptime(end_ms, now_unix_ms, now_ms);
+    sched_at(JUXTA_SCHED_ADV_BURST, ble_sync_uptime(start_ms, now_unix_ms, now_ms));
+
+    LOG_DBG("🕒 Sync slots: guard=%u ms (sync age %u s), scan ends +%u ms, adv ends +%u ms",
+            guard_ms, sync_age_s, sync_scan_end_ms - now_ms, sync_adv_end_ms - now_ms);
+    return true;
+}
+#else
+static bool ble_schedule_sync_bursts(void)
+{
+    return false;
+}
+#endif
 
-    // Only handle BLE state transitions if triggered by timer event
-    if (state_event == EVENT_TIMER_EXPIRED)
+/* Uptime end of a burst starting now: the planned slot end when slots are
+ * active, else the fixed burst duration */
+static uint32_t ble_burst_end_deadline(uint32_t slot_end_ms, uint32_t duration_ms)
+{
+    uint32_t now_ms = k_uptime_get_32();
+    if (sync_slots_active && (int32_t)(slot_end_ms - now_ms) > 0)
     {
-        state_event = EVENT_NONE;
+        return slot_end_ms;
+    }
+    return now_ms + duration_ms;
+}
 
-        LOG_DBG("State work handler: current_time=%u, ble_state=%d, doGatewayAdvertise=%s",
-                current_time, ble_state, doGatewayAdvertise ? "true" : "false");
+/* Schedule the next scan and advertising bursts from the last burst times */
+static void ble_schedule_bursts(void)
+{
+    if (ble_schedule_sync_bursts())
+    {
+        return;
+    }
 
-        // Handle gateway advertising state
-        if (ble_state == BLE_STATE_GATEWAY_ADVERTISING)
-        {
-            int err = juxta_stop_advertising();
-            if (err == 0)
-            {
-                ble_state = BLE_STATE_WAITING;
-                last_adv_timestamp = current_time;
-                // LOG_INF("Gateway advertising burst completed at timestamp %u", last_adv_timestamp);
-                k_timer_start(&state_timer, K_MSEC(BLE_MIN_INTER_BURST_DELAY_MS), K_NO_WAIT);
-            }
-            else
-            {
-                LOG_ERR("Failed to stop gateway advertising burst, skipping transition");
-            }
-            return;
-        }
+    uint32_t current_time = get_rtc_timestamp();
+    if (current_time == 0)
+    {
+        /* RTC not set yet - check again shortly */
+        sched_after(JUXTA_SCHED_SCAN_BURST, 1000);
+        sched_after(JUXTA_SCHED_ADV_BURST, 1000);
+        return;
+    }
 
-        if (ble_state == BLE_STATE_SCANNING)
-        {
-            int err = juxta_stop_scanning();
-            if (err == 0)
-            {
-                ble_state = BLE_STATE_WAITING;
-                last_scan_timestamp = current_time;
-                // LOG_INF("Scan burst completed at timestamp %u", last_scan_timestamp);
-                k_timer_start(&state_timer, K_MSEC(BLE_MIN_INTER_BURST_DELAY_MS), K_NO_WAIT);
-            }
-            else
-            {
-                LOG_ERR("Failed to stop scan burst, skipping transition");
-            }
-            return;
-        }
-        if (ble_state == BLE_STATE_ADVERTISING)
-        {
-            int err = juxta_stop_advertising();
-            if (err == 0)
-            {
-                ble_state = BLE_STATE_WAITING;
-                last_adv_timestamp = current_time;
-                // LOG_INF("Advertising burst completed at timestamp %u", last_adv_timestamp);
-                k_timer_start(&state_timer, K_MSEC(BLE_MIN_INTER_BURST_DELAY_MS), K_NO_WAIT);
-            }
-            else
-            {
-                LOG_ERR("Failed to stop advertising burst, skipping transition");
-            }
-            return;
-        }
+    uint32_t adv_interval = get_adv_interval();
+    uint32_t scan_interval = get_scan_interval();
+    uint32_t time_until_adv = ble_seconds_until(current_time, last_adv_timestamp, adv_interval);
+    uint32_t time_until_scan = ble_seconds_until(current_time, last_scan_timestamp, scan_interval);
 
-        bool scan_due = is_time_to_scan();
-        bool adv_due = is_time_to_advertise();
+    LOG_DBG("⏰ BLE timing: adv_interval=%u, scan_interval=%u, time_until_adv=%u, time_until_scan=%u",
+            adv_interval, scan_interval, time_until_adv, time_until_scan);
 
-        LOG_DBG("Checking for new bursts: scan_due=%d, adv_due=%d, doGatewayAdvertise=%s",
-                scan_due, adv_due, doGatewayAdvertise ? "true" : "false");
+    sched_at(JUXTA_SCHED_SCAN_BURST, ble_burst_deadline(time_until_scan));
+    sched_at(JUXTA_SCHED_ADV_BURST, ble_burst_deadline(time_until_adv));
+}
 
-        if (scan_due && ble_state == BLE_STATE_IDLE)
-        {
-            juxta_scan_table_reset();
-            ble_state = BLE_STATE_SCANNING;
-            uint32_t scan_start = k_uptime_get_32();
-            int err = juxta_start_scanning();
-            uint32_t scan_duration = k_uptime_get_32() - scan_start;
-            if (err == 0)
-            {
-                LOG_INF("Starting scan burst (%d ms) - took %u ms to start", SCAN_BURST_DURATION_MS, scan_duration);
-                k_timer_start(&state_timer, K_MSEC(SCAN_BURST_DURATION_MS), K_NO_WAIT);
-            }
-            else
-            {
-                ble_state = BLE_STATE_IDLE;
-                LOG_ERR("Scan failed: %d (took %u ms), retrying in 1 second", err, scan_duration);
-                k_timer_start(&state_timer, K_SECONDS(1), K_NO_WAIT);
-            }
-            return;
-        }
+/* Check the radio is free for a new burst; otherwise retry after the active one */
+static bool ble_burst_prepare(enum juxta_sched_event event)
+{
+    if (ble_connected)
+    {
+        /* Disconnect restores the schedule */
+        LOG_DBG("⏸️ State machine paused - BLE connection active");
+        return false;
+    }
 
-        // Check for gateway advertising first (higher priority)
-        if (adv_due && ble_state == BLE_STATE_IDLE && doGatewayAdvertise)
-        {
-            ble_state = BLE_STATE_GATEWAY_ADVERTISING;
-            // Clear the gateway advertise flag so we don't advertise again
-            doGatewayAdvertise = false;
-            int err = juxta_start_connectable_advertising();
-            if (err == 0)
-            {
-                LOG_INF("Starting gateway advertising burst (%ds connectable)", GATEWAY_ADV_TIMEOUT_SECONDS);
-                k_timer_start(&state_timer, K_SECONDS(GATEWAY_ADV_TIMEOUT_SECONDS), K_NO_WAIT);
-            }
-            else
-            {
-                ble_state = BLE_STATE_IDLE;
-                LOG_ERR("Gateway advertising failed, continuing with normal operation");
-                // Don't retry - move on to normal state machine operation
-                k_work_submit(&state_work);
-            }
-            return;
-        }
+    if (ble_state == BLE_STATE_WAITING)
+    {
+        LOG_DBG("Transitioning from WAITING to IDLE");
+        ble_set_state(BLE_STATE_IDLE);
+    }
 
-        if (adv_due && ble_state == BLE_STATE_IDLE)
+    if (ble_state != BLE_STATE_IDLE)
+    {
+        uint32_t end_ms;
+        if (sched_pending(JUXTA_SCHED_BURST_END, &end_ms))
         {
-            ble_state = BLE_STATE_ADVERTISING;
-            uint32_t adv_start = k_uptime_get_32();
-            int err = juxta_start_advertising();
-            uint32_t adv_duration = k_uptime_get_32() - adv_start;
-            if (err == 0)
-            {
-                LOG_INF("Starting advertising burst (%d ms) - took %u ms to start", ADV_BURST_DURATION_MS, adv_duration);
-                k_timer_start(&state_timer, K_MSEC(ADV_BURST_DURATION_MS), K_NO_WAIT);
-            }
-            else
-            {
-                ble_state = BLE_STATE_IDLE;
-                LOG_ERR("Advertising failed: %d (took %u ms), retrying in 1 second", err, adv_duration);
-                k_timer_start(&state_timer, K_SECONDS(1), K_NO_WAIT);
-            }
-            return;
+            sched_at(event, end_ms + BLE_MIN_INTER_BURST_DELAY_MS);
         }
-        if (ble_state == BLE_STATE_WAITING)
+        else
         {
-            LOG_DBG("Transitioning from WAITING to IDLE");
-            ble_state = BLE_STATE_IDLE;
+            sched_after(event, BLE_MIN_INTER_BURST_DELAY_MS);
         }
+        return false;
+    }
 
-        uint32_t time_until_adv = 0;
-        uint32_t time_until_scan = 0;
+    return true;
+}
 
-        if (ble_state == BLE_STATE_IDLE)
-        {
-            uint32_t time_since_adv = current_time - last_adv_timestamp;
-            uint32_t time_since_scan = current_time - last_scan_timestamp;
+static void ble_scan_burst_start(void)
+{
+    if (!ble_burst_prepare(JUXTA_SCHED_SCAN_BURST))
+    {
+        return;
+    }
 
-            uint32_t adv_interval = get_adv_interval();
-            uint32_t scan_interval = get_scan_interval();
+    juxta_scan_table_reset();
+    ble_set_state(BLE_STATE_SCANNING);
+    uint32_t scan_start = k_uptime_get_32();
+    juxta_wmon_block_begin("scan start");
+    int err = juxta_start_scanning();
+    juxta_wmon_block_end();
+    uint32_t scan_duration = k_uptime_get_32() - scan_start;
+    if (err == 0)
+    {
+        LOG_INF("Starting scan burst (%d ms) - took %u ms to start", SCAN_BURST_DURATION_MS, scan_duration);
+        sched_at(JUXTA_SCHED_BURST_END, ble_burst_end_deadline(sync_scan_end_ms, SCAN_BURST_DURATION_MS));
+    }
+    else
+    {
+        ble_set_state(BLE_STATE_IDLE);
+        LOG_ERR("Scan failed: %d (took %u ms), retrying in 1 second", err, scan_duration);
+        sched_after(JUXTA_SCHED_SCAN_BURST, 1000);
+    }
+}
 
-            time_until_adv = (time_since_adv >= adv_interval) ? 0 : (adv_interval - time_since_adv);
-            time_until_scan = (time_since_scan >= scan_interval) ? 0 : (scan_interval - time_since_scan);
+static void ble_adv_burst_start(void)
+{
+    if (!ble_burst_prepare(JUXTA_SCHED_ADV_BURST))
+    {
+        return;
+    }
 
-            LOG_DBG("⏰ BLE timing: adv_interval=%u, scan_interval=%u, time_until_adv=%u, time_until_scan=%u",
-                    adv_interval, scan_interval, time_until_adv, time_until_scan);
+    // Check for gateway advertising first (higher priority)
+    if (doGatewayAdvertise)
+    {
+        ble_set_state(BLE_STATE_GATEWAY_ADVERTISING);
+        // Clear the gateway advertise flag so we don't advertise again
+        doGatewayAdvertise = false;
+        juxta_wmon_block_begin("gateway adv start");
+        int err = juxta_start_connectable_advertising();
+        juxta_wmon_block_end();
+        if (err == 0)
+        {
+            LOG_INF("Starting gateway advertising burst (%ds connectable)", GATEWAY_ADV_TIMEOUT_SECONDS);
+            sched_after(JUXTA_SCHED_BURST_END, GATEWAY_ADV_TIMEOUT_SECONDS * 1000);
         }
-
-        // Check if we're in or approaching a minute write safe zone
-        if (is_in_minute_write_safe_zone(current_time))
+        else
         {
-            LOG_INF("⏰ In minute write safe zone - deferring BLE operations");
-            uint32_t time_to_exit_safe_zone = calculate_time_to_exit_safe_zone(current_time);
-
-            // Ensure minimum delay to prevent timer storm
-            if (time_to_exit_safe_zone == 0)
-            {
-                time_to_exit_safe_zone = 1; // Minimum 1 second delay
-            }
-
-            k_timer_start(&state_timer, K_SECONDS(time_to_exit_safe_zone), K_NO_WAIT);
-            LOG_INF("⏰ Deferring BLE operations for %u seconds", time_to_exit_safe_zone);
-            return;
+            ble_set_state(BLE_STATE_IDLE);
+            LOG_ERR("Gateway advertising failed, continuing with normal operation");
+            // Don't retry - move on to normal state machine operation
+            ble_schedule_bursts();
         }
+        return;
+    }
 
-        uint32_t next_delay_ms = MIN(time_until_adv, time_until_scan) * 1000;
+    ble_set_state(BLE_STATE_ADVERTISING);
+    uint32_t adv_start = k_uptime_get_32();
+    juxta_wmon_block_begin("adv start");
+    int err = juxta_start_advertising();
+    juxta_wmon_block_end();
+    uint32_t adv_duration = k_uptime_get_32() - adv_start;
+    if (err == 0)
+    {
+        LOG_INF("Starting advertising burst (%d ms) - took %u ms to start", ADV_BURST_DURATION_MS, adv_duration);
+        sched_at(JUXTA_SCHED_BURST_END, ble_burst_end_deadline(sync_adv_end_ms, ADV_BURST_DURATION_MS));
+    }
+    else
+    {
+        ble_set_state(BLE_STATE_IDLE);
+        LOG_ERR("Advertising failed: %d (took %u ms), retrying in 1 second", err, adv_duration);
+        sched_after(JUXTA_SCHED_ADV_BURST, 1000);
+    }
+}
 
-        // Check if next action would conflict with minute write window
-        if (is_approaching_minute_boundary(current_time, next_delay_ms / 1000))
-        {
-            LOG_INF("⏰ Next BLE action would conflict with minute write window - deferring");
-            // Calculate time to safely start BLE operations after minute boundary
-            uint32_t seconds_in_minute = current_time % 60;
-            uint32_t time_to_safe_zone = 60 - seconds_in_minute + (MINUTE_WRITE_SAFE_ZONE_MS / 1000);
+static void ble_burst_end(void)
+{
+    if (ble_connected)
+    {
+        /* connected() already stopped the burst */
+        return;
+    }
 
-            // Ensure minimum delay to prevent timer storm
-            if (time_to_safe_zone == 0)
-            {
-                time_to_safe_zone = 1; // Minimum 1 second delay
-            }
+    uint32_t current_time = get_rtc_timestamp();
+    int err = 0;
+
+    LOG_DBG("Burst end: current_time=%u, ble_state=%d, doGatewayAdvertise=%s",
+            current_time, ble_state, doGatewayAdvertise ? "true" : "false");
 
-            next_delay_ms = time_to_safe_zone * 1000;
-            LOG_INF("⏰ Deferring BLE operations for %u seconds to avoid minute write conflict", time_to_safe_zone);
+    if (ble_state == BLE_STATE_GATEWAY_ADVERTISING || ble_state == BLE_STATE_ADVERTISING)
+    {
+        juxta_wmon_block_begin("adv stop");
+        err = juxta_stop_advertising();
+        juxta_wmon_block_end();
+        if (err == 0)
+        {
+            last_adv_timestamp = current_time;
         }
-        else
+    }
+    else if (ble_state == BLE_STATE_SCANNING)
+    {
+        juxta_wmon_block_begin("scan stop");
+        err = juxta_stop_scanning();
+        juxta_wmon_block_end();
+        if (err == 0)
         {
-            /* Add minimum delay to prevent rapid start/stop cycles */
-            next_delay_ms = MAX(next_delay_ms, 100);
-
-            /* Add small random offset (0-1000ms) to prevent device synchronization */
-            uint32_t random_offset = sys_rand32_get() % 1000;
-            next_delay_ms += random_offset;
-
-            LOG_INF("🎲 Random delay applied: +%u ms (total delay: %u ms) to prevent device sync",
-                    random_offset, next_delay_ms);
+            last_scan_timestamp = current_time;
+            duty_observe_scan(current_time);
+#if IS_ENABLED(CONFIG_JUXTA_BLE_RSSI_SERIES)
+            juxta_rssi_series_end_burst(&rssi_series);
+#endif
         }
+    }
 
-        LOG_DBG("Sleeping for %u ms until next action", next_delay_ms);
-        k_timer_start(&state_timer, K_MSEC(next_delay_ms), K_NO_WAIT);
-
-        uint32_t ts = juxta_vitals_get_timestamp(&vitals_ctx);
-        uint32_t uptime = k_uptime_get_32();
-        LOG_DBG("Timestamp: %u, Uptime(ms): %u", ts, uptime);
+    if (err != 0)
+    {
+        LOG_ERR("Failed to stop burst (state %d), retrying in 1 second", ble_state);
+        sched_after(JUXTA_SCHED_BURST_END, 1000);
+        return;
     }
 
-    LOG_INF("🔄 state_work_handler: EXIT");
+    ble_schedule_bursts();
 }
 
-// Work queue health monitoring
-static void health_check_work_handler(struct k_work *work)
+// Work queue health monitoring (JUXTA_SCHED_HEALTH_CHECK)
+static void health_check_handler(void)
 {
     uint32_t current_time = k_uptime_get_32();
     uint32_t time_since_state_work = current_time - last_state_work_time;
@@ -2115,6 +2722,34 @@ static void health_check_work_handler(struct k_work *work)
             state_work_count, adc_work_count, stuck_work_detections);
     LOG_INF("🏥 health_check: time_since_state_work=%u ms, time_since_adc_work=%u ms",
             time_since_state_work, time_since_adc_work);
+    LOG_INF("🏥 health_check: scheduler wakeups=%u, events=%u", sched_disp.sched.wakeups,
+            sched_disp.sched.dispatched);
+    if (session_adaptive_duty_enabled)
+    {
+        LOG_INF("🏥 health_check: duty level=%u (adv=%u s, scan=%u s, %u ms/h), new=%u lost=%u faster=%u slower=%u",
+                duty_ctrl.level, juxta_duty_adv_interval(&duty_ctrl), juxta_duty_scan_interval(&duty_ctrl),
+                juxta_duty_on_time_per_hour(&duty_ctrl), duty_ctrl.new_peers, duty_ctrl.lost_peers,
+                duty_ctrl.steps_faster, duty_ctrl.steps_slower);
+    }
+#if IS_ENABLED(CONFIG_JUXTA_BLE_PERIODIC_ADV)
+    LOG_INF("🏥 health_check: periodic peers synced=%u", juxta_peer_sync_count());
+#endif
+    LOG_INF("🏥 health_check: SPI bus client switches=%u", juxta_spi_bus_switches());
+    juxta_spi_bus_log_stats(&fram_dev.bus);
+    lis2dh12_log_bus_stats();
+#ifdef CONFIG_JUXTA_PROF
+    juxta_prof_log();
+#endif
+#if IS_ENABLED(CONFIG_JUXTA_BLE_WORK_MONITOR)
+    juxta_wmon_log();
+#endif
+    juxta_scratch_log();
+#if IS_ENABLED(CONFIG_JUXTA_BLE_ENERGY)
+    juxta_energy_log();
+    uint8_t energy_batt_pct = juxta_vitals_get_battery_percent(&vitals_ctx);
+    LOG_INF("🏥 health_check: projected runtime %u h at %u%% battery",
+            juxta_energy_runtime_h(energy_batt_pct), energy_batt_pct);
+#endif
 
     // Check for stuck work handlers (no execution in last 2 minutes)
     bool state_work_stuck = (time_since_state_work > 120000) && (state_work_count > 0);
@@ -2130,6 +2765,9 @@ static void health_check_work_handler(struct k_work *work)
 
         // Log work queue statistics
         LOG_ERR("🚨 Work queue may be blocked - manual intervention may be required");
+#if IS_ENABLED(CONFIG_JUXTA_BLE_WORK_MONITOR)
+        LOG_ERR("🚨 See the work monitor report above for the slowest item and its blocking call");
+#endif
     }
     else
     {
@@ -2140,12 +2778,143 @@ static void health_check_work_handler(struct k_work *work)
     check_battery_system_health();
 }
 
-// Health check timer callback
-static void health_check_timer_callback(struct k_timer *timer)
+/**
+ * @brief Start 1Hz LED feedback during connectable advertising
+ */
+static void led_blink_start(void)
+{
+    led_blink_state = false;
+    sched_after(JUXTA_SCHED_LED_BLINK, LED_BLINK_INTERVAL_MS);
+}
+
+/* Toggle LED every 500ms while connectable advertising waits for configuration */
+static void led_blink_handler(void)
+{
+    if (!connectable_adv_active || current_mode != OPERATING_MODE_UNDEFINED)
+    {
+        return; /* Stop blinking; led_blink_start() resumes it */
+    }
+
+    /* Access LED through device tree reference */
+    const struct gpio_dt_spec led_spec = GPIO_DT_SPEC_GET(DT_PATH(leds, led_0), gpios);
+    led_blink_state = !led_blink_state;
+    gpio_pin_set_dt(&led_spec, led_blink_state ? 1 : 0);
+    sched_after(JUXTA_SCHED_LED_BLINK, LED_BLINK_INTERVAL_MS);
+}
+
+/* Periodic events are re-armed before their handler runs so handler
+ * latency does not accumulate as drift */
+static void sched_health_check(uint32_t now_ms)
+{
+    sched_at(JUXTA_SCHED_HEALTH_CHECK, now_ms + HEALTH_CHECK_INTERVAL_MS);
+    health_check_handler();
+}
+
+static void sched_led_blink(uint32_t now_ms)
+{
+    ARG_UNUSED(now_ms);
+    led_blink_handler();
+}
+
+static void sched_minute_log(uint32_t now_ms)
+{
+    ARG_UNUSED(now_ms);
+    minute_log_handler();
+}
+
+static void sched_burst_end(uint32_t now_ms)
+{
+    ARG_UNUSED(now_ms);
+    ble_burst_end();
+}
+
+static void sched_scan_burst(uint32_t now_ms)
+{
+    ARG_UNUSED(now_ms);
+    ble_scan_burst_start();
+}
+
+static void sched_adv_burst(uint32_t now_ms)
+{
+    ARG_UNUSED(now_ms);
+    ble_adv_burst_start(); /* Deferred if the scan took the radio */
+}
+
+static void sched_adc_trigger(uint32_t now_ms)
+{
+    sched_at(JUXTA_SCHED_ADC_TRIGGER, now_ms + adc_trigger_interval_ms);
+    juxta_wmon_begin_since(JUXTA_WMON_ADC_TRIGGER, sched_fired_cyc);
+    adc_trigger_handler();
+    juxta_wmon_end(JUXTA_WMON_ADC_TRIGGER);
+}
+
+static bool sched_state_ready(void)
+{
+    return state_system_ready;
+}
+
+static void sched_state_begin(uint32_t now_ms, uint32_t due)
 {
-    LOG_INF("⏰ health_check_timer_callback: ENTRY - submitting health_check_work");
-    int ret = k_work_submit(&health_check_work);
-    LOG_INF("⏰ health_check_timer_callback: EXIT - work submission result: %d", ret);
+    ARG_UNUSED(due);
+    last_state_work_time = now_ms;
+    state_work_count++;
+    juxta_wmon_begin_since(JUXTA_WMON_STATE, sched_fired_cyc);
+
+    // Process all scan events from the queue
+    process_scan_events();
+}
+
+static void sched_state_end(void)
+{
+    juxta_wmon_end(JUXTA_WMON_STATE);
+}
+
+static void sched_state_dropped(uint32_t events)
+{
+    LOG_WRN("⚠️ sched_work_handler: State system not ready, dropping events 0x%02x", events);
+}
+
+static const struct juxta_sched_handlers sched_handlers = {
+    .event = {
+        [JUXTA_SCHED_HEALTH_CHECK] = sched_health_check,
+        [JUXTA_SCHED_LED_BLINK] = sched_led_blink,
+        [JUXTA_SCHED_MINUTE_LOG] = sched_minute_log,
+        [JUXTA_SCHED_ADC_TRIGGER] = sched_adc_trigger,
+        [JUXTA_SCHED_BURST_END] = sched_burst_end,
+        [JUXTA_SCHED_SCAN_BURST] = sched_scan_burst,
+        [JUXTA_SCHED_ADV_BURST] = sched_adv_burst,
+        [JUXTA_SCHED_BATTERY_SAMPLE] = battery_sample_handler,
+    },
+    .state_ready = sched_state_ready,
+    .state_begin = sched_state_begin,
+    .state_end = sched_state_end,
+    .state_dropped = sched_state_dropped,
+};
+
+/**
+ * @brief Dispatch every due scheduler event in one pass
+ *
+ * juxta_sched_dispatch_run() re-arms the timer at the end of the pass, so
+ * a handler that declines to reschedule does not leave the timer idle.
+ */
+static void sched_work_handler(struct k_work *work)
+{
+    juxta_wmon_begin(JUXTA_WMON_SCHED);
+
+    uint32_t due = juxta_sched_dispatch_run(&sched_disp);
+    LOG_DBG("⏰ sched_work_handler: due=0x%02x", due);
+
+    juxta_wmon_end(JUXTA_WMON_SCHED);
+}
+
+/**
+ * @brief Initialize the event scheduler (nothing pending yet)
+ */
+static void sched_setup(void)
+{
+    k_work_init(&sched_work, sched_work_handler);
+    k_timer_init(&sched_timer, sched_timer_callback, NULL);
+    juxta_sched_dispatch_init(&sched_disp, sched_slack_ms, &sched_port, &sched_handlers);
 }
 
 static int juxta_start_advertising(void)
@@ -2193,7 +2962,7 @@ static int juxta_stop_advertising(void)
         return ret;
     }
 
-    ble_state = BLE_STATE_WAITING;
+    ble_set_state(BLE_STATE_WAITING);
     return 0;
 }
 
@@ -2216,9 +2985,18 @@ static int juxta_start_scanning(void)
         .timeout = 0,       // controlled externally with SCAN_BURST_DURATION_MS
     };
 
+    if (sync_slots_active)
+    {
+        /* Aligned slots are short; scan continuously for the whole slot */
+        scan_param.window = scan_param.interval;
+    }
+
     /* Ensure advertising is fully stopped and add a longer delay before scanning */
     bt_le_adv_stop();
-    k_sleep(K_MSEC(200)); // Increased delay for radio stability
+    if (!sync_slots_active)
+    {
+        k_sleep(K_MSEC(200)); // Increased delay for radio stability
+    }
 
     LOG_INF("🔍 About to call bt_le_scan_start with interval=0x%04x, window=0x%04x...",
             scan_param.interval, scan_param.window);
@@ -2250,8 +3028,11 @@ static int juxta_stop_scanning(void)
         LOG_ERR("Scanning failed to stop (err %d)", ret);
         return ret;
     }
+#if IS_ENABLED(CONFIG_JUXTA_BLE_PERIODIC_ADV)
+    juxta_peer_sync_scan_ended();
+#endif
 
-    ble_state = BLE_STATE_WAITING;
+    ble_set_state(BLE_STATE_WAITING);
     LOG_INF("Scanning stopped successfully");
     return 0;
 }
@@ -2318,9 +3099,10 @@ static void connected(struct bt_conn *conn, uint8_t err)
 
     LOG_INF("🔗 Connected to peer device");
     ble_connected = true; // Mark as connected
+    juxta_energy_enter(JUXTA_ENERGY_CONN);
 
-    /* Stop LED feedback timer during BLE connection */
-    k_timer_stop(&connectable_adv_led_timer);
+    /* Stop LED feedback during BLE connection */
+    sched_cancel(JUXTA_SCHED_LED_BLINK);
     led_blink_state = false;
     /* Access LED through device tree reference */
     const struct gpio_dt_spec led_spec = GPIO_DT_SPEC_GET(DT_PATH(leds, led_0), gpios);
@@ -2425,19 +3207,17 @@ static void restore_system_state_after_disconnect(void)
 
         /* Restart state machine */
         LOG_INF("⚙️ State machine restarted for normal operation");
-        k_work_submit(&state_work);
+        ble_schedule_bursts();
+#if IS_ENABLED(CONFIG_JUXTA_BLE_PERIODIC_ADV)
+        (void)juxta_peer_sync_start();
+#endif
 
         break;
 
     case OPERATING_MODE_ADC_ONLY:
         LOG_INF("📊 Restoring ADC_ONLY operation mode");
 
-        /* Resume ADC operations */
-        LOG_INF("📊 ADC operations resumed - submitting adc_work");
-        int adc_work_result = k_work_submit(&adc_work);
-        LOG_INF("📊 ADC work submission result: %d", adc_work_result);
-
-        /* Start ADC timer for periodic operation */
+        /* Start ADC service for periodic operation */
         uint32_t interval_seconds = 5; // Default interval
         struct juxta_framfs_adc_config adc_config;
         if (juxta_framfs_get_adc_config(&framfs_ctx, &adc_config) == 0)
@@ -2452,8 +3232,10 @@ static void restore_system_state_after_disconnect(void)
             }
         }
 
-        k_timer_start(&adc_k_timer, K_SECONDS(interval_seconds), K_SECONDS(interval_seconds));
-        LOG_INF("📊 ADC timer restarted with %u second intervals", interval_seconds);
+        /* Resume ADC operations now; the handler re-arms at the interval */
+        adc_trigger_interval_ms = interval_seconds * 1000;
+        sched_after(JUXTA_SCHED_ADC_TRIGGER, 0);
+        LOG_INF("📊 ADC operations resumed with %u second intervals", interval_seconds);
 
         break;
 
@@ -2490,8 +3272,12 @@ static void restore_system_state_after_disconnect(void)
 static void disconnected(struct bt_conn *conn, uint8_t reason)
 {
     LOG_INF("🔌 Disconnected from peer (reason %u)", reason);
+    if (ble_connected)
+    {
+        juxta_energy_exit(JUXTA_ENERGY_CONN);
+    }
     ble_connected = false; // Mark as disconnected
-    ble_state = BLE_STATE_IDLE;
+    ble_set_state(BLE_STATE_IDLE);
 
     // Check if we're in DFU mode and handle disconnect
     if (current_mode == OPERATING_MODE_DFU)
@@ -2681,20 +3467,23 @@ static void pause_all_operations(void)
     // Stop BLE operations immediately for both modes
     (void)juxta_stop_advertising();
     (void)juxta_stop_scanning();
-    ble_state = BLE_STATE_IDLE;
+#if IS_ENABLED(CONFIG_JUXTA_BLE_PERIODIC_ADV)
+    juxta_peer_sync_stop();
+#endif
+    ble_set_state(BLE_STATE_IDLE);
     LOG_INF("⏸️ BLE operations stopped");
 
     // Stop operations based on current mode
     if (current_mode == OPERATING_MODE_ADC_ONLY)
     {
-        // Stop ADC timer
-        k_timer_stop(&adc_k_timer);
+        // Stop ADC service
+        sched_cancel(JUXTA_SCHED_ADC_TRIGGER);
         LOG_INF("⏸️ ADC timer stopped");
     }
     else if (current_mode == OPERATING_MODE_NORMAL)
     {
-        // Stop state machine timer
-        k_timer_stop(&state_timer);
+        // Stop state machine events
+        sched_cancel_state_events();
         LOG_INF("⏸️ State machine timer stopped");
     }
 
@@ -2716,14 +3505,18 @@ static void resume_all_operations(void)
     // Restart operations based on current mode
     if (current_mode == OPERATING_MODE_ADC_ONLY)
     {
-        // Restart ADC timer
-        k_timer_start(&adc_k_timer, K_SECONDS(5), K_SECONDS(5));
+        // Restart ADC service
+        sched_after(JUXTA_SCHED_ADC_TRIGGER, adc_trigger_interval_ms);
         LOG_INF("▶️ ADC timer restarted");
     }
     else if (current_mode == OPERATING_MODE_NORMAL)
     {
-        // Restart state machine timer
-        k_timer_start(&state_timer, K_NO_WAIT, K_NO_WAIT);
+        // Restart state machine events
+        sched_after(JUXTA_SCHED_MINUTE_LOG, 0);
+        ble_schedule_bursts();
+#if IS_ENABLED(CONFIG_JUXTA_BLE_PERIODIC_ADV)
+        (void)juxta_peer_sync_start();
+#endif
         LOG_INF("▶️ State machine timer restarted");
     }
 
@@ -2740,12 +3533,12 @@ static void perform_graceful_reset(void)
     // Ensure all operations are stopped based on current mode
     if (current_mode == OPERATING_MODE_ADC_ONLY)
     {
-        k_timer_stop(&adc_k_timer);
+        sched_cancel(JUXTA_SCHED_ADC_TRIGGER);
         LOG_INF("🔄 ADC timer stopped for reset");
     }
     else if (current_mode == OPERATING_MODE_NORMAL)
     {
-        k_timer_stop(&state_timer);
+        sched_cancel_state_events();
         LOG_INF("🔄 State machine timer stopped for reset");
     }
 
@@ -3046,30 +3839,6 @@ static void enter_dfu_mode(void)
     }
 }
 
-static void ten_minute_timeout(struct k_timer *timer)
-{
-    doGatewayAdvertise = false;
-}
-
-/* LED state for timer-based blinking (declared above) */
-
-/**
- * @brief LED timer callback for connectable advertising feedback
- */
-static void connectable_adv_led_callback(struct k_timer *timer)
-{
-    /* Toggle LED state during connectable advertising - NO k_sleep() in ISR! */
-    if (connectable_adv_active && current_mode == OPERATING_MODE_UNDEFINED)
-    {
-        /* Access LED through device tree reference */
-        const struct gpio_dt_spec led_spec = GPIO_DT_SPEC_GET(DT_PATH(leds, led_0), gpios);
-
-        /* Toggle LED state every 500ms to create 1Hz blink pattern */
-        led_blink_state = !led_blink_state;
-        gpio_pin_set_dt(&led_spec, led_blink_state ? 1 : 0);
-    }
-}
-
 /**
  * @brief Callback function called when datetime is synchronized via BLE
  */
@@ -3077,6 +3846,8 @@ static void datetime_synchronized_callback(void)
 {
     datetime_synchronized = true;
     datetime_sync_retry_count = 0; // Reset retry counter on success
+    gateway_time_synced = true;
+    gateway_sync_uptime_ms = k_uptime_get_32();
     LOG_INF("✅ Datetime synchronization callback triggered");
 }
 
@@ -3108,8 +3879,7 @@ static void datetime_sync_restart_work_handler(struct k_work *work)
         /* Restart LED feedback timer if mode is still undefined */
         if (current_mode == OPERATING_MODE_UNDEFINED)
         {
-            led_blink_state = false;
-            k_timer_start(&connectable_adv_led_timer, K_MSEC(500), K_MSEC(500));
+            led_blink_start();
             LOG_DBG("💡 LED feedback restarted: 1Hz blinking during connectable advertising");
         }
     }
@@ -3135,6 +3905,11 @@ int main(void)
     /* Clear reset reason register */
     NRF_POWER->RESETREAS = reset_reason;
 
+#ifdef CONFIG_JUXTA_PROF
+    (void)juxta_prof_init();
+#endif
+    juxta_wmon_init();
+
     /* Configure Power-fail Comparator (POF) to prevent 2.1V brownout resets */
     /*
      * POF Analysis and Findings:
@@ -3289,11 +4064,21 @@ int main(void)
     juxta_ble_set_datetime_sync_callback(datetime_synchronized_callback);
 
     // Start connectable advertising and wait for datetime synchronization
-    // Ensure work handler is initialized before any scheduling
+    // Ensure work handler and scheduler are initialized before any scheduling
     k_work_init(&datetime_sync_restart_work, datetime_sync_restart_work_handler);
+    sched_setup();
+    duty_configure();
+    minute_writer_start();
 
     // Ensure dynamic name is set before starting connectable advertising
     setup_dynamic_adv_name();
+#if IS_ENABLED(CONFIG_JUXTA_BLE_PERIODIC_ADV)
+    ret = juxta_peer_sync_init(adv_name);
+    if (ret < 0)
+    {
+        LOG_WRN("⚠️ Periodic peer tracking unavailable (err %d), using scan bursts only", ret);
+    }
+#endif
 
     // Retry connectable advertising with delays
     int adv_retry_count = 0;
@@ -3323,8 +4108,7 @@ int main(void)
     /* Start LED feedback timer for connectable advertising (1Hz blinking) */
     if (current_mode == OPERATING_MODE_UNDEFINED)
     {
-        led_blink_state = false;
-        k_timer_start(&connectable_adv_led_timer, K_MSEC(500), K_MSEC(500));
+        led_blink_start();
         LOG_DBG("💡 LED feedback started: 1Hz blinking during connectable advertising");
     }
 
@@ -3398,15 +4182,14 @@ int main(void)
     juxta_ble_set_vitals_context(&vitals_ctx);
 
     init_randomization();
-    k_work_init(&state_work, state_work_handler);
-    k_timer_init(&state_timer, state_timer_callback, NULL);
 
     // Initialize work queue health monitoring
-    k_work_init(&health_check_work, health_check_work_handler);
-    k_timer_init(&health_check_timer, health_check_timer_callback, NULL);
-    k_timer_start(&health_check_timer, K_SECONDS(30), K_SECONDS(30)); // Check every 30 seconds
+    sched_after(JUXTA_SCHED_HEALTH_CHECK, HEALTH_CHECK_INTERVAL_MS);
     LOG_INF("🏥 Work queue health monitoring initialized (30s intervals)");
 
+    /* juxta_vitals_init() took the first battery sample; refresh in the background */
+    sched_after(JUXTA_SCHED_BATTERY_SAMPLE, BATTERY_SAMPLE_INTERVAL_MS);
+
     state_system_ready = true;
 
     /* Quick vitals sanity read in thread context */
@@ -3415,12 +4198,6 @@ int main(void)
     int8_t temperature = juxta_vitals_get_temperature(&vitals_ctx);
     LOG_DBG("Vitals init: battery=%u%%, temp=%dC", battery_level, temperature);
 
-    // Initialize 10-minute timer (now only for gateway advertising timeout)
-    k_timer_init(&ten_minute_timer, ten_minute_timeout, NULL);
-
-    // Initialize LED feedback timer for connectable advertising
-    k_timer_init(&connectable_adv_led_timer, connectable_adv_led_callback, NULL);
-
     uint32_t current_time = get_rtc_timestamp();
     last_adv_timestamp = current_time - get_adv_interval();
     last_scan_timestamp = current_time - get_scan_interval();
@@ -3480,8 +4257,11 @@ int main(void)
     else if (current_mode == OPERATING_MODE_NORMAL)
     {
         /* Mode 0: Start state machine for BLE bursts/motion counting */
-        k_work_submit(&state_work);
-        k_timer_start(&state_timer, K_NO_WAIT, K_NO_WAIT); // triggers EVENT_TIMER_EXPIRED immediately
+        sched_after(JUXTA_SCHED_MINUTE_LOG, 0);
+        ble_schedule_bursts();
+#if IS_ENABLED(CONFIG_JUXTA_BLE_PERIODIC_ADV)
+        (void)juxta_peer_sync_start();
+#endif
         LOG_INF("✅ JUXTA BLE Application started in NORMAL mode (BLE bursts/motion counting)");
 
         /* Initialize magnet sensor for reset functionality in Normal mode - same as ADC mode */
@@ -3510,9 +4290,6 @@ int main(void)
     else if (current_mode == OPERATING_MODE_ADC_ONLY)
     {
         /* Mode 1: Start ADC timer for pure ADC recordings - no state machine needed */
-        k_work_init(&adc_work, adc_work_handler);
-        k_timer_init(&adc_k_timer, adc_timer_callback, NULL);
-
         /* Get ADC configuration for timer interval */
         struct juxta_framfs_adc_config adc_config;
         uint32_t interval_seconds = 5; /* Default 5 seconds */
@@ -3525,10 +4302,10 @@ int main(void)
             }
         }
 
-        k_timer_start(&adc_k_timer, K_SECONDS(interval_seconds), K_SECONDS(interval_seconds));
         /* Kick once immediately so we don't wait for first run */
-        LOG_INF("📊 adc_work_handler: initial kick after ADC_ONLY init (interval: %u seconds)", interval_seconds);
-        k_work_submit(&adc_work);
+        adc_trigger_interval_ms = interval_seconds * 1000;
+        LOG_INF("📊 adc_trigger_handler: initial kick after ADC_ONLY init (interval: %u seconds)", interval_seconds);
+        sched_after(JUXTA_SCHED_ADC_TRIGGER, 0);
         LOG_INF("✅ JUXTA BLE Application started in ADC_ONLY mode (pure ADC recordings)");
         LOG_INF("📊 ADC_ONLY mode: State machine disabled - ADC timer active (5s intervals)");
 
@@ -0,0 +1,399 @@
+/*
+ * JUXTA Periodic Advertising Peer Tracking Implementation
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "peer_sync.h"
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/gap.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+#include <stdio.h>
+#include <string.h>
+
+LOG_MODULE_REGISTER(juxta_peer_sync, LOG_LEVEL_INF);
+
+/* BLE units: advertising/periodic intervals in 0.625/1.25 ms, sync timeout in 10 ms */
+#define EXT_ADV_INTERVAL_UNITS (CONFIG_JUXTA_BLE_EXT_ADV_INTERVAL_MS * 8 / 5)
+#define PER_ADV_INTERVAL_UNITS (CONFIG_JUXTA_BLE_PERIODIC_ADV_INTERVAL_MS * 4 / 5)
+
+/* Give up on a peer after this many listened events in a row are missed */
+#define SYNC_LOST_EVENTS 6
+#define SYNC_TIMEOUT_MIN 0x000A
+#define SYNC_TIMEOUT_MAX 0x4000
+
+struct peer_slot
+{
+    uint32_t mac_id;
+    int8_t rssi;   /* Strongest RSSI since the last collect */
+    bool heard;    /* Report received since the last collect */
+    bool synced;   /* Sync established (not just being created) */
+};
+
+static struct bt_le_ext_adv *per_adv;
+static struct bt_data per_ad[1];
+static struct peer_slot slots[CONFIG_BT_PER_ADV_SYNC_MAX];
+static struct k_spinlock slots_lock;
+
+/* One sync create may be pending in the controller at a time */
+static struct bt_le_per_adv_sync *pending_sync;
+static struct bt_le_per_adv_sync_param pending_param;
+static uint32_t pending_mac_id;
+static bool pending_queued;
+static bool tracking_enabled;
+
+static void create_work_handler(struct k_work *work);
+static K_WORK_DEFINE(create_work, create_work_handler);
+
+static uint16_t sync_timeout(void)
+{
+    uint32_t timeout = (uint32_t)CONFIG_JUXTA_BLE_PERIODIC_ADV_INTERVAL_MS *
+                       (CONFIG_JUXTA_BLE_PERIODIC_SYNC_SKIP + 1) * SYNC_LOST_EVENTS / 10;
+    return CLAMP(timeout, SYNC_TIMEOUT_MIN, SYNC_TIMEOUT_MAX);
+}
+
+/* Peer identifier from a JX_XXXXXX name, 0 if the name does not match */
+static uint32_t peer_id_from_ad(struct net_buf_simple *ad)
+{
+    struct net_buf_simple_state state;
+    char name[10] = {0};
+    bool found = false;
+
+    net_buf_simple_save(ad, &state);
+    while (ad->len > 1)
+    {
+        uint8_t len = net_buf_simple_pull_u8(ad);
+        if (len == 0 || len > ad->len)
+            break;
+        uint8_t type = net_buf_simple_pull_u8(ad);
+        len--;
+        if ((type == BT_DATA_NAME_COMPLETE || type == BT_DATA_NAME_SHORTENED) && len == 9)
+        {
+            memcpy(name, ad->data, len);
+            found = true;
+        }
+        net_buf_simple_pull(ad, len);
+    }
+    net_buf_simple_restore(ad, &state);
+
+    uint32_t mac_id = 0;
+    if (found && strncmp(name, "JX_", 3) == 0 && sscanf(name + 3, "%6x", &mac_id) == 1)
+    {
+        return mac_id;
+    }
+    return 0;
+}
+
+static bool peer_known(uint32_t mac_id)
+{
+    for (size_t i = 0; i < ARRAY_SIZE(slots); i++)
+    {
+        if (slots[i].mac_id == mac_id)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void scan_recv(const struct bt_le_scan_recv_info *info, struct net_buf_simple *ad)
+{
+    /* Only extended advertisers announcing a periodic train */
+    if (!tracking_enabled || info->interval == 0 || pending_sync || pending_queued)
+    {
+        return;
+    }
+
+    uint32_t mac_id = peer_id_from_ad(ad);
+    if (mac_id == 0)
+    {
+        return;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&slots_lock);
+    bool known = peer_known(mac_id);
+    k_spin_unlock(&slots_lock, key);
+    if (known || bt_le_per_adv_sync_lookup_addr(info->addr, info->sid))
+    {
+        return;
+    }
+
+    bt_addr_le_copy(&pending_param.addr, info->addr);
+    pending_param.sid = info->sid;
+    pending_param.options = BT_LE_PER_ADV_SYNC_OPT_NONE;
+    pending_param.skip = CONFIG_JUXTA_BLE_PERIODIC_SYNC_SKIP;
+    pending_param.timeout = sync_timeout();
+    pending_mac_id = mac_id;
+    pending_queued = true;
+
+    /* HCI commands are not sent from the receive path */
+    k_work_submit(&create_work);
+}
+
+static void create_work_handler(struct k_work *work)
+{
+    ARG_UNUSED(work);
+
+    if (!tracking_enabled || pending_sync)
+    {
+        pending_queued = false;
+        return;
+    }
+
+    struct bt_le_per_adv_sync *sync;
+    int ret = bt_le_per_adv_sync_create(&pending_param, &sync);
+    if (ret < 0)
+    {
+        /* -ENOMEM: all sync slots in use */
+        LOG_DBG("Sync create for %06X failed: %d", pending_mac_id, ret);
+        pending_queued = false;
+        return;
+    }
+
+    uint8_t idx = bt_le_per_adv_sync_get_index(sync);
+    k_spinlock_key_t key = k_spin_lock(&slots_lock);
+    slots[idx] = (struct peer_slot){.mac_id = pending_mac_id};
+    k_spin_unlock(&slots_lock, key);
+
+    pending_sync = sync;
+    pending_queued = false;
+    LOG_INF("📡 Syncing to peer %06X (skip %u, timeout %u0 ms)", pending_mac_id,
+            pending_param.skip, pending_param.timeout);
+}
+
+static void sync_synced(struct bt_le_per_adv_sync *sync, struct bt_le_per_adv_sync_synced_info *info)
+{
+    ARG_UNUSED(info);
+    uint8_t idx = bt_le_per_adv_sync_get_index(sync);
+
+    k_spinlock_key_t key = k_spin_lock(&slots_lock);
+    slots[idx].synced = true;
+    k_spin_unlock(&slots_lock, key);
+
+    if (sync == pending_sync)
+    {
+        pending_sync = NULL;
+    }
+    LOG_INF("📡 Synced to peer %06X", slots[idx].mac_id);
+}
+
+static void sync_term(struct bt_le_per_adv_sync *sync, const struct bt_le_per_adv_sync_term_info *info)
+{
+    uint8_t idx = bt_le_per_adv_sync_get_index(sync);
+    uint32_t mac_id;
+
+    k_spinlock_key_t key = k_spin_lock(&slots_lock);
+    mac_id = slots[idx].mac_id;
+    slots[idx] = (struct peer_slot){0};
+    k_spin_unlock(&slots_lock, key);
+
+    if (sync == pending_sync)
+    {
+        pending_sync = NULL;
+    }
+    LOG_INF("📡 Peer %06X sync ended (reason 0x%02x)", mac_id, info->reason);
+}
+
+static void sync_recv(struct bt_le_per_adv_sync *sync, const struct bt_le_per_adv_sync_recv_info *info,
+                      struct net_buf_simple *buf)
+{
+    ARG_UNUSED(buf);
+    if (info->rssi == BT_GAP_RSSI_INVALID)
+    {
+        return; /* Report for an event the controller did not receive */
+    }
+
+    uint8_t idx = bt_le_per_adv_sync_get_index(sync);
+    k_spinlock_key_t key = k_spin_lock(&slots_lock);
+    if (!slots[idx].heard || info->rssi > slots[idx].rssi)
+    {
+        slots[idx].rssi = info->rssi;
+    }
+    slots[idx].heard = true;
+    k_spin_unlock(&slots_lock, key);
+}
+
+static struct bt_le_scan_cb scan_callbacks = {
+    .recv = scan_recv,
+};
+
+static struct bt_le_per_adv_sync_cb sync_callbacks = {
+    .synced = sync_synced,
+    .term = sync_term,
+    .recv = sync_recv,
+};
+
+int juxta_peer_sync_init(const char *name)
+{
+    struct bt_le_adv_param adv_param = {
+        .id = BT_ID_DEFAULT,
+        .sid = 1, /* Legacy bursts use the default set */
+        .secondary_max_skip = 0,
+        .options = BT_LE_ADV_OPT_EXT_ADV | BT_LE_ADV_OPT_USE_IDENTITY,
+        .interval_min = EXT_ADV_INTERVAL_UNITS,
+        .interval_max = EXT_ADV_INTERVAL_UNITS,
+        .peer = NULL,
+    };
+    struct bt_le_per_adv_param per_param = {
+        .interval_min = PER_ADV_INTERVAL_UNITS,
+        .interval_max = PER_ADV_INTERVAL_UNITS,
+        .options = BT_LE_PER_ADV_OPT_NONE,
+    };
+    int ret;
+
+    per_ad[0] = (struct bt_data)BT_DATA(BT_DATA_NAME_COMPLETE, name, strlen(name));
+
+    ret = bt_le_ext_adv_create(&adv_param, NULL, &per_adv);
+    if (ret < 0)
+    {
+        LOG_ERR("Failed to create periodic advertising set: %d", ret);
+        return ret;
+    }
+
+    /* Name in the extended PDU identifies the train before syncing */
+    ret = bt_le_ext_adv_set_data(per_adv, per_ad, ARRAY_SIZE(per_ad), NULL, 0);
+    if (ret == 0)
+    {
+        ret = bt_le_per_adv_set_param(per_adv, &per_param);
+    }
+    if (ret == 0)
+    {
+        ret = bt_le_per_adv_set_data(per_adv, per_ad, ARRAY_SIZE(per_ad));
+    }
+    if (ret < 0)
+    {
+        LOG_ERR("Failed to configure periodic advertising: %d", ret);
+        return ret;
+    }
+
+    ret = bt_le_scan_cb_register(&scan_callbacks);
+    if (ret < 0)
+    {
+        LOG_ERR("Failed to register scan callbacks: %d", ret);
+        return ret;
+    }
+    bt_le_per_adv_sync_cb_register(&sync_callbacks);
+
+    LOG_INF("📡 Periodic advertising ready: %s every %d ms, sync skip %d",
+            name, CONFIG_JUXTA_BLE_PERIODIC_ADV_INTERVAL_MS, CONFIG_JUXTA_BLE_PERIODIC_SYNC_SKIP);
+    return 0;
+}
+
+int juxta_peer_sync_start(void)
+{
+    if (!per_adv)
+    {
+        return -ENODEV;
+    }
+
+    int ret = bt_le_per_adv_start(per_adv);
+    if (ret < 0 && ret != -EALREADY)
+    {
+        LOG_ERR("Failed to start periodic advertising: %d", ret);
+        return ret;
+    }
+
+    ret = bt_le_ext_adv_start(per_adv, BT_LE_EXT_ADV_START_DEFAULT);
+    if (ret < 0 && ret != -EALREADY)
+    {
+        LOG_ERR("Failed to start extended advertising: %d", ret);
+        return ret;
+    }
+
+    tracking_enabled = true;
+    LOG_INF("📡 Periodic advertising started");
+    return 0;
+}
+
+void juxta_peer_sync_stop(void)
+{
+    tracking_enabled = false;
+    k_work_cancel(&create_work);
+    pending_queued = false;
+
+    if (per_adv)
+    {
+        (void)bt_le_ext_adv_stop(per_adv);
+        (void)bt_le_per_adv_stop(per_adv);
+    }
+
+    /* Deleting a sync does not raise term; clear the slots here */
+    for (size_t i = 0; i < ARRAY_SIZE(slots); i++)
+    {
+        if (slots[i].mac_id)
+        {
+            struct bt_le_per_adv_sync *sync = bt_le_per_adv_sync_lookup_index(i);
+            if (sync)
+            {
+                (void)bt_le_per_adv_sync_delete(sync);
+            }
+        }
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&slots_lock);
+    memset(slots, 0, sizeof(slots));
+    k_spin_unlock(&slots_lock, key);
+    pending_sync = NULL;
+
+    LOG_INF("📡 Periodic advertising stopped, peer syncs dropped");
+}
+
+void juxta_peer_sync_scan_ended(void)
+{
+    k_work_cancel(&create_work);
+    pending_queued = false;
+
+    struct bt_le_per_adv_sync *sync = pending_sync;
+    if (!sync)
+    {
+        return;
+    }
+
+    uint8_t idx = bt_le_per_adv_sync_get_index(sync);
+    if (bt_le_per_adv_sync_delete(sync) == 0)
+    {
+        k_spinlock_key_t key = k_spin_lock(&slots_lock);
+        slots[idx] = (struct peer_slot){0};
+        k_spin_unlock(&slots_lock, key);
+        pending_sync = NULL;
+    }
+}
+
+uint8_t juxta_peer_sync_collect(uint32_t *ids, int8_t *rssi, uint8_t max)
+{
+    uint8_t count = 0;
+
+    k_spinlock_key_t key = k_spin_lock(&slots_lock);
+    for (size_t i = 0; i < ARRAY_SIZE(slots) && count < max; i++)
+    {
+        if (slots[i].heard)
+        {
+            ids[count] = slots[i].mac_id;
+            rssi[count] = slots[i].rssi;
+            count++;
+            slots[i].heard = false;
+        }
+    }
+    k_spin_unlock(&slots_lock, key);
+
+    return count;
+}
+
+uint8_t juxta_peer_sync_count(void)
+{
+    uint8_t count = 0;
+
+    k_spinlock_key_t key = k_spin_lock(&slots_lock);
+    for (size_t i = 0; i < ARRAY_SIZE(slots); i++)
+    {
+        if (slots[i].synced)
+        {
+            count++;
+        }
+    }
+    k_spin_unlock(&slots_lock, key);
+
+    return count;
+}
@@ -0,0 +1,70 @@
+/*
+ * JUXTA Periodic Advertising Peer Tracking Header
+ * Each device runs a low-rate periodic advertising train. When a scan
+ * burst hears a peer's train, the device syncs to it and keeps following
+ * it with short receive windows, so known peers are tracked between scan
+ * bursts without blind scanning.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef JUXTA_PEER_SYNC_H_
+#define JUXTA_PEER_SYNC_H_
+
+#include <zephyr/kernel.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Create the periodic advertising set and register the callbacks
+     *
+     * @param name Advertising name (JX_XXXXXX) carried by the train
+     * @return 0 on success, negative error code on failure
+     */
+    int juxta_peer_sync_init(const char *name);
+
+    /**
+     * @brief Start the periodic advertising train and allow new syncs
+     *
+     * @return 0 on success, negative error code on failure
+     */
+    int juxta_peer_sync_start(void);
+
+    /**
+     * @brief Stop the train and drop all peer syncs
+     */
+    void juxta_peer_sync_stop(void);
+
+    /**
+     * @brief Cancel a sync still being created when a scan burst ends
+     *
+     * Syncs are only established while the scanner runs; a pending create
+     * would otherwise hold the only create slot until the next burst.
+     */
+    void juxta_peer_sync_scan_ended(void);
+
+    /**
+     * @brief Collect the synced peers heard since the last call
+     *
+     * @param ids Output peer identifiers
+     * @param rssi Output strongest RSSI per peer
+     * @param max Capacity of both arrays
+     * @return Number of peers written
+     */
+    uint8_t juxta_peer_sync_collect(uint32_t *ids, int8_t *rssi, uint8_t max);
+
+    /**
+     * @brief Number of peers currently synced
+     */
+    uint8_t juxta_peer_sync_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JUXTA_PEER_SYNC_H_ */
@@ -0,0 +1,207 @@
+/*
+ * JUXTA Per-Burst RSSI Series Implementation
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "rssi_series.h"
+#include <string.h>
+
+#define STEP_MIN -8
+#define STEP_MAX 7
+
+static int8_t clamp_rssi(int value)
+{
+    return (value < INT8_MIN) ? INT8_MIN : (value > INT8_MAX) ? INT8_MAX : (int8_t)value;
+}
+
+/* Append one sample; steps track the decoded value so rounding errors never accumulate */
+static void encode_sample(struct juxta_rssi_series_peer *peer, uint8_t burst)
+{
+    if (peer->samples == 0)
+    {
+        peer->data[0] = (uint8_t)peer->burst_rssi;
+        peer->decoded = peer->burst_rssi;
+    }
+    else
+    {
+        int diff = peer->burst_rssi - peer->decoded;
+        int step = (diff >= 0) ? (diff + JUXTA_RSSI_SERIES_STEP_DB / 2) / JUXTA_RSSI_SERIES_STEP_DB
+                               : -((-diff + JUXTA_RSSI_SERIES_STEP_DB / 2) / JUXTA_RSSI_SERIES_STEP_DB);
+        step = (step < STEP_MIN) ? STEP_MIN : (step > STEP_MAX) ? STEP_MAX : step;
+        peer->decoded = clamp_rssi(peer->decoded + step * JUXTA_RSSI_SERIES_STEP_DB);
+
+        uint8_t nibble = (uint8_t)step & 0x0F;
+        uint8_t k = peer->samples - 1;
+        uint8_t *byte = &peer->data[2 + k / 2];
+        *byte = (k % 2 == 0) ? (uint8_t)(nibble << 4) : (uint8_t)(*byte | nibble);
+    }
+
+    peer->data[1] |= (uint8_t)(1U << burst);
+    peer->samples++;
+    peer->in_burst = false;
+}
+
+static void close_burst(struct juxta_rssi_series *series)
+{
+    for (uint8_t i = 0; i < series->peer_count; i++)
+    {
+        if (series->peers[i].in_burst)
+        {
+            encode_sample(&series->peers[i], series->burst_count);
+        }
+    }
+    series->burst_count++;
+}
+
+void juxta_rssi_series_reset(struct juxta_rssi_series *series)
+{
+    series->burst_count = 0;
+    series->peer_count = 0;
+    series->tail_open = false;
+}
+
+bool juxta_rssi_series_observe(struct juxta_rssi_series *series, uint32_t mac_id, int8_t rssi)
+{
+    struct juxta_rssi_series_peer *peer = NULL;
+
+    for (uint8_t i = 0; i < series->peer_count; i++)
+    {
+        if (series->peers[i].mac_id == mac_id)
+        {
+            peer = &series->peers[i];
+            break;
+        }
+    }
+
+    if (!peer)
+    {
+        if (series->peer_count >= JUXTA_RSSI_SERIES_MAX_PEERS)
+        {
+            return false;
+        }
+        peer = &series->peers[series->peer_count++];
+        memset(peer, 0, sizeof(*peer));
+        peer->mac_id = mac_id;
+    }
+
+    if (!peer->in_burst || rssi > peer->burst_rssi)
+    {
+        peer->burst_rssi = rssi;
+    }
+    peer->in_burst = true;
+    return true;
+}
+
+void juxta_rssi_series_end_burst(struct juxta_rssi_series *series)
+{
+    /* The last bitmap position stays open and collects any further bursts */
+    if (series->burst_count < JUXTA_RSSI_SERIES_MAX_BURSTS - 1)
+    {
+        close_burst(series);
+    }
+    else
+    {
+        series->tail_open = true;
+    }
+}
+
+void juxta_rssi_series_finish(struct juxta_rssi_series *series)
+{
+    /* Merged bursts count once even if none of them heard a peer */
+    if (series->tail_open)
+    {
+        series->tail_open = false;
+        close_burst(series);
+        return;
+    }
+
+    for (uint8_t i = 0; i < series->peer_count; i++)
+    {
+        if (series->peers[i].in_burst)
+        {
+            close_burst(series);
+            return;
+        }
+    }
+}
+
+size_t juxta_rssi_series_peer_size(const struct juxta_rssi_series_peer *peer)
+{
+    return 2 + peer->samples / 2;
+}
+
+int juxta_rssi_series_serialize(const struct juxta_rssi_series *series, uint8_t (*mac_ids)[3],
+                                uint8_t *payload, size_t size)
+{
+    size_t offset = 0;
+
+    for (uint8_t i = 0; i < series->peer_count; i++)
+    {
+        const struct juxta_rssi_series_peer *peer = &series->peers[i];
+        size_t len = juxta_rssi_series_peer_size(peer);
+        if (offset + len > size)
+        {
+            return -1;
+        }
+
+        mac_ids[i][0] = (peer->mac_id >> 16) & 0xFF;
+        mac_ids[i][1] = (peer->mac_id >> 8) & 0xFF;
+        mac_ids[i][2] = peer->mac_id & 0xFF;
+        memcpy(&payload[offset], peer->data, len);
+        offset += len;
+    }
+
+    return (int)offset;
+}
+
+int juxta_rssi_series_decode_peer(const uint8_t *data, size_t size, uint8_t burst_count,
+                                  int8_t rssi[JUXTA_RSSI_SERIES_MAX_BURSTS], uint8_t *bitmap)
+{
+    if (size < 2 || burst_count == 0 || burst_count > JUXTA_RSSI_SERIES_MAX_BURSTS)
+    {
+        return -1;
+    }
+
+    uint8_t bits = data[1];
+    if (bits == 0 || (burst_count < 8 && (bits >> burst_count) != 0))
+    {
+        return -1;
+    }
+
+    uint8_t samples = 0;
+    for (uint8_t b = 0; b < burst_count; b++)
+    {
+        samples += (bits >> b) & 1U;
+    }
+    size_t len = 2 + samples / 2;
+    if (size < len)
+    {
+        return -1;
+    }
+
+    int8_t value = (int8_t)data[0];
+    uint8_t k = 0;
+    bool first = true;
+    for (uint8_t b = 0; b < burst_count; b++)
+    {
+        if (!((bits >> b) & 1U))
+        {
+            continue;
+        }
+        if (!first)
+        {
+            uint8_t byte = data[2 + k / 2];
+            uint8_t nibble = (k % 2 == 0) ? (byte >> 4) : (byte & 0x0F);
+            int step = (nibble & 0x08) ? (int)nibble - 16 : (int)nibble;
+            value = clamp_rssi(value + step * JUXTA_RSSI_SERIES_STEP_DB);
+            k++;
+        }
+        rssi[b] = value;
+        first = false;
+    }
+
+    *bitmap = bits;
+    return (int)len;
+}
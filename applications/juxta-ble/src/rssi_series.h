@@ -0,0 +1,109 @@
+/*
+ * JUXTA Per-Burst RSSI Series Header
+ * Keeps the strongest RSSI of each peer per scan burst for one minute and
+ * delta-codes it as the bursts close: the first sample in full, then one
+ * 4-bit step per later sample, with a bitmap of the bursts that heard the
+ * peer. The encoded bytes are ready when the minute ends. No Zephyr
+ * dependencies.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef JUXTA_RSSI_SERIES_H_
+#define JUXTA_RSSI_SERIES_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define JUXTA_RSSI_SERIES_MAX_PEERS 64
+#define JUXTA_RSSI_SERIES_MAX_BURSTS 8 /* Bits in the presence bitmap */
+#define JUXTA_RSSI_SERIES_STEP_DB 2    /* dB per delta step: -16..+14 dB per burst */
+
+/* First RSSI + bitmap + one nibble per later sample */
+#define JUXTA_RSSI_SERIES_PEER_MAX_BYTES (2 + JUXTA_RSSI_SERIES_MAX_BURSTS / 2)
+
+    struct juxta_rssi_series_peer
+    {
+        uint32_t mac_id;
+        int8_t burst_rssi; /* Strongest RSSI in the open burst */
+        bool in_burst;     /* Heard in the open burst */
+        int8_t decoded;    /* Last value as a decoder will see it */
+        uint8_t samples;   /* Samples encoded so far */
+        uint8_t data[JUXTA_RSSI_SERIES_PEER_MAX_BYTES];
+    };
+
+    struct juxta_rssi_series
+    {
+        uint8_t burst_count; /* Bursts closed this minute */
+        uint8_t peer_count;
+        bool tail_open;      /* Bursts ended into the last bitmap position */
+        struct juxta_rssi_series_peer peers[JUXTA_RSSI_SERIES_MAX_PEERS];
+    };
+
+    /**
+     * @brief Start a new minute
+     */
+    void juxta_rssi_series_reset(struct juxta_rssi_series *series);
+
+    /**
+     * @brief Record one advertisement from a peer in the open burst
+     *
+     * @return false if the peer table is full
+     */
+    bool juxta_rssi_series_observe(struct juxta_rssi_series *series, uint32_t mac_id, int8_t rssi);
+
+    /**
+     * @brief Close the open burst and encode its samples
+     *
+     * Bursts after the last bitmap position are merged into it (strongest
+     * RSSI wins) and encoded by juxta_rssi_series_finish().
+     */
+    void juxta_rssi_series_end_burst(struct juxta_rssi_series *series);
+
+    /**
+     * @brief Encode samples still open at the end of the minute
+     */
+    void juxta_rssi_series_finish(struct juxta_rssi_series *series);
+
+    /**
+     * @brief Encoded size of one peer: first RSSI, bitmap and packed steps
+     */
+    size_t juxta_rssi_series_peer_size(const struct juxta_rssi_series_peer *peer);
+
+    /**
+     * @brief Copy the encoded minute out in record order
+     *
+     * @param series Finished series
+     * @param mac_ids Output 3-byte MAC IDs, one per peer
+     * @param payload Output per-peer encodings, back to back
+     * @param size Capacity of @p payload
+     * @return Payload length, or -1 if @p size is too small
+     */
+    int juxta_rssi_series_serialize(const struct juxta_rssi_series *series, uint8_t (*mac_ids)[3],
+                                    uint8_t *payload, size_t size);
+
+    /**
+     * @brief Decode one peer's encoding
+     *
+     * @param data Encoded peer
+     * @param size Bytes available
+     * @param burst_count Bursts in the record
+     * @param rssi Output per burst, only valid where the bitmap bit is set
+     * @param bitmap Output presence bitmap
+     * @return Bytes consumed, or -1 on malformed input
+     */
+    int juxta_rssi_series_decode_peer(const uint8_t *data, size_t size, uint8_t burst_count,
+                                      int8_t rssi[JUXTA_RSSI_SERIES_MAX_BURSTS], uint8_t *bitmap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JUXTA_RSSI_SERIES_H_ */
@@ -0,0 +1,141 @@
+/*
+ * JUXTA Scheduler Dispatch Implementation
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sched_dispatch.h"
+#include <stddef.h>
+
+/* Arm the one-shot timer for the earliest required wakeup. Caller holds the lock. */
+static void rearm_locked(struct juxta_sched_dispatch *disp)
+{
+    uint32_t wake_ms;
+    if (!juxta_sched_next_wakeup(&disp->sched, &wake_ms))
+    {
+        disp->port->timer_stop();
+        return;
+    }
+
+    int32_t delay_ms = (int32_t)(wake_ms - disp->port->now_ms());
+    disp->port->timer_start(delay_ms > 0 ? (uint32_t)delay_ms : 0);
+}
+
+static void run_event(struct juxta_sched_dispatch *disp, uint32_t due, enum juxta_sched_event event,
+                      uint32_t now_ms)
+{
+    if ((due & JUXTA_SCHED_EVENT_BIT(event)) && disp->handlers->event[event])
+    {
+        disp->handlers->event[event](now_ms);
+    }
+}
+
+void juxta_sched_dispatch_init(struct juxta_sched_dispatch *disp, const uint32_t *slack_ms,
+                               const struct juxta_sched_port *port,
+                               const struct juxta_sched_handlers *handlers)
+{
+    juxta_sched_init(&disp->sched, slack_ms);
+    disp->port = port;
+    disp->handlers = handlers;
+    port->timer_stop();
+}
+
+void juxta_sched_dispatch_at(struct juxta_sched_dispatch *disp, enum juxta_sched_event event,
+                             uint32_t deadline_ms)
+{
+    uint32_t key = disp->port->lock();
+    juxta_sched_at(&disp->sched, event, deadline_ms);
+    rearm_locked(disp);
+    disp->port->unlock(key);
+}
+
+void juxta_sched_dispatch_cancel(struct juxta_sched_dispatch *disp, uint32_t events)
+{
+    uint32_t key = disp->port->lock();
+    for (int e = 0; e < JUXTA_SCHED_EVENT_COUNT; e++)
+    {
+        if (events & JUXTA_SCHED_EVENT_BIT(e))
+        {
+            juxta_sched_cancel(&disp->sched, (enum juxta_sched_event)e);
+        }
+    }
+    rearm_locked(disp);
+    disp->port->unlock(key);
+}
+
+void juxta_sched_dispatch_set_slack(struct juxta_sched_dispatch *disp, enum juxta_sched_event event,
+                                    uint32_t slack_ms)
+{
+    uint32_t key = disp->port->lock();
+    juxta_sched_set_slack(&disp->sched, event, slack_ms);
+    disp->port->unlock(key);
+}
+
+bool juxta_sched_dispatch_pending(struct juxta_sched_dispatch *disp, enum juxta_sched_event event,
+                                  uint32_t *deadline_ms)
+{
+    uint32_t key = disp->port->lock();
+    bool pending = juxta_sched_pending(&disp->sched, event, deadline_ms);
+    disp->port->unlock(key);
+    return pending;
+}
+
+uint32_t juxta_sched_dispatch_run(struct juxta_sched_dispatch *disp)
+{
+    const struct juxta_sched_handlers *h = disp->handlers;
+    uint32_t now_ms = disp->port->now_ms();
+
+    uint32_t key = disp->port->lock();
+    uint32_t due = juxta_sched_collect(&disp->sched, now_ms);
+    disp->port->unlock(key);
+
+    run_event(disp, due, JUXTA_SCHED_HEALTH_CHECK, now_ms);
+    run_event(disp, due, JUXTA_SCHED_LED_BLINK, now_ms);
+    run_event(disp, due, JUXTA_SCHED_BATTERY_SAMPLE, now_ms);
+
+    uint32_t state_due = due & JUXTA_SCHED_STATE_EVENTS;
+    if (state_due && h->state_ready && !h->state_ready())
+    {
+        if (h->state_dropped)
+        {
+            h->state_dropped(state_due);
+        }
+    }
+    else if (state_due)
+    {
+        if (h->state_begin)
+        {
+            h->state_begin(now_ms, state_due);
+        }
+
+        run_event(disp, due, JUXTA_SCHED_MINUTE_LOG, now_ms);
+
+        if (due & JUXTA_SCHED_EVENT_BIT(JUXTA_SCHED_BURST_END))
+        {
+            /* Burst end re-plans both burst starts with the inter-burst gap */
+            run_event(disp, due, JUXTA_SCHED_BURST_END, now_ms);
+        }
+        else
+        {
+            run_event(disp, due, JUXTA_SCHED_SCAN_BURST, now_ms);
+            run_event(disp, due, JUXTA_SCHED_ADV_BURST, now_ms);
+        }
+
+        if (h->state_end)
+        {
+            h->state_end();
+        }
+    }
+
+    run_event(disp, due, JUXTA_SCHED_ADC_TRIGGER, now_ms);
+
+    /* Handlers that decline (LED stopped, events dropped, burst deferred by a
+     * connection) schedule nothing, and collect() already took the heap root,
+     * so the timer must be re-armed here for whatever is still pending */
+    key = disp->port->lock();
+    rearm_locked(disp);
+    disp->port->unlock(key);
+
+    return due;
+}
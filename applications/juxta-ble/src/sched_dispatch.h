@@ -0,0 +1,116 @@
+/*
+ * JUXTA Scheduler Dispatch Header
+ * The timer-driven dispatch pass over the event scheduler: collect the due
+ * events, route them to their handlers, then re-arm the one-shot wakeup
+ * timer. The kernel timer, lock and clock come in through a port so the
+ * same pass runs in the firmware and on the host.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef JUXTA_SCHED_DISPATCH_H_
+#define JUXTA_SCHED_DISPATCH_H_
+
+#include "scheduler.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Events that drive the BLE/minute state machine; they wait for state_ready */
+#define JUXTA_SCHED_STATE_EVENTS                     \
+    (JUXTA_SCHED_EVENT_BIT(JUXTA_SCHED_MINUTE_LOG) | \
+     JUXTA_SCHED_EVENT_BIT(JUXTA_SCHED_BURST_END) |  \
+     JUXTA_SCHED_EVENT_BIT(JUXTA_SCHED_SCAN_BURST) | \
+     JUXTA_SCHED_EVENT_BIT(JUXTA_SCHED_ADV_BURST))
+
+    /**
+     * @brief Platform hooks: clock, heap lock and the one-shot wakeup timer
+     */
+    struct juxta_sched_port
+    {
+        uint32_t (*now_ms)(void);
+        uint32_t (*lock)(void); /* Enter the heap critical section, return its key */
+        void (*unlock)(uint32_t key);
+        void (*timer_start)(uint32_t delay_ms); /* (Re)start the one-shot wakeup */
+        void (*timer_stop)(void);
+    };
+
+    /**
+     * @brief Application handlers
+     *
+     * Each event handler runs without the heap lock held and may schedule or
+     * cancel events. NULL entries are skipped.
+     */
+    struct juxta_sched_handlers
+    {
+        void (*event[JUXTA_SCHED_EVENT_COUNT])(uint32_t now_ms);
+        bool (*state_ready)(void);                          /* NULL: always ready */
+        void (*state_begin)(uint32_t now_ms, uint32_t due); /* Before the state events of a pass */
+        void (*state_end)(void);                            /* After the state events of a pass */
+        void (*state_dropped)(uint32_t events);             /* State events dropped while not ready */
+    };
+
+    struct juxta_sched_dispatch
+    {
+        struct juxta_sched sched;
+        const struct juxta_sched_port *port;
+        const struct juxta_sched_handlers *handlers;
+    };
+
+    /**
+     * @brief Initialize with nothing pending and the timer stopped
+     *
+     * @param disp Dispatcher state
+     * @param slack_ms Per-event slack in ms, or NULL for none
+     * @param port Platform hooks
+     * @param handlers Application handlers
+     */
+    void juxta_sched_dispatch_init(struct juxta_sched_dispatch *disp, const uint32_t *slack_ms,
+                                   const struct juxta_sched_port *port,
+                                   const struct juxta_sched_handlers *handlers);
+
+    /**
+     * @brief Schedule an event and re-arm the timer
+     */
+    void juxta_sched_dispatch_at(struct juxta_sched_dispatch *disp, enum juxta_sched_event event,
+                                 uint32_t deadline_ms);
+
+    /**
+     * @brief Cancel a set of events (JUXTA_SCHED_EVENT_BIT() mask) and re-arm the timer
+     */
+    void juxta_sched_dispatch_cancel(struct juxta_sched_dispatch *disp, uint32_t events);
+
+    /**
+     * @brief Change the slack of an event type (next time it is scheduled)
+     */
+    void juxta_sched_dispatch_set_slack(struct juxta_sched_dispatch *disp, enum juxta_sched_event event,
+                                        uint32_t slack_ms);
+
+    /**
+     * @brief Get the deadline of a pending event
+     *
+     * @return true if the event is pending
+     */
+    bool juxta_sched_dispatch_pending(struct juxta_sched_dispatch *disp, enum juxta_sched_event event,
+                                      uint32_t *deadline_ms);
+
+    /**
+     * @brief Run one dispatch pass (the timer's work item)
+     *
+     * Order: health check, LED blink, battery sample, then the state events
+     * (minute log; burst end, or else scan and advertising burst starts),
+     * then the ADC trigger. The timer is re-armed for the earliest pending
+     * event at the end of every pass, whatever the handlers did.
+     *
+     * @return Bitmask of the events collected in this pass
+     */
+    uint32_t juxta_sched_dispatch_run(struct juxta_sched_dispatch *disp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JUXTA_SCHED_DISPATCH_H_ */
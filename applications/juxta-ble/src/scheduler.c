@@ -0,0 +1,176 @@
+/*
+ * JUXTA Event Scheduler Implementation
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "scheduler.h"
+#include <string.h>
+
+/* Wrap-safe ordering for 32-bit millisecond uptime */
+static inline bool time_before(uint32_t a, uint32_t b)
+{
+    return (int32_t)(a - b) < 0;
+}
+
+static void heap_swap(struct juxta_sched *sched, uint8_t a, uint8_t b)
+{
+    struct juxta_sched_entry tmp = sched->heap[a];
+    sched->heap[a] = sched->heap[b];
+    sched->heap[b] = tmp;
+    sched->slot[sched->heap[a].event] = (int8_t)a;
+    sched->slot[sched->heap[b].event] = (int8_t)b;
+}
+
+static void heap_sift_up(struct juxta_sched *sched, uint8_t i)
+{
+    while (i > 0)
+    {
+        uint8_t parent = (i - 1) / 2;
+        if (!time_before(sched->heap[i].expiry_ms, sched->heap[parent].expiry_ms))
+        {
+            break;
+        }
+        heap_swap(sched, i, parent);
+        i = parent;
+    }
+}
+
+static void heap_sift_down(struct juxta_sched *sched, uint8_t i)
+{
+    for (;;)
+    {
+        uint8_t left = 2 * i + 1;
+        uint8_t right = left + 1;
+        uint8_t smallest = i;
+
+        if (left < sched->size && time_before(sched->heap[left].expiry_ms, sched->heap[smallest].expiry_ms))
+        {
+            smallest = left;
+        }
+        if (right < sched->size && time_before(sched->heap[right].expiry_ms, sched->heap[smallest].expiry_ms))
+        {
+            smallest = right;
+        }
+        if (smallest == i)
+        {
+            break;
+        }
+        heap_swap(sched, i, smallest);
+        i = smallest;
+    }
+}
+
+static void heap_remove(struct juxta_sched *sched, uint8_t i)
+{
+    uint8_t last = sched->size - 1;
+    uint8_t event = sched->heap[i].event;
+
+    if (i != last)
+    {
+        heap_swap(sched, i, last);
+    }
+    sched->size--;
+    sched->slot[event] = -1;
+
+    if (i < sched->size)
+    {
+        heap_sift_down(sched, i);
+        heap_sift_up(sched, i);
+    }
+}
+
+void juxta_sched_init(struct juxta_sched *sched, const uint32_t *slack_ms)
+{
+    memset(sched, 0, sizeof(*sched));
+    for (uint8_t i = 0; i < JUXTA_SCHED_EVENT_COUNT; i++)
+    {
+        sched->slot[i] = -1;
+        sched->slack_ms[i] = slack_ms ? slack_ms[i] : 0;
+    }
+}
+
+void juxta_sched_at(struct juxta_sched *sched, enum juxta_sched_event event, uint32_t deadline_ms)
+{
+    if (event >= JUXTA_SCHED_EVENT_COUNT)
+    {
+        return;
+    }
+
+    juxta_sched_cancel(sched, event);
+
+    uint8_t i = sched->size++;
+    sched->heap[i].deadline_ms = deadline_ms;
+    sched->heap[i].expiry_ms = deadline_ms + sched->slack_ms[event];
+    sched->heap[i].event = (uint8_t)event;
+    sched->slot[event] = (int8_t)i;
+    heap_sift_up(sched, i);
+}
+
+void juxta_sched_set_slack(struct juxta_sched *sched, enum juxta_sched_event event, uint32_t slack_ms)
+{
+    if (event < JUXTA_SCHED_EVENT_COUNT)
+    {
+        sched->slack_ms[event] = slack_ms;
+    }
+}
+
+void juxta_sched_cancel(struct juxta_sched *sched, enum juxta_sched_event event)
+{
+    if (event >= JUXTA_SCHED_EVENT_COUNT || sched->slot[event] < 0)
+    {
+        return;
+    }
+    heap_remove(sched, (uint8_t)sched->slot[event]);
+}
+
+bool juxta_sched_pending(const struct juxta_sched *sched, enum juxta_sched_event event,
+                         uint32_t *deadline_ms)
+{
+    if (event >= JUXTA_SCHED_EVENT_COUNT || sched->slot[event] < 0)
+    {
+        return false;
+    }
+    if (deadline_ms)
+    {
+        *deadline_ms = sched->heap[sched->slot[event]].deadline_ms;
+    }
+    return true;
+}
+
+bool juxta_sched_next_wakeup(const struct juxta_sched *sched, uint32_t *wake_ms)
+{
+    if (sched->size == 0)
+    {
+        return false;
+    }
+    *wake_ms = sched->heap[0].expiry_ms;
+    return true;
+}
+
+uint32_t juxta_sched_collect(struct juxta_sched *sched, uint32_t now_ms)
+{
+    uint32_t due = 0;
+
+    /* At most one entry per event type, so a linear pass is cheapest */
+    uint8_t i = 0;
+    while (i < sched->size)
+    {
+        if (!time_before(now_ms, sched->heap[i].deadline_ms))
+        {
+            due |= JUXTA_SCHED_EVENT_BIT(sched->heap[i].event);
+            heap_remove(sched, i);
+            i = 0; /* Removal reorders the heap; rescan */
+            continue;
+        }
+        i++;
+    }
+
+    if (due)
+    {
+        sched->wakeups++;
+        sched->dispatched += (uint32_t)__builtin_popcount(due);
+    }
+    return due;
+}
@@ -0,0 +1,121 @@
+/*
+ * JUXTA Event Scheduler Header
+ * Deadline min-heap with one pending entry per typed event and per-event
+ * slack for wakeup coalescing. No Zephyr dependencies: the caller supplies
+ * the millisecond clock, so schedules can be replayed on the host.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef JUXTA_SCHEDULER_H_
+#define JUXTA_SCHEDULER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Typed scheduler events (also the dispatch priority, lowest first)
+     */
+    enum juxta_sched_event
+    {
+        JUXTA_SCHED_HEALTH_CHECK = 0, /* Work queue / battery health check */
+        JUXTA_SCHED_LED_BLINK,        /* Connectable advertising LED toggle */
+        JUXTA_SCHED_MINUTE_LOG,       /* Minute record at the minute boundary */
+        JUXTA_SCHED_ADC_TRIGGER,      /* ADC_ONLY capture service */
+        JUXTA_SCHED_BURST_END,        /* End of the active adv/scan burst */
+        JUXTA_SCHED_SCAN_BURST,       /* Start of the next scan burst */
+        JUXTA_SCHED_ADV_BURST,        /* Start of the next advertising burst */
+        JUXTA_SCHED_BATTERY_SAMPLE,   /* Background battery sample (radio idle) */
+        JUXTA_SCHED_EVENT_COUNT
+    };
+
+#define JUXTA_SCHED_EVENT_BIT(evt) (1U << (evt))
+
+    struct juxta_sched_entry
+    {
+        uint32_t deadline_ms; /* Earliest time the event may run */
+        uint32_t expiry_ms;   /* Latest time the event may run (deadline + slack) */
+        uint8_t event;
+    };
+
+    /**
+     * @brief Scheduler state
+     *
+     * The heap is ordered by expiry so the root is the next required wakeup.
+     * On wakeup every pending event whose deadline has passed runs in the
+     * same pass, which folds nearby wakeups into one.
+     */
+    struct juxta_sched
+    {
+        struct juxta_sched_entry heap[JUXTA_SCHED_EVENT_COUNT];
+        int8_t slot[JUXTA_SCHED_EVENT_COUNT]; /* Heap index per event, -1 if idle */
+        uint32_t slack_ms[JUXTA_SCHED_EVENT_COUNT];
+        uint8_t size;
+        uint32_t wakeups;    /* Collect passes that dispatched at least one event */
+        uint32_t dispatched; /* Events dispatched */
+    };
+
+    /**
+     * @brief Initialize an empty scheduler
+     *
+     * @param sched Scheduler state
+     * @param slack_ms Per-event slack in ms (JUXTA_SCHED_EVENT_COUNT entries), or NULL for none
+     */
+    void juxta_sched_init(struct juxta_sched *sched, const uint32_t *slack_ms);
+
+    /**
+     * @brief Schedule an event, replacing any pending instance
+     *
+     * @param sched Scheduler state
+     * @param event Event type
+     * @param deadline_ms Absolute time in ms (wrap-safe)
+     */
+    void juxta_sched_at(struct juxta_sched *sched, enum juxta_sched_event event, uint32_t deadline_ms);
+
+    /**
+     * @brief Change the slack of an event type
+     *
+     * Takes effect the next time the event is scheduled.
+     */
+    void juxta_sched_set_slack(struct juxta_sched *sched, enum juxta_sched_event event, uint32_t slack_ms);
+
+    /**
+     * @brief Cancel a pending event (no-op if not pending)
+     */
+    void juxta_sched_cancel(struct juxta_sched *sched, enum juxta_sched_event event);
+
+    /**
+     * @brief Get the deadline of a pending event
+     *
+     * @return true if the event is pending
+     */
+    bool juxta_sched_pending(const struct juxta_sched *sched, enum juxta_sched_event event,
+                             uint32_t *deadline_ms);
+
+    /**
+     * @brief Get the time the next wakeup is required
+     *
+     * @return false if nothing is pending
+     */
+    bool juxta_sched_next_wakeup(const struct juxta_sched *sched, uint32_t *wake_ms);
+
+    /**
+     * @brief Remove and return all events due at @p now_ms
+     *
+     * @param sched Scheduler state
+     * @param now_ms Current time in ms
+     * @return Bitmask of JUXTA_SCHED_EVENT_BIT() for the due events
+     */
+    uint32_t juxta_sched_collect(struct juxta_sched *sched, uint32_t now_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JUXTA_SCHEDULER_H_ */
@@ -0,0 +1,101 @@
+/*
+ * JUXTA Scratch Arena Implementation
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "scratch.h"
+#include "adc_pipeline.h"
+#include "ble_service.h"
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(juxta_scratch, LOG_LEVEL_INF);
+
+#define SCRATCH_ALIGN 4
+
+/*
+ * Largest scope of each user. Scopes of different users are serialized by
+ * the arena lock, so the arena only has to fit the biggest one. Add a
+ * budget here when moving another buffer onto the arena.
+ */
+#define SCRATCH_ADC_EVENT_BYTES \
+    (ADC_PIPELINE_CHANNELS * ADC_PIPELINE_WINDOW_MAX * (sizeof(int16_t) + sizeof(uint8_t)))
+#define SCRATCH_FILE_CHUNK_BYTES JUXTA_FILE_TRANSFER_HEX_CHUNK_SIZE
+
+/* Each allocation may lose up to SCRATCH_ALIGN - 1 bytes to alignment */
+#define SCRATCH_ADC_EVENT_ALLOCS 2
+#define SCRATCH_SIZE \
+    ROUND_UP(MAX(SCRATCH_ADC_EVENT_BYTES, SCRATCH_FILE_CHUNK_BYTES) + SCRATCH_ADC_EVENT_ALLOCS * SCRATCH_ALIGN, \
+             SCRATCH_ALIGN)
+
+static uint8_t arena[SCRATCH_SIZE] __aligned(SCRATCH_ALIGN);
+static K_MUTEX_DEFINE(scratch_lock);
+static size_t used;
+static size_t high_water;
+static uint32_t scopes;
+static uint32_t contended;
+static uint32_t alloc_failures;
+
+int juxta_scratch_begin(struct juxta_scratch_scope *scope, k_timeout_t timeout)
+{
+    bool waited = false;
+
+    if (k_mutex_lock(&scratch_lock, K_NO_WAIT) != 0)
+    {
+        waited = true;
+        if (k_mutex_lock(&scratch_lock, timeout) != 0)
+        {
+            return -EBUSY;
+        }
+    }
+
+    scope->mark = used;
+    scopes++;
+    if (waited)
+    {
+        contended++;
+    }
+    return 0;
+}
+
+void *juxta_scratch_alloc(struct juxta_scratch_scope *scope, size_t size)
+{
+    ARG_UNUSED(scope);
+    __ASSERT(scratch_lock.owner == k_current_get(), "scratch alloc outside a scope");
+
+    size_t start = ROUND_UP(used, SCRATCH_ALIGN);
+    if (size > sizeof(arena) - start)
+    {
+        alloc_failures++;
+        LOG_ERR("🧮 Scratch arena full: %zu bytes requested, %zu of %zu in use",
+                size, used, sizeof(arena));
+        return NULL;
+    }
+
+    used = start + size;
+    high_water = MAX(high_water, used);
+    return &arena[start];
+}
+
+void juxta_scratch_end(struct juxta_scratch_scope *scope)
+{
+    used = scope->mark;
+    k_mutex_unlock(&scratch_lock);
+}
+
+size_t juxta_scratch_size(void)
+{
+    return sizeof(arena);
+}
+
+size_t juxta_scratch_high_water(void)
+{
+    return high_water;
+}
+
+void juxta_scratch_log(void)
+{
+    LOG_INF("🧮 Scratch arena: %zu / %zu bytes peak, %u scopes (%u waited), %u failed allocs",
+            high_water, sizeof(arena), scopes, contended, alloc_failures);
+}
@@ -0,0 +1,74 @@
+/*
+ * JUXTA Scratch Arena Header
+ * One shared, statically sized arena for large transient buffers whose
+ * users never need them at the same time (ADC event extraction and
+ * scaling, file transfer chunks). A scope owns the whole arena; buffers
+ * are bump-allocated inside it and all released when the scope ends.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef JUXTA_SCRATCH_H_
+#define JUXTA_SCRATCH_H_
+
+#include <zephyr/kernel.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief An open scratch scope (allocation mark to roll back to)
+     */
+    struct juxta_scratch_scope
+    {
+        size_t mark;
+    };
+
+    /**
+     * @brief Open a scope, waiting for the arena if another thread holds it
+     *
+     * Scopes nest on the owning thread. Open the scope before taking the
+     * SPI bus or the FRAMFS lock, never while holding either, so the arena
+     * is always first in the lock order.
+     *
+     * @return 0 on success, -EBUSY if the arena stayed busy for @p timeout
+     */
+    int juxta_scratch_begin(struct juxta_scratch_scope *scope, k_timeout_t timeout);
+
+    /**
+     * @brief Allocate from the arena (4-byte aligned, uninitialized)
+     *
+     * @return Buffer valid until the scope ends, NULL if the arena is full
+     */
+    void *juxta_scratch_alloc(struct juxta_scratch_scope *scope, size_t size);
+
+    /**
+     * @brief Release everything allocated since the scope began
+     */
+    void juxta_scratch_end(struct juxta_scratch_scope *scope);
+
+    /**
+     * @brief Arena size in bytes (fixed at build time)
+     */
+    size_t juxta_scratch_size(void);
+
+    /**
+     * @brief Most bytes ever allocated at once
+     */
+    size_t juxta_scratch_high_water(void);
+
+    /**
+     * @brief Log size, high-water mark and contention counters (RTT)
+     */
+    void juxta_scratch_log(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JUXTA_SCRATCH_H_ */
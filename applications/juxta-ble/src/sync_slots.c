@@ -0,0 +1,78 @@
+/*
+ * JUXTA Synchronized Discovery Slots Implementation
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sync_slots.h"
+
+/* Integer hash finalizer; spreads consecutive window indexes across order bits */
+static uint32_t mix32(uint32_t x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352dU;
+    x ^= x >> 15;
+    x *= 0x846ca68bU;
+    x ^= x >> 16;
+    return x;
+}
+
+uint32_t juxta_sync_guard_ms(const struct juxta_sync_cfg *cfg, uint32_t sync_age_s)
+{
+    /* ppm x seconds = microseconds */
+    uint64_t drift_ms = ((uint64_t)cfg->drift_ppm * sync_age_s) / 1000;
+    uint64_t guard = 2 * ((uint64_t)cfg->sync_error_ms + drift_ms);
+    return (guard > UINT32_MAX) ? UINT32_MAX : (uint32_t)guard;
+}
+
+bool juxta_sync_usable(const struct juxta_sync_cfg *cfg, uint32_t guard_ms)
+{
+    return guard_ms <= cfg->gap_ms;
+}
+
+bool juxta_sync_adv_first(uint32_t device_id, uint64_t window_ms)
+{
+    uint32_t window_index = (uint32_t)(window_ms / 1000);
+    return (mix32(device_id ^ mix32(window_index)) & 1) == 0;
+}
+
+static void slot_bounds(const struct juxta_sync_cfg *cfg, enum juxta_sync_role role,
+                        uint32_t device_id, uint64_t window_ms, uint32_t guard_ms,
+                        uint64_t *start_ms, uint64_t *end_ms)
+{
+    bool adv_first = juxta_sync_adv_first(device_id, window_ms);
+    bool first = (role == JUXTA_SYNC_ROLE_ADV) ? adv_first : !adv_first;
+
+    uint64_t start = window_ms + (first ? 0 : (uint64_t)cfg->slot_ms + cfg->gap_ms);
+    uint64_t end = start + cfg->slot_ms;
+
+    if (role == JUXTA_SYNC_ROLE_SCAN)
+    {
+        /* The gap keeps the widened scan clear of our own advertising */
+        start = (start > guard_ms) ? start - guard_ms : 0;
+        end += guard_ms;
+    }
+
+    *start_ms = start;
+    *end_ms = end;
+}
+
+void juxta_sync_next_slot(const struct juxta_sync_cfg *cfg, enum juxta_sync_role role,
+                          uint32_t period_ms, uint32_t device_id, uint64_t now_ms,
+                          uint32_t guard_ms, uint64_t *start_ms, uint64_t *end_ms)
+{
+    uint64_t window_ms = now_ms - (now_ms % period_ms);
+
+    for (;;)
+    {
+        slot_bounds(cfg, role, device_id, window_ms, guard_ms, start_ms, end_ms);
+
+        uint64_t from = (*start_ms > now_ms) ? *start_ms : now_ms;
+        if (*end_ms > from && (*end_ms - from) >= cfg->slot_ms / 2)
+        {
+            return;
+        }
+        window_ms += period_ms;
+    }
+}
@@ -0,0 +1,88 @@
+/*
+ * JUXTA Synchronized Discovery Slots Header
+ * Aligned advertise/scan windows derived from shared Unix time. Every
+ * window starts on a multiple of the burst period and holds two slots
+ * separated by a gap; each device advertises in one slot and scans in the
+ * other, with the order picked per window from its device ID. No Zephyr
+ * dependencies, so slot plans can be checked on the host.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef JUXTA_SYNC_SLOTS_H_
+#define JUXTA_SYNC_SLOTS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    enum juxta_sync_role
+    {
+        JUXTA_SYNC_ROLE_ADV = 0,
+        JUXTA_SYNC_ROLE_SCAN,
+    };
+
+    struct juxta_sync_cfg
+    {
+        uint32_t slot_ms;       /* Length of each slot */
+        uint32_t gap_ms;        /* Gap between the two slots; largest usable guard */
+        uint32_t drift_ppm;     /* Worst-case clock drift */
+        uint32_t sync_error_ms; /* Time error right after a gateway sync */
+    };
+
+    /**
+     * @brief Guard band for the current clock uncertainty
+     *
+     * Covers our own error plus that of a peer assumed to be no better
+     * synchronized than we are.
+     *
+     * @param cfg Slot configuration
+     * @param sync_age_s Seconds since the last gateway time sync
+     * @return Guard in ms
+     */
+    uint32_t juxta_sync_guard_ms(const struct juxta_sync_cfg *cfg, uint32_t sync_age_s);
+
+    /**
+     * @brief Check whether aligned slots still beat random bursts
+     *
+     * @return false once the guard no longer fits in the slot gap
+     */
+    bool juxta_sync_usable(const struct juxta_sync_cfg *cfg, uint32_t guard_ms);
+
+    /**
+     * @brief Whether this device advertises in the first slot of a window
+     *
+     * @param device_id Device identifier (e.g. lower MAC bytes)
+     * @param window_ms Unix time of the window start in ms
+     */
+    bool juxta_sync_adv_first(uint32_t device_id, uint64_t window_ms);
+
+    /**
+     * @brief Find the current or next slot for a role
+     *
+     * Scan slots are widened by @p guard_ms on both sides. A slot already
+     * in progress is returned while at least half of it remains.
+     *
+     * @param cfg Slot configuration
+     * @param role Advertise or scan
+     * @param period_ms Burst period; windows start on its multiples
+     * @param device_id Device identifier
+     * @param now_ms Current Unix time in ms
+     * @param guard_ms Guard from juxta_sync_guard_ms()
+     * @param start_ms Slot start in Unix ms (may be in the past)
+     * @param end_ms Slot end in Unix ms
+     */
+    void juxta_sync_next_slot(const struct juxta_sync_cfg *cfg, enum juxta_sync_role role,
+                              uint32_t period_ms, uint32_t device_id, uint64_t now_ms,
+                              uint32_t guard_ms, uint64_t *start_ms, uint64_t *end_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JUXTA_SYNC_SLOTS_H_ */
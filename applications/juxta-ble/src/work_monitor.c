@@ -0,0 +1,364 @@
+/*
+ * JUXTA Work Monitor Implementation
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "work_monitor.h"
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <stdio.h>
+#include <string.h>
+
+LOG_MODULE_REGISTER(juxta_wmon, LOG_LEVEL_INF);
+
+#define STALL_MS CONFIG_JUXTA_BLE_WORK_MONITOR_STALL_MS
+
+/* Bin 0 is < 64 us, bin i is [64 << (i - 1), 64 << i) us, the last bin takes the rest */
+#define HIST_BINS 14
+#define HIST_BASE_SHIFT 6
+
+static const char *const item_names[JUXTA_WMON_ITEM_COUNT] = {
+    "sched", "state", "adc_trig", "threshold", "minute_wr", "bt_rx", "accel_fifo",
+};
+
+struct wmon_item
+{
+    /* Live state */
+    uint32_t submit_cyc;   /* First submit since the last start */
+    bool pending;          /* Submitted, not started yet */
+    k_tid_t thread;        /* Running on this thread, NULL when idle */
+    uint32_t start_cyc;    /* Start of the current run */
+    const char *block;     /* Blocking call in progress, NULL if none */
+    uint32_t block_cyc;    /* Start of that call */
+    bool stall_reported;   /* Current run or wait already reported */
+
+    /* Statistics */
+    uint32_t count;
+    uint32_t max_latency_us;
+    uint32_t max_exec_us;
+    uint64_t total_exec_us;
+    uint32_t max_block_us;
+    const char *max_block; /* Call that blocked longest */
+    uint16_t latency_hist[HIST_BINS];
+    uint16_t exec_hist[HIST_BINS];
+};
+
+/*
+ * Hooks only stamp the 32 kHz kernel cycle counter under the lock; the
+ * per-item record is all that is kept. A k_timer checks for runs and
+ * waits that exceed the stall threshold, so a wedged workqueue is
+ * reported even though the health check shares that workqueue.
+ */
+static struct k_spinlock wmon_lock;
+static struct wmon_item items[JUXTA_WMON_ITEM_COUNT];
+static struct k_timer stall_timer;
+
+static void hist_add(uint16_t *hist, uint32_t us)
+{
+    uint32_t bin = 0;
+
+    if (us >= (1U << HIST_BASE_SHIFT))
+    {
+        bin = 31U - __builtin_clz(us) - HIST_BASE_SHIFT + 1U;
+    }
+    bin = MIN(bin, HIST_BINS - 1U);
+    if (hist[bin] < UINT16_MAX)
+    {
+        hist[bin]++;
+    }
+}
+
+static void stall_timer_callback(struct k_timer *timer)
+{
+    ARG_UNUSED(timer);
+
+    uint32_t now = k_cycle_get_32();
+
+    k_spinlock_key_t key = k_spin_lock(&wmon_lock);
+    for (int i = 0; i < JUXTA_WMON_ITEM_COUNT; i++)
+    {
+        struct wmon_item *it = &items[i];
+        if (it->stall_reported)
+        {
+            continue;
+        }
+
+        if (it->thread)
+        {
+            uint32_t run_ms = k_cyc_to_ms_floor32(now - it->start_cyc);
+            if (run_ms >= STALL_MS)
+            {
+                it->stall_reported = true;
+                if (it->block)
+                {
+                    LOG_WRN("🐢 %s running %u ms, blocked in %s for %u ms",
+                            item_names[i], run_ms, it->block,
+                            k_cyc_to_ms_floor32(now - it->block_cyc));
+                }
+                else
+                {
+                    LOG_WRN("🐢 %s running %u ms (not in a marked call)", item_names[i], run_ms);
+                }
+            }
+        }
+        else if (it->pending)
+        {
+            uint32_t wait_ms = k_cyc_to_ms_floor32(now - it->submit_cyc);
+            if (wait_ms >= STALL_MS)
+            {
+                it->stall_reported = true;
+                LOG_WRN("🐢 %s queued %u ms without starting", item_names[i], wait_ms);
+            }
+        }
+    }
+    k_spin_unlock(&wmon_lock, key);
+}
+
+void juxta_wmon_init(void)
+{
+    k_timer_init(&stall_timer, stall_timer_callback, NULL);
+    k_timer_start(&stall_timer, K_MSEC(STALL_MS), K_MSEC(STALL_MS));
+    LOG_INF("🐢 Work monitor started (stall threshold %u ms)", STALL_MS);
+}
+
+void juxta_wmon_submitted(enum juxta_wmon_item item)
+{
+    if (item >= JUXTA_WMON_ITEM_COUNT)
+    {
+        return;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&wmon_lock);
+    if (!items[item].pending)
+    {
+        items[item].pending = true;
+        items[item].submit_cyc = k_cycle_get_32();
+        if (!items[item].thread)
+        {
+            items[item].stall_reported = false;
+        }
+    }
+    k_spin_unlock(&wmon_lock, key);
+}
+
+static void item_begin(enum juxta_wmon_item item, bool have_due, uint32_t due_cyc)
+{
+    struct wmon_item *it = &items[item];
+    uint32_t now = k_cycle_get_32();
+
+    if (!have_due)
+    {
+        have_due = it->pending;
+        due_cyc = it->submit_cyc;
+    }
+    it->pending = false;
+    it->thread = k_current_get();
+    it->start_cyc = now;
+    it->block = NULL;
+    it->stall_reported = false;
+
+    if (have_due)
+    {
+        /* A due time in the future (early wake) counts as zero latency */
+        int32_t late = (int32_t)(now - due_cyc);
+        uint32_t latency_us = (late > 0) ? k_cyc_to_us_floor32((uint32_t)late) : 0U;
+        it->max_latency_us = MAX(it->max_latency_us, latency_us);
+        hist_add(it->latency_hist, latency_us);
+    }
+}
+
+void juxta_wmon_begin(enum juxta_wmon_item item)
+{
+    if (item >= JUXTA_WMON_ITEM_COUNT)
+    {
+        return;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&wmon_lock);
+    item_begin(item, false, 0);
+    k_spin_unlock(&wmon_lock, key);
+}
+
+void juxta_wmon_begin_since(enum juxta_wmon_item item, uint32_t due_cyc)
+{
+    if (item >= JUXTA_WMON_ITEM_COUNT)
+    {
+        return;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&wmon_lock);
+    item_begin(item, true, due_cyc);
+    k_spin_unlock(&wmon_lock, key);
+}
+
+void juxta_wmon_end(enum juxta_wmon_item item)
+{
+    if (item >= JUXTA_WMON_ITEM_COUNT)
+    {
+        return;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&wmon_lock);
+    struct wmon_item *it = &items[item];
+    if (it->thread)
+    {
+        uint32_t exec_us = k_cyc_to_us_floor32(k_cycle_get_32() - it->start_cyc);
+        it->thread = NULL;
+        it->block = NULL;
+        it->count++;
+        it->total_exec_us += exec_us;
+        it->max_exec_us = MAX(it->max_exec_us, exec_us);
+        hist_add(it->exec_hist, exec_us);
+    }
+    k_spin_unlock(&wmon_lock, key);
+}
+
+void juxta_wmon_block_begin(const char *what)
+{
+    k_tid_t self = k_current_get();
+    uint32_t now = k_cycle_get_32();
+
+    k_spinlock_key_t key = k_spin_lock(&wmon_lock);
+    for (int i = 0; i < JUXTA_WMON_ITEM_COUNT; i++)
+    {
+        if (items[i].thread == self)
+        {
+            items[i].block = what;
+            items[i].block_cyc = now;
+        }
+    }
+    k_spin_unlock(&wmon_lock, key);
+}
+
+void juxta_wmon_block_end(void)
+{
+    k_tid_t self = k_current_get();
+    uint32_t now = k_cycle_get_32();
+
+    k_spinlock_key_t key = k_spin_lock(&wmon_lock);
+    for (int i = 0; i < JUXTA_WMON_ITEM_COUNT; i++)
+    {
+        struct wmon_item *it = &items[i];
+        if (it->thread == self && it->block)
+        {
+            uint32_t block_us = k_cyc_to_us_floor32(now - it->block_cyc);
+            if (block_us >= it->max_block_us)
+            {
+                it->max_block_us = block_us;
+                it->max_block = it->block;
+            }
+            it->block = NULL;
+        }
+    }
+    k_spin_unlock(&wmon_lock, key);
+}
+
+static bool hist_used(const uint16_t *hist)
+{
+    for (int i = 0; i < HIST_BINS; i++)
+    {
+        if (hist[i])
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void log_hist(const char *label, const uint16_t *hist)
+{
+    char line[HIST_BINS * 6 + 1];
+    int len = 0;
+
+    for (int i = 0; i < HIST_BINS; i++)
+    {
+        len += snprintf(line + len, sizeof(line) - len, "%s%u", i ? "," : "", hist[i]);
+    }
+    LOG_INF("🐢       %s us<64,128..: %s", label, line);
+}
+
+static void log_occupancy(void)
+{
+#if defined(CONFIG_THREAD_RUNTIME_STATS)
+    static uint64_t last_exec_cyc;
+    static uint32_t last_wall_cyc;
+    k_thread_runtime_stats_t stats;
+
+    if (k_thread_runtime_stats_get(&k_sys_work_q.thread, &stats) != 0)
+    {
+        return;
+    }
+
+    /* Runtime stats count in the same kernel cycle units */
+    uint32_t now = k_cycle_get_32();
+    if (last_wall_cyc != 0)
+    {
+        uint32_t wall = now - last_wall_cyc;
+        uint64_t busy = stats.execution_cycles - last_exec_cyc;
+        uint32_t permille = wall ? (uint32_t)MIN(busy * 1000U / wall, 1000U) : 0U;
+        LOG_INF("🐢 Sysworkq busy %u.%u%% over the last %u s",
+                permille / 10U, permille % 10U, k_cyc_to_ms_floor32(wall) / 1000U);
+    }
+    last_exec_cyc = stats.execution_cycles;
+    last_wall_cyc = now;
+#endif
+}
+
+#if defined(CONFIG_THREAD_MONITOR) && defined(CONFIG_THREAD_STACK_INFO) && defined(CONFIG_INIT_STACKS)
+static void log_thread_stack(const struct k_thread *cthread, void *user_data)
+{
+    struct k_thread *thread = (struct k_thread *)cthread;
+    size_t unused = 0;
+
+    ARG_UNUSED(user_data);
+
+    if (k_thread_stack_space_get(thread, &unused) != 0)
+    {
+        return;
+    }
+
+    size_t size = thread->stack_info.size;
+    const char *name = k_thread_name_get(thread);
+    LOG_INF("🐢   stack %-16s %4u / %4u used (%u%%)",
+            (name && name[0]) ? name : "?", (unsigned)(size - unused), (unsigned)size,
+            size ? (unsigned)((size - unused) * 100U / size) : 0U);
+}
+#endif
+
+void juxta_wmon_log(void)
+{
+    struct wmon_item copy;
+
+    LOG_INF("🐢 Work monitor (latency / exec / longest block):");
+    for (int i = 0; i < JUXTA_WMON_ITEM_COUNT; i++)
+    {
+        k_spinlock_key_t key = k_spin_lock(&wmon_lock);
+        copy = items[i];
+        k_spin_unlock(&wmon_lock, key);
+
+        if (copy.count == 0 && !copy.thread && !copy.pending)
+        {
+            continue;
+        }
+
+        LOG_INF("🐢   %-10s n=%u lat max %u us, exec avg %u max %u us, block %u us (%s)%s",
+                item_names[i], copy.count, copy.max_latency_us,
+                copy.count ? (uint32_t)(copy.total_exec_us / copy.count) : 0U,
+                copy.max_exec_us, copy.max_block_us,
+                copy.max_block ? copy.max_block : "-",
+                copy.thread ? " [running]" : (copy.pending ? " [queued]" : ""));
+        if (hist_used(copy.latency_hist))
+        {
+            log_hist("lat ", copy.latency_hist);
+        }
+        log_hist("exec", copy.exec_hist);
+    }
+
+    log_occupancy();
+
+#if defined(CONFIG_THREAD_MONITOR) && defined(CONFIG_THREAD_STACK_INFO) && defined(CONFIG_INIT_STACKS)
+    k_thread_foreach_unlocked(log_thread_stack, NULL);
+#endif
+}
@@ -0,0 +1,109 @@
+/*
+ * JUXTA Work Monitor Header
+ * Per work item/thread latency and execution time with log2 histograms,
+ * the longest blocking call inside each item, system workqueue occupancy
+ * and stack high-water marks, so a stalled or slow item can be traced to
+ * the call it was blocked in.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef JUXTA_WORK_MONITOR_H_
+#define JUXTA_WORK_MONITOR_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Monitored work items and thread loops
+     *
+     * Items may nest on one thread (STATE and ADC_TRIGGER run inside the
+     * SCHED pass); a blocking call counts against every item open on the
+     * calling thread.
+     */
+    enum juxta_wmon_item
+    {
+        JUXTA_WMON_SCHED = 0,     /* Scheduler work pass (system workqueue) */
+        JUXTA_WMON_STATE,         /* Minute log and burst state events */
+        JUXTA_WMON_ADC_TRIGGER,   /* ADC capture service */
+        JUXTA_WMON_THRESHOLD,     /* One threshold thread iteration */
+        JUXTA_WMON_MINUTE_WRITER, /* One minute record persisted */
+        JUXTA_WMON_BT_RX,         /* Scan report handling on the BT RX path */
+        JUXTA_WMON_ACCEL_FIFO,    /* Accelerometer FIFO drain (system workqueue) */
+        JUXTA_WMON_ITEM_COUNT
+    };
+
+#ifdef CONFIG_JUXTA_BLE_WORK_MONITOR
+
+    /**
+     * @brief Start the stall watchdog timer
+     */
+    void juxta_wmon_init(void);
+
+    /**
+     * @brief Note that an item was submitted (ISR-safe)
+     *
+     * The first submit since the item last started is kept, so resubmitting
+     * a queued work item does not hide its latency.
+     */
+    void juxta_wmon_submitted(enum juxta_wmon_item item);
+
+    /**
+     * @brief Item starts on the calling thread; latency is taken from the last submit
+     */
+    void juxta_wmon_begin(enum juxta_wmon_item item);
+
+    /**
+     * @brief Item starts; latency is taken from @p due_cyc (k_cycle_get_32() units)
+     */
+    void juxta_wmon_begin_since(enum juxta_wmon_item item, uint32_t due_cyc);
+
+    /**
+     * @brief Item finished
+     */
+    void juxta_wmon_end(enum juxta_wmon_item item);
+
+    /**
+     * @brief A blocking call starts on the calling thread
+     *
+     * @param what Static description shown in reports (e.g. "bt_le_scan_start")
+     */
+    void juxta_wmon_block_begin(const char *what);
+
+    /**
+     * @brief The blocking call on the calling thread returned
+     */
+    void juxta_wmon_block_end(void);
+
+    /**
+     * @brief Log per-item statistics, workqueue occupancy and stack usage (RTT)
+     */
+    void juxta_wmon_log(void);
+
+#else
+
+static inline void juxta_wmon_init(void) {}
+static inline void juxta_wmon_submitted(enum juxta_wmon_item item) { (void)item; }
+static inline void juxta_wmon_begin(enum juxta_wmon_item item) { (void)item; }
+static inline void juxta_wmon_begin_since(enum juxta_wmon_item item, uint32_t due_cyc)
+{
+    (void)item;
+    (void)due_cyc;
+}
+static inline void juxta_wmon_end(enum juxta_wmon_item item) { (void)item; }
+static inline void juxta_wmon_block_begin(const char *what) { (void)what; }
+static inline void juxta_wmon_block_end(void) {}
+
+#endif /* CONFIG_JUXTA_BLE_WORK_MONITOR */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JUXTA_WORK_MONITOR_H_ */
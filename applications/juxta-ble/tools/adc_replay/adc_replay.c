@@ -0,0 +1,638 @@
+/*
+ * JUXTA ADC Pipeline Replay
+ * Runs the firmware peri-event pipeline (src/adc_pipeline.c) on the host
+ * against recorded (CSV/WAV) or synthetic waveforms, faster than real time,
+ * and stores the events with lib/juxta_framfs on an emulated FRAM.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "adc_pipeline.h"
+#include "fram_image.h"
+#include <juxta_framfs/framfs.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include <time.h>
+
+/* Capture thread polls the ring every 10 ms on target */
+#define REPLAY_POLL_INTERVAL_US 10000
+
+/* RTC at the start of the replay: 2025-06-01 00:00:00 UTC, file 250601 */
+#define REPLAY_START_UNIX 1748736000U
+#define REPLAY_FILE_DATE 250601U
+
+/* SAADC counts per mV on channel ch (inverse of adc_pipeline_raw_to_mv) */
+#define REPLAY_MV_TO_RAW(mv, ch) \
+    ((int16_t)lrint((double)(mv) * (ADC_PIPELINE_CHANNEL_IS_DIFFERENTIAL(ch) ? 2048.0 : 4096.0) / 3600.0))
+
+struct replay_options
+{
+    const char *csv_path;
+    const char *wav_path;
+    bool synth;
+    uint32_t rate_hz;
+    bool threshold_mode;
+    int32_t threshold_mv;
+    uint32_t debounce_ms;
+    uint32_t window_samples;
+    bool peaks_only;
+    double wav_full_scale_mv;
+    /* Synthetic pulse train */
+    double duration_s;
+    double pulse_period_ms;
+    double pulse_width_us;
+    double pulse_amp_mv;
+    double noise_mv;
+    uint32_t seed;
+    bool verbose;
+};
+
+struct replay_input
+{
+    int16_t *raw; /* Interleaved raw SAADC counts */
+    uint32_t frames;
+    uint64_t *pulses; /* Ground-truth pulse start frames (synthetic only) */
+    uint32_t pulse_count;
+};
+
+enum replay_stage
+{
+    STAGE_CONVERT = 0,
+    STAGE_RING_ADD,
+    STAGE_DETECT,
+    STAGE_EXTRACT,
+    STAGE_SCALE,
+    STAGE_STORE,
+    STAGE_COUNT
+};
+
+static const char *const stage_names[STAGE_COUNT] = {
+    "raw_to_mv", "ring_add", "detect", "extract", "scale", "store"};
+
+struct stage_stats
+{
+    uint64_t ns;
+    uint64_t calls;
+};
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s (--csv FILE | --wav FILE | --synth) [options]\n"
+            "Input:\n"
+            "  --csv FILE           One frame per line, %d comma-separated mV values\n"
+            "  --wav FILE           16-bit PCM WAV with %d channel(s)\n"
+            "  --wav-mv MV          mV at WAV full scale (default 2000)\n"
+            "  --synth              Synthetic pulse train\n"
+            "  --duration S         Synthetic length in seconds (default 60)\n"
+            "  --pulse-period MS    Synthetic pulse period (default 250)\n"
+            "  --pulse-width US     Synthetic pulse width (default 500)\n"
+            "  --pulse-amp MV       Synthetic pulse amplitude (default 800)\n"
+            "  --noise MV           Synthetic uniform noise amplitude (default 20)\n"
+            "  --seed N             Synthetic noise seed (default 1)\n"
+            "Pipeline (same meaning as the gateway adc* settings):\n"
+            "  --rate HZ            Sampling rate (default 10000)\n"
+            "  --mode threshold|timer (default threshold)\n"
+            "  --threshold MV       adcThreshold (default 100)\n"
+            "  --debounce MS        adcDebounce (default 10)\n"
+            "  --window N           adcBufferSize (default %d)\n"
+            "  --peaks-only         adcPeaksOnly\n"
+            "  --verbose            Print every detection\n",
+            prog, ADC_PIPELINE_CHANNELS, ADC_PIPELINE_CHANNELS, ADC_PIPELINE_WINDOW_DEFAULT);
+}
+
+static int parse_args(int argc, char **argv, struct replay_options *opt)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        const char *val = (i + 1 < argc) ? argv[i + 1] : NULL;
+        bool takes_value = true;
+
+        if (strcmp(arg, "--synth") == 0)
+        {
+            opt->synth = true;
+            takes_value = false;
+        }
+        else if (strcmp(arg, "--peaks-only") == 0)
+        {
+            opt->peaks_only = true;
+            takes_value = false;
+        }
+        else if (strcmp(arg, "--verbose") == 0)
+        {
+            opt->verbose = true;
+            takes_value = false;
+        }
+        else if (!val)
+        {
+            fprintf(stderr, "Missing value for %s\n", arg);
+            return -1;
+        }
+        else if (strcmp(arg, "--csv") == 0)
+            opt->csv_path = val;
+        else if (strcmp(arg, "--wav") == 0)
+            opt->wav_path = val;
+        else if (strcmp(arg, "--wav-mv") == 0)
+            opt->wav_full_scale_mv = atof(val);
+        else if (strcmp(arg, "--duration") == 0)
+            opt->duration_s = atof(val);
+        else if (strcmp(arg, "--pulse-period") == 0)
+            opt->pulse_period_ms = atof(val);
+        else if (strcmp(arg, "--pulse-width") == 0)
+            opt->pulse_width_us = atof(val);
+        else if (strcmp(arg, "--pulse-amp") == 0)
+            opt->pulse_amp_mv = atof(val);
+        else if (strcmp(arg, "--noise") == 0)
+            opt->noise_mv = atof(val);
+        else if (strcmp(arg, "--seed") == 0)
+            opt->seed = (uint32_t)strtoul(val, NULL, 0);
+        else if (strcmp(arg, "--rate") == 0)
+            opt->rate_hz = (uint32_t)strtoul(val, NULL, 0);
+        else if (strcmp(arg, "--mode") == 0)
+            opt->threshold_mode = (strcmp(val, "timer") != 0);
+        else if (strcmp(arg, "--threshold") == 0)
+            opt->threshold_mv = (int32_t)strtol(val, NULL, 0);
+        else if (strcmp(arg, "--debounce") == 0)
+            opt->debounce_ms = (uint32_t)strtoul(val, NULL, 0);
+        else if (strcmp(arg, "--window") == 0)
+            opt->window_samples = (uint32_t)strtoul(val, NULL, 0);
+        else
+        {
+            fprintf(stderr, "Unknown option: %s\n", arg);
+            return -1;
+        }
+
+        if (takes_value)
+        {
+            i++;
+        }
+    }
+
+    int sources = (opt->csv_path != NULL) + (opt->wav_path != NULL) + (opt->synth ? 1 : 0);
+    if (sources != 1 || opt->rate_hz == 0)
+    {
+        return -1;
+    }
+
+    /* Same clamps the capture thread applies */
+    if (opt->window_samples < ADC_PIPELINE_WINDOW_MIN)
+        opt->window_samples = ADC_PIPELINE_WINDOW_MIN;
+    if (opt->window_samples > ADC_PIPELINE_WINDOW_MAX)
+        opt->window_samples = ADC_PIPELINE_WINDOW_MAX;
+    if (opt->debounce_ms == 0)
+        opt->debounce_ms = 1;
+
+    return 0;
+}
+
+static int append_frame(struct replay_input *in, uint32_t *capacity, const double *mv)
+{
+    if (in->frames == *capacity)
+    {
+        uint32_t new_cap = (*capacity == 0) ? 65536 : (*capacity * 2);
+        int16_t *grown = realloc(in->raw, (size_t)new_cap * ADC_PIPELINE_CHANNELS * sizeof(int16_t));
+        if (!grown)
+        {
+            return -1;
+        }
+        in->raw = grown;
+        *capacity = new_cap;
+    }
+
+    for (uint32_t ch = 0; ch < ADC_PIPELINE_CHANNELS; ch++)
+    {
+        in->raw[(size_t)in->frames * ADC_PIPELINE_CHANNELS + ch] = REPLAY_MV_TO_RAW(mv[ch], ch);
+    }
+    in->frames++;
+    return 0;
+}
+
+static int load_csv(const char *path, struct replay_input *in)
+{
+    FILE *f = fopen(path, "r");
+    if (!f)
+    {
+        perror(path);
+        return -1;
+    }
+
+    char line[256];
+    uint32_t capacity = 0;
+    while (fgets(line, sizeof(line), f))
+    {
+        double mv[ADC_PIPELINE_CHANNELS] = {0};
+        char *p = line;
+        uint32_t parsed = 0;
+
+        for (uint32_t ch = 0; ch < ADC_PIPELINE_CHANNELS; ch++)
+        {
+            char *end;
+            mv[ch] = strtod(p, &end);
+            if (end == p)
+            {
+                break;
+            }
+            parsed++;
+            p = (*end == ',') ? end + 1 : end;
+        }
+
+        if (parsed == 0)
+        {
+            continue; /* Header or blank line */
+        }
+        if (append_frame(in, &capacity, mv) != 0)
+        {
+            fclose(f);
+            return -1;
+        }
+    }
+
+    fclose(f);
+    return 0;
+}
+
+static uint32_t read_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t read_le16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static int load_wav(const char *path, double full_scale_mv, struct replay_input *in)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f)
+    {
+        perror(path);
+        return -1;
+    }
+
+    uint8_t riff[12];
+    if (fread(riff, 1, sizeof(riff), f) != sizeof(riff) ||
+        memcmp(riff, "RIFF", 4) != 0 || memcmp(riff + 8, "WAVE", 4) != 0)
+    {
+        fprintf(stderr, "%s: not a RIFF/WAVE file\n", path);
+        fclose(f);
+        return -1;
+    }
+
+    uint16_t channels = 0;
+    uint16_t bits = 0;
+    uint8_t chunk[8];
+    while (fread(chunk, 1, sizeof(chunk), f) == sizeof(chunk))
+    {
+        uint32_t size = read_le32(chunk + 4);
+        if (memcmp(chunk, "fmt ", 4) == 0)
+        {
+            uint8_t fmt[16];
+            if (size < sizeof(fmt) || fread(fmt, 1, sizeof(fmt), f) != sizeof(fmt))
+            {
+                break;
+            }
+            if (read_le16(fmt) != 1)
+            {
+                fprintf(stderr, "%s: only PCM WAV is supported\n", path);
+                break;
+            }
+            channels = read_le16(fmt + 2);
+            bits = read_le16(fmt + 14);
+            fseek(f, (long)(size - sizeof(fmt) + (size & 1)), SEEK_CUR);
+        }
+        else if (memcmp(chunk, "data", 4) == 0)
+        {
+            if (bits != 16 || channels != ADC_PIPELINE_CHANNELS)
+            {
+                fprintf(stderr, "%s: need 16-bit PCM with %d channel(s) (got %u-bit, %u ch)\n",
+                        path, ADC_PIPELINE_CHANNELS, bits, channels);
+                break;
+            }
+
+            uint32_t capacity = 0;
+            int16_t frame_pcm[ADC_PIPELINE_CHANNELS];
+            uint32_t frames = size / sizeof(frame_pcm);
+            for (uint32_t i = 0; i < frames; i++)
+            {
+                if (fread(frame_pcm, sizeof(frame_pcm), 1, f) != 1)
+                {
+                    break;
+                }
+                double mv[ADC_PIPELINE_CHANNELS];
+                for (uint32_t ch = 0; ch < ADC_PIPELINE_CHANNELS; ch++)
+                {
+                    mv[ch] = (double)(int16_t)read_le16((const uint8_t *)&frame_pcm[ch]) * full_scale_mv / 32768.0;
+                }
+                if (append_frame(in, &capacity, mv) != 0)
+                {
+                    break;
+                }
+            }
+            fclose(f);
+            return (in->frames > 0) ? 0 : -1;
+        }
+        else
+        {
+            fseek(f, (long)(size + (size & 1)), SEEK_CUR);
+        }
+    }
+
+    fclose(f);
+    return -1;
+}
+
+static int generate_synth(const struct replay_options *opt, struct replay_input *in)
+{
+    uint32_t frames = (uint32_t)(opt->duration_s * opt->rate_hz);
+    uint32_t period = (uint32_t)(opt->pulse_period_ms * opt->rate_hz / 1000.0);
+    uint32_t width = (uint32_t)ceil(opt->pulse_width_us * opt->rate_hz / 1000000.0);
+    if (frames == 0 || period == 0)
+    {
+        return -1;
+    }
+    if (width == 0)
+    {
+        width = 1;
+    }
+
+    in->raw = calloc((size_t)frames * ADC_PIPELINE_CHANNELS, sizeof(int16_t));
+    in->pulses = calloc(frames / period + 1, sizeof(uint64_t));
+    if (!in->raw || !in->pulses)
+    {
+        return -1;
+    }
+
+    srand(opt->seed);
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        /* Biphasic pulse on channel 0; other channels carry noise only */
+        uint32_t phase = i % period;
+        double pulse = 0.0;
+        if (phase < width)
+        {
+            pulse = (phase < (width + 1) / 2) ? opt->pulse_amp_mv : -opt->pulse_amp_mv;
+            if (phase == 0)
+            {
+                in->pulses[in->pulse_count++] = i;
+            }
+        }
+
+        for (uint32_t ch = 0; ch < ADC_PIPELINE_CHANNELS; ch++)
+        {
+            double noise = opt->noise_mv * (2.0 * rand() / (double)RAND_MAX - 1.0);
+            double mv = ((ch == 0) ? pulse : 0.0) + noise;
+            in->raw[(size_t)i * ADC_PIPELINE_CHANNELS + ch] = REPLAY_MV_TO_RAW(mv, ch);
+        }
+    }
+
+    in->frames = frames;
+    return 0;
+}
+
+/* Replays start at midnight and are far shorter than a day */
+static uint32_t replay_file_date(void)
+{
+    return REPLAY_FILE_DATE;
+}
+
+/* Absolute frame index of a ring position given total frames written */
+static uint64_t ring_pos_to_frame(const struct adc_pipeline_ring *ring, uint64_t total_frames, uint32_t pos)
+{
+    uint32_t back = (ring->head + ADC_PIPELINE_RING_SIZE - pos) % ADC_PIPELINE_RING_SIZE;
+    if (back == 0)
+    {
+        back = ADC_PIPELINE_RING_SIZE; /* Head slot holds the oldest frame */
+    }
+    return total_frames - back;
+}
+
+int main(int argc, char **argv)
+{
+    struct replay_options opt = {
+        .rate_hz = 10000,
+        .threshold_mode = true,
+        .threshold_mv = 100,
+        .debounce_ms = 10,
+        .window_samples = ADC_PIPELINE_WINDOW_DEFAULT,
+        .wav_full_scale_mv = 2000.0,
+        .duration_s = 60.0,
+        .pulse_period_ms = 250.0,
+        .pulse_width_us = 500.0,
+        .pulse_amp_mv = 800.0,
+        .noise_mv = 20.0,
+        .seed = 1,
+    };
+
+    if (parse_args(argc, argv, &opt) != 0)
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    struct replay_input in = {0};
+    int ret;
+    if (opt.csv_path)
+        ret = load_csv(opt.csv_path, &in);
+    else if (opt.wav_path)
+        ret = load_wav(opt.wav_path, opt.wav_full_scale_mv, &in);
+    else
+        ret = generate_synth(&opt, &in);
+
+    if (ret != 0 || in.frames == 0)
+    {
+        fprintf(stderr, "No input frames\n");
+        return 1;
+    }
+
+    /* Events go through the same FRAMFS append as on target */
+    static struct juxta_fram_device fram_dev;
+    static struct juxta_framfs_context fs;
+    static struct juxta_framfs_ctx time_ctx;
+    if (fram_image_init(&fram_dev, NULL) != 0 || juxta_framfs_init(&fs, &fram_dev) != 0 ||
+        juxta_framfs_init_with_time(&time_ctx, &fs, replay_file_date, true) != 0)
+    {
+        fprintf(stderr, "FRAM file system init failed\n");
+        return 1;
+    }
+
+    static struct adc_pipeline_ring ring;
+    struct adc_pipeline_detector det = {0};
+    static int16_t mv_block[ADC_PIPELINE_BLOCK_SIZE * ADC_PIPELINE_CHANNELS];
+    static int16_t extracted[ADC_PIPELINE_CHANNELS * ADC_PIPELINE_WINDOW_MAX];
+    static uint8_t scaled[ADC_PIPELINE_CHANNELS * ADC_PIPELINE_WINDOW_MAX];
+    uint8_t peak_pos[ADC_PIPELINE_CHANNELS];
+    uint8_t peak_neg[ADC_PIPELINE_CHANNELS];
+    struct stage_stats stats[STAGE_COUNT] = {0};
+
+    uint8_t *captured = in.pulse_count ? calloc(in.pulse_count, 1) : NULL;
+    uint32_t detections = 0;
+    uint32_t stored = 0;
+    uint32_t store_failures = 0;
+    int last_store_error = 0;
+    double fram_full_s = -1.0;
+    uint64_t bytes_written = 0;
+    uint64_t total_frames = 0;
+    uint64_t next_poll_us = REPLAY_POLL_INTERVAL_US;
+    uint32_t pulse_cursor = 0;
+
+    adc_pipeline_ring_reset(&ring);
+    uint64_t wall_start = now_ns();
+
+    for (uint32_t offset = 0; offset + ADC_PIPELINE_BLOCK_SIZE <= in.frames; offset += ADC_PIPELINE_BLOCK_SIZE)
+    {
+        const int16_t *raw = &in.raw[(size_t)offset * ADC_PIPELINE_CHANNELS];
+        uint64_t t0 = now_ns();
+        adc_pipeline_raw_to_mv(raw, mv_block, ADC_PIPELINE_BLOCK_SIZE);
+        uint64_t t1 = now_ns();
+        uint32_t end_us = (uint32_t)(((total_frames + ADC_PIPELINE_BLOCK_SIZE - 1) * 1000000ULL) / opt.rate_hz);
+        adc_pipeline_ring_add_block(&ring, mv_block, ADC_PIPELINE_BLOCK_SIZE, end_us, true);
+        uint64_t t2 = now_ns();
+        stats[STAGE_CONVERT].ns += t1 - t0;
+        stats[STAGE_CONVERT].calls++;
+        stats[STAGE_RING_ADD].ns += t2 - t1;
+        stats[STAGE_RING_ADD].calls++;
+        total_frames += ADC_PIPELINE_BLOCK_SIZE;
+
+        uint64_t sim_us = total_frames * 1000000ULL / opt.rate_hz;
+        while (next_poll_us <= sim_us)
+        {
+            uint32_t trigger_pos;
+            uint64_t d0 = now_ns();
+            bool hit = adc_pipeline_detect(&det, &ring, opt.threshold_mode, opt.threshold_mv,
+                                           opt.debounce_ms, opt.window_samples,
+                                           (uint32_t)(next_poll_us / 1000), &trigger_pos);
+            uint64_t d1 = now_ns();
+            stats[STAGE_DETECT].ns += d1 - d0;
+            stats[STAGE_DETECT].calls++;
+            next_poll_us += REPLAY_POLL_INTERVAL_US;
+
+            if (!hit)
+            {
+                continue;
+            }
+
+            uint32_t n = adc_pipeline_extract_centered(&ring, trigger_pos, extracted, opt.window_samples);
+            uint64_t d2 = now_ns();
+            stats[STAGE_EXTRACT].ns += d2 - d1;
+            stats[STAGE_EXTRACT].calls++;
+            if (n == 0)
+            {
+                continue;
+            }
+
+            adc_pipeline_scale(extracted, n, scaled, peak_pos, peak_neg);
+            uint64_t d3 = now_ns();
+            stats[STAGE_SCALE].ns += d3 - d2;
+            stats[STAGE_SCALE].calls++;
+
+            detections++;
+
+            /* Window covers the same frames the firmware stores */
+            uint64_t center = ring_pos_to_frame(&ring, total_frames, trigger_pos);
+
+            /* Same record as adc_process_peri_event_data(), stamped at the trigger sample */
+            uint64_t trigger_us = center * 1000000ULL / opt.rate_hz;
+            uint32_t duration_us = (uint32_t)((uint64_t)n * 1000000ULL / opt.rate_hz);
+            uint32_t data_before = fs.header.total_data_size;
+            int sret = juxta_framfs_append_adc_event_channels(
+                &time_ctx, REPLAY_START_UNIX + (uint32_t)(trigger_us / 1000000ULL),
+                (uint32_t)(trigger_us % 1000000ULL),
+                opt.peaks_only ? JUXTA_FRAMFS_ADC_EVENT_SINGLE_EVENT : JUXTA_FRAMFS_ADC_EVENT_PERI_EVENT,
+                ADC_PIPELINE_CHANNELS, opt.peaks_only ? NULL : scaled, opt.peaks_only ? 0 : (uint16_t)n,
+                duration_us, peak_pos, peak_neg);
+            uint64_t d4 = now_ns();
+            stats[STAGE_STORE].ns += d4 - d3;
+            stats[STAGE_STORE].calls++;
+            if (sret == 0)
+            {
+                stored++;
+                bytes_written += fs.header.total_data_size - data_before;
+            }
+            else
+            {
+                if (store_failures++ == 0)
+                {
+                    fram_full_s = (double)center / opt.rate_hz;
+                }
+                last_store_error = sret;
+            }
+            uint64_t first = (center >= n / 2) ? center - n / 2 : 0;
+            uint64_t last = first + n;
+            for (uint32_t p = pulse_cursor; p < in.pulse_count && in.pulses[p] < last; p++)
+            {
+                if (in.pulses[p] >= first)
+                {
+                    captured[p] = 1;
+                }
+            }
+            while (pulse_cursor < in.pulse_count && in.pulses[pulse_cursor] < first)
+            {
+                pulse_cursor++;
+            }
+
+            if (opt.verbose)
+            {
+                printf("event %u: t=%.6f s frame=%llu peaks ch0 [%u, %u]\n", detections,
+                       (double)center / opt.rate_hz, (unsigned long long)center, peak_pos[0], peak_neg[0]);
+            }
+        }
+    }
+
+    uint64_t wall_ns = now_ns() - wall_start;
+    double sim_s = (double)total_frames / opt.rate_hz;
+
+    printf("ADC replay: %llu frames x %d ch at %u Hz (%.2f s simulated)\n",
+           (unsigned long long)total_frames, ADC_PIPELINE_CHANNELS, opt.rate_hz, sim_s);
+    printf("  Config: mode=%s threshold=%d mV debounce=%u ms window=%u peaks_only=%s\n",
+           opt.threshold_mode ? "threshold" : "timer", opt.threshold_mv, opt.debounce_ms,
+           opt.window_samples, opt.peaks_only ? "true" : "false");
+    printf("  Wall time: %.3f ms (%.0fx real time)\n", wall_ns / 1e6,
+           wall_ns ? sim_s * 1e9 / wall_ns : 0.0);
+    printf("  Detections: %u\n", detections);
+    if (in.pulse_count)
+    {
+        uint32_t hits = 0;
+        for (uint32_t p = 0; p < in.pulse_count; p++)
+        {
+            hits += captured[p];
+        }
+        printf("  Pulses: %u, captured: %u, missed: %u (%.1f%%)\n", in.pulse_count, hits,
+               in.pulse_count - hits, 100.0 * (in.pulse_count - hits) / in.pulse_count);
+    }
+    struct fram_image_stats fram;
+    fram_image_get_stats(&fram);
+    printf("  Stored: %u events, %llu bytes (%.1f bytes/s, %.1f KB/day), %llu bytes of FRAM writes\n",
+           stored, (unsigned long long)bytes_written, sim_s > 0 ? bytes_written / sim_s : 0.0,
+           sim_s > 0 ? bytes_written / sim_s * 86400.0 / 1024.0 : 0.0, (unsigned long long)fram.write_bytes);
+    if (store_failures)
+    {
+        printf("  Store failed: %u events from %.2f s (last error %d)\n", store_failures, fram_full_s,
+               last_store_error);
+    }
+    printf("  Stage cost (host):\n");
+    for (int s = 0; s < STAGE_COUNT; s++)
+    {
+        printf("    %-10s %10llu calls %10.1f ns/call\n", stage_names[s],
+               (unsigned long long)stats[s].calls,
+               stats[s].calls ? (double)stats[s].ns / stats[s].calls : 0.0);
+    }
+
+    free(captured);
+    free(in.pulses);
+    free(in.raw);
+    return 0;
+}
@@ -0,0 +1,1563 @@
+/*
+ * JUXTA Day Simulation
+ * Runs whole-day scenarios through the firmware's portable modules
+ * (scheduler and its dispatch pass, activity, RSSI series, duty
+ * controller, ADC pipeline) and the real FRAM file system on an emulated
+ * FRAM image, on a virtual clock much faster than real time. The radio,
+ * accelerometer, SAADC and RTC are replaced by scripted models. The burst
+ * and minute handlers the pass dispatches to are a hand-maintained model
+ * of main.c, not the firmware code.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "fram_image.h"
+#include "sched_dispatch.h"
+#include "activity.h"
+#include "rssi_series.h"
+#include "duty_cycle.h"
+#include "adc_pipeline.h"
+#include <juxta_framfs/framfs.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include <time.h>
+
+/* Firmware timing, copied from main.c by hand; update with it */
+#define SIM_HEALTH_CHECK_INTERVAL_MS 30000
+#define SIM_BATTERY_SAMPLE_INTERVAL_MS 60000 /* CONFIG_JUXTA_VITALS_NRF52_BATTERY_UPDATE_INTERVAL */
+#define SIM_ADV_BURST_MS 2000
+#define SIM_SCAN_BURST_MS 1500
+#define SIM_MIN_INTER_BURST_DELAY_MS 100
+#define SIM_RANDOM_OFFSET_MS 1000
+#define SIM_ADV_RADIO_ON_MS 20
+#define SIM_SCAN_RADIO_ON_MS (SIM_SCAN_BURST_MS / 4)
+#define SIM_MAX_DEVICES 64 /* MAX_JUXTA_DEVICES */
+#define SIM_MINUTE_QUEUE_DEPTH 4 /* MINUTE_RECORD_QUEUE_DEPTH */
+#define SIM_DUTY_MAX_FACTOR 2
+#define SIM_DUTY_HOLD_S 120
+#define SIM_DUTY_CHURN_DB 6
+#define SIM_DUTY_MOTION_THRESHOLD 3
+
+/* Accelerometer FIFO configuration (lis2dh12.c) */
+#define SIM_ACCEL_ODR_HZ 25
+#define SIM_ACCEL_PERIOD_MS (1000 / SIM_ACCEL_ODR_HZ)
+#define SIM_ACCEL_MOTION_MG 160
+#define SIM_ACCEL_NOISE_MG 6
+#define SIM_GAIT_HZ 1.8
+
+/* Radio link: 100-200 ms adv interval, 25% scan window, 90% reception (as duty_sim) */
+#define SIM_ADV_EVENT_MS 150
+#define SIM_CAPTURE_PROB (0.25 * 0.9)
+#define SIM_RSSI_NOISE_DB 4
+
+/* ADC capture thread polls the ring every 10 ms */
+#define SIM_ADC_POLL_MS 10
+
+#define SIM_DAY_S 86400U
+#define SIM_MAX_SCENES 64
+
+static const uint32_t sim_slack_ms[JUXTA_SCHED_EVENT_COUNT] = {
+    [JUXTA_SCHED_HEALTH_CHECK] = 5000,
+    [JUXTA_SCHED_LED_BLINK] = 0,
+    [JUXTA_SCHED_MINUTE_LOG] = 500,
+    [JUXTA_SCHED_ADC_TRIGGER] = 50,
+    [JUXTA_SCHED_BURST_END] = 20,
+    [JUXTA_SCHED_SCAN_BURST] = 250,
+    [JUXTA_SCHED_ADV_BURST] = 250,
+    [JUXTA_SCHED_BATTERY_SAMPLE] = 5000,
+};
+
+static const char *const sched_names[JUXTA_SCHED_EVENT_COUNT] = {
+    "health", "led", "minute", "adc_trig", "burst_end", "scan", "adv", "battery",
+};
+
+/* Built-in scenario, used when no --scenario file is given */
+static const char *const default_scenario[] = {
+    "motion  07:00 08:30 300",
+    "motion  12:00 13:00 200",
+    "motion  17:00 19:00 400",
+    "peer    06:00 09:00 0A1B2C -62",
+    "peer    08:00 18:00 0A1B2D -75",
+    "peer    12:00 12:45 0A1B2E -55",
+    "peer    17:30 18:30 0A1B2F -68",
+    "adc     10:00 10:02",
+    "gateway 20:00 20:03",
+};
+
+enum scene_kind
+{
+    SCENE_MOTION = 0, /* arg: dynamic acceleration amplitude in mg */
+    SCENE_PEER,       /* arg: MAC ID, arg2: mean RSSI */
+    SCENE_ADC,        /* SAADC capture window */
+    SCENE_GATEWAY,    /* Gateway connected (bursts and minute records paused) */
+    SCENE_LOW_BATTERY, /* Battery critically low (minute records skipped) */
+};
+
+struct scene
+{
+    enum scene_kind kind;
+    uint32_t start_s; /* Seconds of day, inclusive */
+    uint32_t end_s;   /* Seconds of day, exclusive */
+    int32_t arg;
+    int32_t arg2;
+};
+
+enum sim_module
+{
+    MOD_SCHED = 0,
+    MOD_ACTIVITY,
+    MOD_RSSI_SERIES,
+    MOD_DUTY,
+    MOD_ADC,
+    MOD_FRAMFS,
+    MOD_COUNT
+};
+
+static const char *const module_names[MOD_COUNT] = {
+    "scheduler", "activity", "rssi_series", "duty_cycle", "adc_pipeline", "framfs",
+};
+
+enum sim_record
+{
+    REC_DEVICE_SCAN = 0,
+    REC_ACTIVITY,
+    REC_RSSI_SERIES,
+    REC_ADC_EVENT,
+    REC_COUNT
+};
+
+static const char *const record_names[REC_COUNT] = {
+    "device_scan", "activity", "rssi_series", "adc_event",
+};
+
+struct sim_options
+{
+    const char *scenario_path;
+    const char *image_path;
+    const char *adc_csv_path;
+    uint32_t days;
+    uint32_t start_unix;
+    uint32_t seed;
+    uint16_t adv_s;
+    uint16_t scan_s;
+    bool adaptive;
+    uint32_t adc_rate_hz;
+    int32_t adc_threshold_mv;
+    uint32_t adc_debounce_ms;
+    uint32_t adc_window;
+    bool adc_peaks_only;
+    double adc_pulse_hz; /* Synthetic input when no --adc-csv */
+    double adc_pulse_mv;
+    double adc_noise_mv;
+    bool verbose;
+};
+
+struct sim_record_stats
+{
+    uint32_t records;
+    uint32_t failures;
+    uint64_t bytes;       /* File data appended */
+    uint64_t fram_writes; /* FRAM bytes written, including index and header updates */
+};
+
+/* One queued minute record (struct minute_record_snapshot in main.c) */
+struct sim_minute_record
+{
+    uint16_t minute;
+    uint8_t motion_count;
+    uint8_t device_count;
+    uint8_t mac_ids[SIM_MAX_DEVICES][3];
+    int8_t rssi_values[SIM_MAX_DEVICES];
+    struct juxta_activity_minute activity;
+    uint8_t series_bursts;
+    uint8_t series_peers;
+    uint16_t series_len;
+    uint8_t series_mac_ids[JUXTA_RSSI_SERIES_MAX_PEERS][3];
+    uint8_t series[JUXTA_RSSI_SERIES_MAX_PEERS * JUXTA_RSSI_SERIES_PEER_MAX_BYTES];
+};
+
+struct sim_state
+{
+    struct sim_options opt;
+    struct scene scenes[SIM_MAX_SCENES];
+    uint32_t scene_count;
+
+    /* Virtual clock: uptime in ms, RTC = start_unix + uptime / 1000 */
+    uint32_t now_ms;
+    uint32_t end_ms;
+
+    /* Dispatch pass and its one-shot wakeup timer */
+    struct juxta_sched_dispatch disp;
+    bool timer_armed;
+    uint32_t timer_expiry_ms;
+    uint64_t handler_ns; /* Host CPU inside the handlers, not the pass */
+    struct juxta_duty_ctrl duty;
+    struct juxta_activity activity;
+    struct juxta_rssi_series series;
+
+    /* Firmware state (main.c) */
+    bool connected;
+    bool radio_busy;
+    bool scanning;
+    uint32_t last_adv_s;
+    uint32_t last_scan_s;
+    uint32_t scan_ids[SIM_MAX_DEVICES];
+    int8_t scan_rssi[SIM_MAX_DEVICES];
+    uint8_t scan_count;
+    uint8_t motion_count;
+    uint32_t next_accel_ms;
+
+    /* Minute writer queue (minute_record_q) */
+    struct sim_minute_record minute_q[SIM_MINUTE_QUEUE_DEPTH];
+    uint32_t minute_q_head;
+    uint32_t minute_q_count;
+
+    /* ADC capture */
+    struct adc_pipeline_ring ring;
+    struct adc_pipeline_detector det;
+    bool adc_active;
+    uint32_t adc_window_end_ms;
+    uint32_t adc_next_poll_ms;
+    uint64_t adc_frames; /* Frames produced in this window */
+    uint32_t adc_start_ms;
+    uint32_t adc_idle_from_ms; /* Search for the next window from here */
+    int16_t *adc_input; /* Interleaved mV, looped */
+    uint32_t adc_input_frames;
+
+    /* Results */
+    uint64_t cpu_ns[MOD_COUNT];
+    uint32_t sched_counts[JUXTA_SCHED_EVENT_COUNT];
+    uint64_t sched_late_ms_sum;
+    uint32_t sched_late_ms_max;
+    uint32_t sched_max_batch;
+    struct sim_record_stats records[REC_COUNT];
+    uint32_t minutes;
+    uint32_t minutes_skipped;
+    uint32_t minutes_low_battery;
+    uint32_t minutes_dropped;
+    uint32_t scan_bursts;
+    uint32_t adv_bursts;
+    uint32_t adv_heard;
+    uint64_t accel_samples;
+    uint32_t adc_polls;
+    uint64_t adc_frames_total;
+    uint32_t connections;
+
+    struct juxta_framfs_context fs;
+    struct juxta_framfs_ctx time_ctx;
+};
+
+static struct sim_state sim;
+static struct juxta_fram_device fram_dev;
+
+static uint64_t cpu_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t wall_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+#define SIM_TIMED(module, ...)                    \
+    do                                            \
+    {                                             \
+        uint64_t t0_ = cpu_now_ns();              \
+        __VA_ARGS__;                              \
+        sim.cpu_ns[module] += cpu_now_ns() - t0_; \
+    } while (0)
+
+static double rand_uniform(void)
+{
+    return (double)rand() / ((double)RAND_MAX + 1.0);
+}
+
+/* ----------------------------------------------------------------------------
+ * Virtual RTC
+ * ------------------------------------------------------------------------- */
+
+static uint32_t rtc_now(void)
+{
+    return sim.opt.start_unix + sim.now_ms / 1000U;
+}
+
+static uint32_t rtc_second_of_day(void)
+{
+    return rtc_now() % SIM_DAY_S;
+}
+
+/* File date callback for the time-aware file system (YYMMDD, as juxta_vitals_get_file_date()) */
+static uint32_t rtc_file_date(void)
+{
+    time_t t = (time_t)rtc_now();
+    struct tm tm;
+    gmtime_r(&t, &tm);
+    return (uint32_t)((tm.tm_year % 100) * 10000 + (tm.tm_mon + 1) * 100 + tm.tm_mday);
+}
+
+/* ----------------------------------------------------------------------------
+ * Scenario
+ * ------------------------------------------------------------------------- */
+
+static int parse_time_of_day(const char *s, uint32_t *out_s)
+{
+    unsigned h = 0, m = 0, sec = 0;
+    int n = sscanf(s, "%u:%u:%u", &h, &m, &sec);
+    if (n < 2 || m > 59 || sec > 59 || h * 3600U + m * 60U + sec > SIM_DAY_S)
+    {
+        return -1;
+    }
+    *out_s = h * 3600U + m * 60U + sec;
+    return 0;
+}
+
+static int parse_scene(const char *line, struct scene *sc)
+{
+    char kind[16];
+    char start[16];
+    char end[16];
+    char a[16] = "";
+    char b[16] = "";
+
+    int n = sscanf(line, "%15s %15s %15s %15s %15s", kind, start, end, a, b);
+    if (n < 3 || parse_time_of_day(start, &sc->start_s) != 0 || parse_time_of_day(end, &sc->end_s) != 0 ||
+        sc->end_s <= sc->start_s)
+    {
+        return -1;
+    }
+
+    sc->arg = 0;
+    sc->arg2 = 0;
+    if (strcmp(kind, "motion") == 0 && n == 4)
+    {
+        sc->kind = SCENE_MOTION;
+        sc->arg = atoi(a);
+    }
+    else if (strcmp(kind, "peer") == 0 && n == 5)
+    {
+        sc->kind = SCENE_PEER;
+        sc->arg = (int32_t)(strtoul(a, NULL, 16) & 0xFFFFFF);
+        sc->arg2 = CLAMP(atoi(b), -127, 0);
+        if (sc->arg == 0)
+        {
+            return -1; /* MAC ID 0 is ignored by the firmware */
+        }
+    }
+    else if (strcmp(kind, "adc") == 0 && n == 3)
+    {
+        sc->kind = SCENE_ADC;
+    }
+    else if (strcmp(kind, "gateway") == 0 && n == 3)
+    {
+        sc->kind = SCENE_GATEWAY;
+    }
+    else if (strcmp(kind, "lowbatt") == 0 && n == 3)
+    {
+        sc->kind = SCENE_LOW_BATTERY;
+    }
+    else
+    {
+        return -1;
+    }
+    return 0;
+}
+
+static int add_scene_line(const char *line, const char *where, int line_no)
+{
+    while (*line == ' ' || *line == '\t')
+    {
+        line++;
+    }
+    if (*line == '\0' || *line == '\n' || *line == '#')
+    {
+        return 0;
+    }
+    if (sim.scene_count >= SIM_MAX_SCENES)
+    {
+        fprintf(stderr, "%s:%d: more than %d scenes\n", where, line_no, SIM_MAX_SCENES);
+        return -1;
+    }
+    if (parse_scene(line, &sim.scenes[sim.scene_count]) != 0)
+    {
+        fprintf(stderr, "%s:%d: cannot parse '%s'\n", where, line_no, line);
+        return -1;
+    }
+    sim.scene_count++;
+    return 0;
+}
+
+static int load_scenario(const char *path)
+{
+    if (!path)
+    {
+        for (size_t i = 0; i < ARRAY_SIZE(default_scenario); i++)
+        {
+            if (add_scene_line(default_scenario[i], "built-in", (int)i + 1) != 0)
+            {
+                return -1;
+            }
+        }
+        return 0;
+    }
+
+    FILE *f = fopen(path, "r");
+    if (!f)
+    {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return -1;
+    }
+
+    char line[256];
+    int line_no = 0;
+    int ret = 0;
+    while (ret == 0 && fgets(line, sizeof(line), f))
+    {
+        line_no++;
+        line[strcspn(line, "\r\n")] = '\0';
+        ret = add_scene_line(line, path, line_no);
+    }
+    fclose(f);
+    return ret;
+}
+
+static const struct scene *scene_active(enum scene_kind kind, uint32_t second_of_day, uint32_t *index)
+{
+    for (uint32_t i = index ? *index : 0; i < sim.scene_count; i++)
+    {
+        const struct scene *sc = &sim.scenes[i];
+        if (sc->kind == kind && second_of_day >= sc->start_s && second_of_day < sc->end_s)
+        {
+            if (index)
+            {
+                *index = i + 1;
+            }
+            return sc;
+        }
+    }
+    return NULL;
+}
+
+/* ----------------------------------------------------------------------------
+ * Accelerometer model (LIS2DH12 FIFO at 25 Hz, mg)
+ * ------------------------------------------------------------------------- */
+
+static void accel_sample(uint32_t t_ms, int16_t *x, int16_t *y, int16_t *z)
+{
+    uint32_t sod = (sim.opt.start_unix + t_ms / 1000U) % SIM_DAY_S;
+    const struct scene *sc = scene_active(SCENE_MOTION, sod, NULL);
+    double ax = 0.0;
+    double ay = 0.0;
+    double az = 1000.0;
+
+    if (sc)
+    {
+        double phase = 2.0 * M_PI * SIM_GAIT_HZ * (t_ms / 1000.0);
+        ax += sc->arg * sin(phase);
+        ay += sc->arg * 0.5 * sin(phase + 1.0);
+        az += sc->arg * 0.7 * sin(2.0 * phase);
+    }
+
+    *x = (int16_t)lrint(ax + (rand_uniform() * 2.0 - 1.0) * SIM_ACCEL_NOISE_MG);
+    *y = (int16_t)lrint(ay + (rand_uniform() * 2.0 - 1.0) * SIM_ACCEL_NOISE_MG);
+    *z = (int16_t)lrint(az + (rand_uniform() * 2.0 - 1.0) * SIM_ACCEL_NOISE_MG);
+}
+
+/* Generate the FIFO contents first so only the accumulator is timed */
+#define SIM_ACCEL_BATCH 256
+
+static void accel_advance(uint32_t until_ms)
+{
+    static int16_t batch[SIM_ACCEL_BATCH][3];
+
+    while ((int32_t)(until_ms - sim.next_accel_ms) >= 0)
+    {
+        uint32_t n = 0;
+        while (n < SIM_ACCEL_BATCH && (int32_t)(until_ms - sim.next_accel_ms) >= 0)
+        {
+            accel_sample(sim.next_accel_ms, &batch[n][0], &batch[n][1], &batch[n][2]);
+            sim.next_accel_ms += SIM_ACCEL_PERIOD_MS;
+            n++;
+        }
+
+        uint64_t t0 = cpu_now_ns();
+        for (uint32_t i = 0; i < n; i++)
+        {
+            if (juxta_activity_add(&sim.activity, batch[i][0], batch[i][1], batch[i][2]) &&
+                sim.motion_count < UINT8_MAX)
+            {
+                sim.motion_count++;
+            }
+        }
+        sim.cpu_ns[MOD_ACTIVITY] += cpu_now_ns() - t0;
+        sim.accel_samples += n;
+    }
+}
+
+/* ----------------------------------------------------------------------------
+ * FRAM file system
+ * ------------------------------------------------------------------------- */
+
+/* Account one append to a record type */
+#define SIM_APPEND(rec, ...)                                                               \
+    do                                                                                     \
+    {                                                                                      \
+        struct fram_image_stats before_, after_;                                           \
+        uint32_t data_before_ = sim.fs.header.total_data_size;                             \
+        fram_image_get_stats(&before_);                                                    \
+        int ret_;                                                                          \
+        SIM_TIMED(MOD_FRAMFS, ret_ = (__VA_ARGS__));                                       \
+        fram_image_get_stats(&after_);                                                     \
+        sim.records[rec].fram_writes += after_.write_bytes - before_.write_bytes;          \
+        if (ret_ == 0)                                                                     \
+        {                                                                                  \
+            sim.records[rec].records++;                                                    \
+            sim.records[rec].bytes += sim.fs.header.total_data_size - data_before_;        \
+        }                                                                                  \
+        else                                                                               \
+        {                                                                                  \
+            sim.records[rec].failures++;                                                   \
+            if (sim.opt.verbose)                                                           \
+            {                                                                              \
+                fprintf(stderr, "%s append failed: %d\n", record_names[rec], ret_);        \
+            }                                                                              \
+        }                                                                                  \
+    } while (0)
+
+/* ----------------------------------------------------------------------------
+ * ADC capture (emulated SAADC feeding the ring in DMA blocks)
+ * ------------------------------------------------------------------------- */
+
+static int load_adc_csv(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    if (!f)
+    {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return -1;
+    }
+
+    uint32_t capacity = 0;
+    char line[256];
+    while (fgets(line, sizeof(line), f))
+    {
+        double mv[ADC_PIPELINE_CHANNELS];
+        char *p = line;
+        int ch;
+        for (ch = 0; ch < ADC_PIPELINE_CHANNELS; ch++)
+        {
+            char *endp;
+            mv[ch] = strtod(p, &endp);
+            if (endp == p)
+            {
+                break;
+            }
+            p = endp + strspn(endp, ", \t");
+        }
+        if (ch < ADC_PIPELINE_CHANNELS)
+        {
+            continue; /* Header or short line */
+        }
+
+        if (sim.adc_input_frames == capacity)
+        {
+            capacity = capacity ? capacity * 2 : 65536;
+            int16_t *grown = realloc(sim.adc_input, (size_t)capacity * ADC_PIPELINE_CHANNELS * sizeof(int16_t));
+            if (!grown)
+            {
+                fclose(f);
+                return -1;
+            }
+            sim.adc_input = grown;
+        }
+        for (ch = 0; ch < ADC_PIPELINE_CHANNELS; ch++)
+        {
+            sim.adc_input[(size_t)sim.adc_input_frames * ADC_PIPELINE_CHANNELS + ch] =
+                (int16_t)CLAMP(lrint(mv[ch]), -ADC_PIPELINE_MV_LIMIT, ADC_PIPELINE_MV_LIMIT);
+        }
+        sim.adc_input_frames++;
+    }
+    fclose(f);
+
+    if (sim.adc_input_frames < ADC_PIPELINE_BLOCK_SIZE)
+    {
+        fprintf(stderr, "%s: need at least %d frames\n", path, ADC_PIPELINE_BLOCK_SIZE);
+        return -1;
+    }
+    return 0;
+}
+
+/* One mV frame of the input: the CSV looped, or a synthetic pulse train */
+static void adc_frame(uint64_t frame, int16_t *out)
+{
+    if (sim.adc_input)
+    {
+        memcpy(out, &sim.adc_input[(frame % sim.adc_input_frames) * ADC_PIPELINE_CHANNELS],
+               ADC_PIPELINE_CHANNELS * sizeof(int16_t));
+        return;
+    }
+
+    uint64_t period = (uint64_t)llround(sim.opt.adc_rate_hz / sim.opt.adc_pulse_hz);
+    uint64_t width = MAX(sim.opt.adc_rate_hz / 1000U, 1U); /* 1 ms biphasic pulse */
+    uint64_t pos = period ? frame % period : width * 2;
+    for (int ch = 0; ch < ADC_PIPELINE_CHANNELS; ch++)
+    {
+        double mv = (rand_uniform() * 2.0 - 1.0) * sim.opt.adc_noise_mv;
+        if (ch == 0 && pos < width * 2)
+        {
+            mv += (pos < width) ? sim.opt.adc_pulse_mv : -sim.opt.adc_pulse_mv;
+        }
+        out[ch] = (int16_t)CLAMP(lrint(mv), -ADC_PIPELINE_MV_LIMIT, ADC_PIPELINE_MV_LIMIT);
+    }
+}
+
+static void adc_store_event(uint32_t trigger_pos)
+{
+    static int16_t extracted[ADC_PIPELINE_CHANNELS * ADC_PIPELINE_WINDOW_MAX];
+    static uint8_t scaled[ADC_PIPELINE_CHANNELS * ADC_PIPELINE_WINDOW_MAX];
+    uint8_t peak_pos[ADC_PIPELINE_CHANNELS];
+    uint8_t peak_neg[ADC_PIPELINE_CHANNELS];
+    uint32_t n;
+
+    uint64_t t0 = cpu_now_ns();
+    n = adc_pipeline_extract_centered(&sim.ring, trigger_pos, extracted, sim.opt.adc_window);
+    if (n > 0)
+    {
+        adc_pipeline_scale(extracted, n, scaled, peak_pos, peak_neg);
+    }
+    sim.cpu_ns[MOD_ADC] += cpu_now_ns() - t0;
+    if (n == 0)
+    {
+        return;
+    }
+
+    uint32_t duration_us = (uint32_t)((uint64_t)n * 1000000U / sim.opt.adc_rate_hz);
+    uint32_t us_offset = (sim.now_ms % 1000U) * 1000U;
+    if (sim.opt.adc_peaks_only)
+    {
+        SIM_APPEND(REC_ADC_EVENT,
+                   juxta_framfs_append_adc_event_channels(&sim.time_ctx, rtc_now(), us_offset,
+                                                          JUXTA_FRAMFS_ADC_EVENT_SINGLE_EVENT,
+                                                          ADC_PIPELINE_CHANNELS, NULL, 0, duration_us,
+                                                          peak_pos, peak_neg));
+    }
+    else
+    {
+        SIM_APPEND(REC_ADC_EVENT,
+                   juxta_framfs_append_adc_event_channels(&sim.time_ctx, rtc_now(), us_offset,
+                                                          JUXTA_FRAMFS_ADC_EVENT_PERI_EVENT,
+                                                          ADC_PIPELINE_CHANNELS, scaled, (uint16_t)n,
+                                                          duration_us, peak_pos, peak_neg));
+    }
+}
+
+static void adc_window_start(uint32_t start_ms, uint32_t end_ms)
+{
+    adc_pipeline_ring_reset(&sim.ring);
+    memset(&sim.det, 0, sizeof(sim.det));
+    sim.adc_active = true;
+    sim.adc_start_ms = start_ms;
+    sim.adc_window_end_ms = end_ms;
+    sim.adc_next_poll_ms = start_ms + SIM_ADC_POLL_MS;
+    sim.adc_frames = 0;
+}
+
+/* Start of the next ADC scene at or after @p from_ms, or UINT32_MAX */
+static uint32_t adc_next_window(uint32_t from_ms, uint32_t *end_ms)
+{
+    uint32_t best = UINT32_MAX;
+    uint32_t from_s = from_ms / 1000U;
+
+    for (uint32_t i = 0; i < sim.scene_count; i++)
+    {
+        const struct scene *sc = &sim.scenes[i];
+        if (sc->kind != SCENE_ADC)
+        {
+            continue;
+        }
+
+        /* Scenes repeat daily; uptime second s is RTC second of day (start + s) % day */
+        uint32_t sod = (sim.opt.start_unix + from_s) % SIM_DAY_S;
+        uint32_t day_base_s = from_s - sod;
+        uint32_t start_s = day_base_s + sc->start_s;
+        uint32_t stop_s = day_base_s + sc->end_s;
+        if (stop_s <= from_s)
+        {
+            start_s += SIM_DAY_S;
+            stop_s += SIM_DAY_S;
+        }
+        uint32_t start_ms = MAX(start_s * 1000U, from_ms);
+        if (start_ms < best)
+        {
+            best = start_ms;
+            *end_ms = stop_s * 1000U;
+        }
+    }
+    return best;
+}
+
+static void adc_advance(uint32_t until_ms)
+{
+    static int16_t block[ADC_PIPELINE_BLOCK_SIZE * ADC_PIPELINE_CHANNELS];
+
+    for (;;)
+    {
+        if (!sim.adc_active)
+        {
+            uint32_t end_ms = 0;
+            uint32_t start_ms = adc_next_window(sim.adc_idle_from_ms, &end_ms);
+            if (start_ms == UINT32_MAX || start_ms > until_ms)
+            {
+                return;
+            }
+            adc_window_start(start_ms, end_ms);
+        }
+
+        while (sim.adc_next_poll_ms <= until_ms && sim.adc_next_poll_ms < sim.adc_window_end_ms)
+        {
+            uint32_t poll_ms = sim.adc_next_poll_ms;
+            uint64_t due_frames = (uint64_t)(poll_ms - sim.adc_start_ms) * sim.opt.adc_rate_hz / 1000U;
+
+            /* DMA blocks completed by the poll time */
+            while (sim.adc_frames + ADC_PIPELINE_BLOCK_SIZE <= due_frames)
+            {
+                for (int i = 0; i < ADC_PIPELINE_BLOCK_SIZE; i++)
+                {
+                    adc_frame(sim.adc_frames + i, &block[i * ADC_PIPELINE_CHANNELS]);
+                }
+                sim.adc_frames += ADC_PIPELINE_BLOCK_SIZE;
+                sim.adc_frames_total += ADC_PIPELINE_BLOCK_SIZE;
+                uint32_t end_us = (uint32_t)((sim.adc_frames - 1) * 1000000ULL / sim.opt.adc_rate_hz);
+                SIM_TIMED(MOD_ADC, adc_pipeline_ring_add_block(&sim.ring, block, ADC_PIPELINE_BLOCK_SIZE,
+                                                               end_us, true));
+            }
+
+            uint32_t trigger_pos;
+            bool hit;
+            SIM_TIMED(MOD_ADC, hit = adc_pipeline_detect(&sim.det, &sim.ring, true, sim.opt.adc_threshold_mv,
+                                                         sim.opt.adc_debounce_ms, sim.opt.adc_window, poll_ms,
+                                                         &trigger_pos));
+            sim.adc_polls++;
+            sim.adc_next_poll_ms += SIM_ADC_POLL_MS;
+
+            if (hit)
+            {
+                uint32_t saved = sim.now_ms;
+                sim.now_ms = poll_ms;
+                adc_store_event(trigger_pos);
+                sim.now_ms = saved;
+            }
+        }
+
+        if (sim.adc_next_poll_ms < sim.adc_window_end_ms)
+        {
+            return; /* Window continues past until_ms */
+        }
+        sim.adc_active = false;
+        sim.adc_idle_from_ms = sim.adc_window_end_ms;
+    }
+}
+
+/* ----------------------------------------------------------------------------
+ * Radio (scripted peers instead of the controller)
+ * ------------------------------------------------------------------------- */
+
+static void scan_table_add(uint32_t mac_id, int8_t rssi)
+{
+    SIM_TIMED(MOD_RSSI_SERIES, (void)juxta_rssi_series_observe(&sim.series, mac_id, rssi));
+
+    for (uint8_t i = 0; i < sim.scan_count; i++)
+    {
+        if (sim.scan_ids[i] == mac_id)
+        {
+            sim.scan_rssi[i] = MAX(sim.scan_rssi[i], rssi);
+            return;
+        }
+    }
+    if (sim.scan_count < SIM_MAX_DEVICES)
+    {
+        sim.scan_ids[sim.scan_count] = mac_id;
+        sim.scan_rssi[sim.scan_count] = rssi;
+        sim.scan_count++;
+    }
+}
+
+/* Advertisements captured during the scan burst that ends now */
+static void scan_burst_receive(uint32_t start_ms, uint32_t end_ms)
+{
+    for (uint32_t t = start_ms; t < end_ms; t += SIM_ADV_EVENT_MS)
+    {
+        uint32_t sod = (sim.opt.start_unix + t / 1000U) % SIM_DAY_S;
+        uint32_t index = 0;
+        const struct scene *sc;
+        while ((sc = scene_active(SCENE_PEER, sod, &index)) != NULL)
+        {
+            if (rand_uniform() < SIM_CAPTURE_PROB)
+            {
+                int rssi = sc->arg2 + (int)lrint((rand_uniform() * 2.0 - 1.0) * SIM_RSSI_NOISE_DB);
+                scan_table_add((uint32_t)sc->arg, (int8_t)CLAMP(rssi, -127, 0));
+                sim.adv_heard++;
+            }
+        }
+    }
+}
+
+/* ----------------------------------------------------------------------------
+ * Scheduler port: the firmware's dispatch pass (src/sched_dispatch.c) on
+ * the virtual clock, with a one-shot timer the main loop fires
+ * ------------------------------------------------------------------------- */
+
+static uint32_t port_now_ms(void)
+{
+    return sim.now_ms;
+}
+
+/* Single threaded: nothing preempts the heap */
+static uint32_t port_lock(void)
+{
+    return 0;
+}
+
+static void port_unlock(uint32_t key)
+{
+    (void)key;
+}
+
+static void port_timer_start(uint32_t delay_ms)
+{
+    sim.timer_armed = true;
+    sim.timer_expiry_ms = sim.now_ms + delay_ms;
+}
+
+static void port_timer_stop(void)
+{
+    sim.timer_armed = false;
+}
+
+static const struct juxta_sched_port sim_port = {
+    .now_ms = port_now_ms,
+    .lock = port_lock,
+    .unlock = port_unlock,
+    .timer_start = port_timer_start,
+    .timer_stop = port_timer_stop,
+};
+
+/* ----------------------------------------------------------------------------
+ * State machine: a hand-written model of ble_schedule_bursts(),
+ * ble_burst_end(), the burst starts, minute_log_handler(), the minute
+ * writer and the periodic handlers in main.c. Changes there must be copied
+ * here.
+ * ------------------------------------------------------------------------- */
+
+static void sched_at(enum juxta_sched_event event, uint32_t deadline_ms)
+{
+    SIM_TIMED(MOD_SCHED, juxta_sched_dispatch_at(&sim.disp, event, deadline_ms));
+}
+
+static void sched_after(enum juxta_sched_event event, uint32_t delay_ms)
+{
+    sched_at(event, sim.now_ms + delay_ms);
+}
+
+static uint32_t adv_interval(void)
+{
+    return sim.opt.adaptive ? juxta_duty_adv_interval(&sim.duty) : sim.opt.adv_s;
+}
+
+static uint32_t scan_interval(void)
+{
+    return sim.opt.adaptive ? juxta_duty_scan_interval(&sim.duty) : sim.opt.scan_s;
+}
+
+static uint32_t seconds_until(uint32_t now_s, uint32_t last_s, uint32_t interval)
+{
+    uint32_t since = now_s - last_s;
+    return (since >= interval) ? 0 : (interval - since);
+}
+
+static uint32_t burst_deadline(uint32_t until_s)
+{
+    uint32_t delay_ms = MAX(until_s * 1000U, SIM_MIN_INTER_BURST_DELAY_MS);
+    return sim.now_ms + delay_ms + (uint32_t)(rand() % SIM_RANDOM_OFFSET_MS);
+}
+
+static void schedule_bursts(void)
+{
+    uint32_t now_s = rtc_now();
+    sched_at(JUXTA_SCHED_SCAN_BURST, burst_deadline(seconds_until(now_s, sim.last_scan_s, scan_interval())));
+    sched_at(JUXTA_SCHED_ADV_BURST, burst_deadline(seconds_until(now_s, sim.last_adv_s, adv_interval())));
+}
+
+static bool burst_prepare(enum juxta_sched_event event)
+{
+    if (sim.connected)
+    {
+        return false;
+    }
+    if (sim.radio_busy)
+    {
+        uint32_t end_ms;
+        if (juxta_sched_dispatch_pending(&sim.disp, JUXTA_SCHED_BURST_END, &end_ms))
+        {
+            sched_at(event, end_ms + SIM_MIN_INTER_BURST_DELAY_MS);
+        }
+        else
+        {
+            sched_after(event, SIM_MIN_INTER_BURST_DELAY_MS);
+        }
+        return false;
+    }
+    return true;
+}
+
+static uint32_t scan_started_ms;
+
+static void scan_burst_start(void)
+{
+    if (!burst_prepare(JUXTA_SCHED_SCAN_BURST))
+    {
+        return;
+    }
+    sim.scan_count = 0;
+    sim.radio_busy = true;
+    sim.scanning = true;
+    scan_started_ms = sim.now_ms;
+    sim.scan_bursts++;
+    sched_after(JUXTA_SCHED_BURST_END, SIM_SCAN_BURST_MS);
+}
+
+static void adv_burst_start(void)
+{
+    if (!burst_prepare(JUXTA_SCHED_ADV_BURST))
+    {
+        return;
+    }
+    sim.radio_busy = true;
+    sim.scanning = false;
+    sim.adv_bursts++;
+    sched_after(JUXTA_SCHED_BURST_END, SIM_ADV_BURST_MS);
+}
+
+static void burst_end(void)
+{
+    if (sim.connected)
+    {
+        return;
+    }
+
+    uint32_t now_s = rtc_now();
+    if (sim.scanning)
+    {
+        scan_burst_receive(scan_started_ms, sim.now_ms);
+        sim.last_scan_s = now_s;
+        SIM_TIMED(MOD_DUTY, juxta_duty_observe_scan(&sim.duty, sim.scan_ids, sim.scan_rssi, sim.scan_count, now_s));
+        SIM_TIMED(MOD_RSSI_SERIES, juxta_rssi_series_end_burst(&sim.series));
+    }
+    else if (sim.radio_busy)
+    {
+        sim.last_adv_s = now_s;
+    }
+    sim.radio_busy = false;
+    sim.scanning = false;
+    schedule_bursts();
+}
+
+static void minute_log_schedule(void)
+{
+    sched_after(JUXTA_SCHED_MINUTE_LOG, (60U - rtc_now() % 60U) * 1000U);
+}
+
+/* Battery gating of should_allow_fram_write(): the vitals low flag */
+static bool battery_low(void)
+{
+    return scene_active(SCENE_LOW_BATTERY, rtc_second_of_day(), NULL) != NULL;
+}
+
+/* minute_writer_thread_entry(): the writer holds records while a gateway is
+ * connected; activity and series records follow a successful device record */
+static void minute_writer_drain(void)
+{
+    while (sim.minute_q_count > 0 && !sim.connected)
+    {
+        const struct sim_minute_record *rec = &sim.minute_q[sim.minute_q_head];
+        sim.minute_q_head = (sim.minute_q_head + 1) % SIM_MINUTE_QUEUE_DEPTH;
+        sim.minute_q_count--;
+
+        /* Battery and temperature are constant; they do not change record sizes */
+        int ret;
+        SIM_APPEND(REC_DEVICE_SCAN,
+                   ret = juxta_framfs_append_device_scan_data(&sim.time_ctx, rec->minute, rec->motion_count, 90, 25,
+                                                              rec->device_count ? rec->mac_ids : NULL,
+                                                              rec->device_count ? rec->rssi_values : NULL,
+                                                              rec->device_count));
+
+        if (ret == 0 && rec->activity.samples > 0)
+        {
+            struct juxta_framfs_activity_record activity = {
+                .minute = rec->minute,
+                .samples = rec->activity.samples,
+                .odba_mg = rec->activity.odba_mg,
+                .vedba_mg = rec->activity.vedba_mg,
+                .sd_mg = rec->activity.sd_mg,
+                .posture = {rec->activity.posture[0], rec->activity.posture[1], rec->activity.posture[2]},
+            };
+            SIM_APPEND(REC_ACTIVITY, juxta_framfs_append_activity_data(&sim.time_ctx, &activity));
+        }
+
+        if (ret == 0 && rec->series_peers > 0)
+        {
+            SIM_APPEND(REC_RSSI_SERIES,
+                       juxta_framfs_append_rssi_series_data(&sim.time_ctx, rec->minute, rec->series_bursts,
+                                                            rec->series_mac_ids, rec->series_peers, rec->series,
+                                                            rec->series_len));
+        }
+    }
+}
+
+static void minute_log_handler(void)
+{
+    uint32_t now_s = rtc_now();
+    uint16_t minute = (uint16_t)((now_s % SIM_DAY_S) / 60U);
+    struct juxta_activity_minute act;
+
+    /* The accelerometer minute closes even when no record is written */
+    SIM_TIMED(MOD_ACTIVITY, juxta_activity_take(&sim.activity, &act));
+    sim.minutes++;
+
+    if (!sim.connected && battery_low())
+    {
+        sim.minutes_low_battery++;
+    }
+    else if (!sim.connected && sim.minute_q_count == SIM_MINUTE_QUEUE_DEPTH)
+    {
+        sim.minutes_dropped++;
+    }
+    else if (!sim.connected)
+    {
+        struct sim_minute_record *rec =
+            &sim.minute_q[(sim.minute_q_head + sim.minute_q_count) % SIM_MINUTE_QUEUE_DEPTH];
+        rec->minute = minute;
+        rec->motion_count = sim.motion_count;
+        rec->activity = act;
+        rec->device_count = sim.scan_count;
+        for (uint8_t i = 0; i < sim.scan_count; i++)
+        {
+            rec->mac_ids[i][0] = (sim.scan_ids[i] >> 16) & 0xFF;
+            rec->mac_ids[i][1] = (sim.scan_ids[i] >> 8) & 0xFF;
+            rec->mac_ids[i][2] = sim.scan_ids[i] & 0xFF;
+            rec->rssi_values[i] = sim.scan_rssi[i];
+        }
+
+        int series_len;
+        SIM_TIMED(MOD_RSSI_SERIES, {
+            juxta_rssi_series_finish(&sim.series);
+            series_len = juxta_rssi_series_serialize(&sim.series, rec->series_mac_ids, rec->series,
+                                                     sizeof(rec->series));
+        });
+        rec->series_bursts = sim.series.burst_count;
+        rec->series_peers = (series_len > 0) ? sim.series.peer_count : 0;
+        rec->series_len = (series_len > 0) ? (uint16_t)series_len : 0;
+        sim.minute_q_count++;
+    }
+    else
+    {
+        sim.minutes_skipped++;
+    }
+
+    /* The minute closes whether or not a record was queued */
+    SIM_TIMED(MOD_RSSI_SERIES, juxta_rssi_series_reset(&sim.series));
+    SIM_TIMED(MOD_DUTY, juxta_duty_observe_motion(&sim.duty, sim.motion_count, now_s));
+    sim.motion_count = 0;
+    minute_log_schedule();
+
+    /* The writer thread runs right after the work item on an idle system */
+    minute_writer_drain();
+}
+
+/* Gateway connection windows: connected() stops the burst, disconnect re-plans */
+static void gateway_update(void)
+{
+    bool want = scene_active(SCENE_GATEWAY, rtc_second_of_day(), NULL) != NULL;
+    if (want == sim.connected)
+    {
+        return;
+    }
+
+    sim.connected = want;
+    if (want)
+    {
+        sim.connections++;
+        sim.radio_busy = false;
+        sim.scanning = false;
+        SIM_TIMED(MOD_SCHED, juxta_sched_dispatch_cancel(&sim.disp, JUXTA_SCHED_EVENT_BIT(JUXTA_SCHED_BURST_END) |
+                                                                         JUXTA_SCHED_EVENT_BIT(JUXTA_SCHED_SCAN_BURST) |
+                                                                         JUXTA_SCHED_EVENT_BIT(JUXTA_SCHED_ADV_BURST)));
+    }
+    else
+    {
+        schedule_bursts();
+        minute_writer_drain();
+    }
+}
+
+/* Handler CPU is charged to the modules the handler calls, not the pass */
+#define SIM_HANDLER(...)                      \
+    do                                        \
+    {                                         \
+        uint64_t t0_ = cpu_now_ns();          \
+        __VA_ARGS__;                          \
+        sim.handler_ns += cpu_now_ns() - t0_; \
+    } while (0)
+
+static void on_health_check(uint32_t now_ms)
+{
+    SIM_HANDLER(sched_at(JUXTA_SCHED_HEALTH_CHECK, now_ms + SIM_HEALTH_CHECK_INTERVAL_MS));
+}
+
+static void on_battery_sample(uint32_t now_ms)
+{
+    SIM_HANDLER(sched_at(JUXTA_SCHED_BATTERY_SAMPLE, now_ms + SIM_BATTERY_SAMPLE_INTERVAL_MS));
+}
+
+static void on_minute_log(uint32_t now_ms)
+{
+    (void)now_ms;
+    SIM_HANDLER(minute_log_handler());
+}
+
+static void on_burst_end(uint32_t now_ms)
+{
+    (void)now_ms;
+    SIM_HANDLER(burst_end());
+}
+
+static void on_scan_burst(uint32_t now_ms)
+{
+    (void)now_ms;
+    SIM_HANDLER(scan_burst_start());
+}
+
+static void on_adv_burst(uint32_t now_ms)
+{
+    (void)now_ms;
+    SIM_HANDLER(adv_burst_start());
+}
+
+/* No LED (configured collar) and no ADC_ONLY mode; the state system is
+ * always ready */
+static const struct juxta_sched_handlers sim_handlers = {
+    .event = {
+        [JUXTA_SCHED_HEALTH_CHECK] = on_health_check,
+        [JUXTA_SCHED_MINUTE_LOG] = on_minute_log,
+        [JUXTA_SCHED_BURST_END] = on_burst_end,
+        [JUXTA_SCHED_SCAN_BURST] = on_scan_burst,
+        [JUXTA_SCHED_ADV_BURST] = on_adv_burst,
+        [JUXTA_SCHED_BATTERY_SAMPLE] = on_battery_sample,
+    },
+};
+
+/* The timer fired: run one pass as sched_work_handler() does and record
+ * lateness per dispatched event */
+static void sched_fire(void)
+{
+    uint32_t deadline_ms[JUXTA_SCHED_EVENT_COUNT] = {0};
+    for (int e = 0; e < JUXTA_SCHED_EVENT_COUNT; e++)
+    {
+        (void)juxta_sched_pending(&sim.disp.sched, e, &deadline_ms[e]);
+    }
+
+    sim.timer_armed = false;
+    uint64_t handler_ns = sim.handler_ns;
+    uint64_t t0 = cpu_now_ns();
+    uint32_t due = juxta_sched_dispatch_run(&sim.disp);
+    sim.cpu_ns[MOD_SCHED] += (cpu_now_ns() - t0) - (sim.handler_ns - handler_ns);
+
+    uint32_t batch = 0;
+    for (int e = 0; e < JUXTA_SCHED_EVENT_COUNT; e++)
+    {
+        if (due & JUXTA_SCHED_EVENT_BIT(e))
+        {
+            uint32_t late = sim.now_ms - deadline_ms[e];
+            sim.sched_counts[e]++;
+            sim.sched_late_ms_sum += late;
+            sim.sched_late_ms_max = MAX(sim.sched_late_ms_max, late);
+            batch++;
+        }
+    }
+    sim.sched_max_batch = MAX(sim.sched_max_batch, batch);
+}
+
+/* Time of the next gateway connect or disconnect after now, at 1 s resolution */
+static uint32_t gateway_next_edge(void)
+{
+    uint32_t sod = rtc_second_of_day();
+    uint32_t best_s = SIM_DAY_S;
+
+    for (uint32_t i = 0; i < sim.scene_count; i++)
+    {
+        const struct scene *sc = &sim.scenes[i];
+        if (sc->kind != SCENE_GATEWAY)
+        {
+            continue;
+        }
+        uint32_t edges[2] = {sc->start_s, sc->end_s};
+        for (int k = 0; k < 2; k++)
+        {
+            uint32_t delta = (edges[k] + SIM_DAY_S - sod) % SIM_DAY_S;
+            if (delta > 0 && delta < best_s)
+            {
+                best_s = delta;
+            }
+        }
+    }
+    /* Edges fall on RTC seconds; land just after the second boundary */
+    return sim.now_ms - sim.now_ms % 1000U + best_s * 1000U;
+}
+
+static void run(void)
+{
+    uint64_t wall_start = wall_now_ns();
+    uint64_t cpu_start = cpu_now_ns();
+
+    juxta_sched_dispatch_init(&sim.disp, sim_slack_ms, &sim_port, &sim_handlers);
+    sched_at(JUXTA_SCHED_HEALTH_CHECK, SIM_HEALTH_CHECK_INTERVAL_MS);
+    sched_at(JUXTA_SCHED_BATTERY_SAMPLE, SIM_BATTERY_SAMPLE_INTERVAL_MS);
+    minute_log_schedule();
+    gateway_update();
+    if (!sim.connected)
+    {
+        schedule_bursts();
+    }
+
+    while (sim.now_ms < sim.end_ms)
+    {
+        /* Only the armed timer wakes the system, as on target */
+        uint32_t edge_ms = gateway_next_edge();
+        uint32_t next_ms = sim.timer_armed ? MIN(sim.timer_expiry_ms, edge_ms) : edge_ms;
+        next_ms = MIN(MAX(next_ms, sim.now_ms), sim.end_ms);
+
+        /* Background producers run up to the wakeup, as the FIFO and DMA would */
+        accel_advance(next_ms);
+        adc_advance(next_ms);
+        sim.now_ms = next_ms;
+
+        if (next_ms == edge_ms)
+        {
+            gateway_update();
+        }
+        /* A gateway edge at the same instant may have re-armed the timer */
+        if (!sim.timer_armed || (int32_t)(sim.now_ms - sim.timer_expiry_ms) < 0)
+        {
+            continue;
+        }
+
+        sched_fire();
+
+        /* The pass must leave the timer armed while anything is pending */
+        uint32_t pending_ms;
+        if (!sim.timer_armed && juxta_sched_next_wakeup(&sim.disp.sched, &pending_ms))
+        {
+            fprintf(stderr, "Scheduler stalled at %u ms: timer idle, next event due at %u ms\n", sim.now_ms,
+                    pending_ms);
+            exit(1);
+        }
+    }
+
+    double wall_s = (wall_now_ns() - wall_start) / 1e9;
+    double cpu_s = (cpu_now_ns() - cpu_start) / 1e9;
+    double sim_s = sim.end_ms / 1000.0;
+    struct fram_image_stats fram;
+    fram_image_get_stats(&fram);
+
+    printf("Day simulation: %u day(s) from %u, %s intervals adv=%u s scan=%u s\n", sim.opt.days,
+           sim.opt.start_unix, sim.opt.adaptive ? "adaptive" : "fixed", sim.opt.adv_s, sim.opt.scan_s);
+    printf("  Scenario: %u scenes (%s)\n", sim.scene_count,
+           sim.opt.scenario_path ? sim.opt.scenario_path : "built-in");
+    printf("  Host: %.3f s wall (%.0fx real time), %.3f s CPU\n", wall_s, wall_s > 0 ? sim_s / wall_s : 0.0,
+           cpu_s);
+
+    printf("  Scheduler: %u wakeups, %u events (%.2f per wakeup, max %u), %.1f wakeups/h\n",
+           sim.disp.sched.wakeups, sim.disp.sched.dispatched,
+           sim.disp.sched.wakeups ? (double)sim.disp.sched.dispatched / sim.disp.sched.wakeups : 0.0, sim.sched_max_batch,
+           sim.disp.sched.wakeups * 3600.0 / sim_s);
+    printf("    lateness vs deadline: mean %.1f ms, max %u ms\n",
+           sim.disp.sched.dispatched ? (double)sim.sched_late_ms_sum / sim.disp.sched.dispatched : 0.0,
+           sim.sched_late_ms_max);
+    printf("    dispatched:");
+    for (int e = 0; e < JUXTA_SCHED_EVENT_COUNT; e++)
+    {
+        if (sim.sched_counts[e])
+        {
+            printf(" %s=%u", sched_names[e], sim.sched_counts[e]);
+        }
+    }
+    printf("\n");
+
+    double radio_ms = (double)sim.scan_bursts * SIM_SCAN_RADIO_ON_MS + (double)sim.adv_bursts * SIM_ADV_RADIO_ON_MS;
+    printf("  Radio: %u scan bursts, %u adv bursts, %u adverts heard, %.1f s/h on-time, %u gateway connection(s)\n",
+           sim.scan_bursts, sim.adv_bursts, sim.adv_heard, radio_ms / 1000.0 * 3600.0 / sim_s, sim.connections);
+    if (sim.opt.adaptive)
+    {
+        printf("    duty: level %u, %u faster / %u slower steps, %u new / %u lost peers\n", sim.duty.level,
+               sim.duty.steps_faster, sim.duty.steps_slower, sim.duty.new_peers, sim.duty.lost_peers);
+    }
+    printf("  Accelerometer: %llu samples\n", (unsigned long long)sim.accel_samples);
+    printf("  ADC: %llu frames, %u polls\n", (unsigned long long)sim.adc_frames_total, sim.adc_polls);
+    printf("  Minutes: %u closed, %u not written (gateway connected), %u skipped (low battery), %u dropped "
+           "(queue full)\n",
+           sim.minutes, sim.minutes_skipped, sim.minutes_low_battery, sim.minutes_dropped);
+
+    printf("  FRAM records:\n");
+    printf("    %-12s %8s %8s %10s %12s\n", "type", "records", "failed", "bytes", "fram writes");
+    uint64_t data_total = 0;
+    for (int r = 0; r < REC_COUNT; r++)
+    {
+        const struct sim_record_stats *st = &sim.records[r];
+        printf("    %-12s %8u %8u %10llu %12llu\n", record_names[r], st->records, st->failures,
+               (unsigned long long)st->bytes, (unsigned long long)st->fram_writes);
+        data_total += st->bytes;
+    }
+    printf("  FRAM traffic: %llu bytes written in %llu writes, %llu bytes read in %llu reads\n",
+           (unsigned long long)fram.write_bytes, (unsigned long long)fram.write_calls,
+           (unsigned long long)fram.read_bytes, (unsigned long long)fram.read_calls);
+
+    uint8_t usage = 0;
+    (void)juxta_framfs_get_memory_usage_percent(&sim.fs, &usage);
+    uint32_t free_bytes = JUXTA_FRAM_SIZE_BYTES - MIN(sim.fs.header.next_data_addr, JUXTA_FRAM_SIZE_BYTES);
+    double per_day = data_total * (double)SIM_DAY_S / sim_s;
+    printf("  FRAM usage: %u%% in %u file(s), %.0f bytes/day", usage, sim.fs.header.file_count, per_day);
+    if (per_day > 0)
+    {
+        printf(", full in %.1f more day(s)", free_bytes / per_day);
+    }
+    printf("\n");
+
+    static char names[JUXTA_FRAMFS_MAX_FILES][JUXTA_FRAMFS_FILENAME_LEN];
+    int files = juxta_framfs_list_files(&sim.fs, names, JUXTA_FRAMFS_MAX_FILES);
+    for (int i = 0; i < files; i++)
+    {
+        struct juxta_framfs_entry entry;
+        if (juxta_framfs_get_file_info(&sim.fs, names[i], &entry) == 0)
+        {
+            printf("    %-8s %6u bytes at 0x%05X%s\n", names[i], entry.length, entry.start_addr,
+                   (entry.flags & JUXTA_FRAMFS_FLAG_ACTIVE) ? " (active)" : "");
+        }
+    }
+
+    printf("  Firmware CPU (host):\n");
+    for (int m = 0; m < MOD_COUNT; m++)
+    {
+        printf("    %-12s %10.3f ms\n", module_names[m], sim.cpu_ns[m] / 1e6);
+    }
+}
+
+/* ----------------------------------------------------------------------------
+ * Setup
+ * ------------------------------------------------------------------------- */
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  --scenario FILE      Scenario script (default: built-in day)\n"
+            "  --days N             Days to run (default 1)\n"
+            "  --start UNIX         RTC at start, aligned down to midnight (default 1748736000)\n"
+            "  --image FILE         FRAM image to load (if present) and save at the end\n"
+            "  --seed N             Random seed (default 1)\n"
+            "  --adv S / --scan S   Burst intervals in s (default 5 / 20)\n"
+            "  --adaptive           Use the adaptive duty controller\n"
+            "  --adc-csv FILE       SAADC waveform in mV, one frame per line, looped\n"
+            "  --adc-rate HZ        Sample rate (default 10000)\n"
+            "  --adc-threshold MV   Trigger threshold (default 100)\n"
+            "  --adc-debounce MS    Minimum time between events (default 10)\n"
+            "  --adc-window N       Samples per channel per event (default 200)\n"
+            "  --adc-peaks-only     Store peaks instead of waveforms\n"
+            "  --adc-pulse-hz F     Synthetic pulse rate without --adc-csv (default 1)\n"
+            "  --verbose            Report failed appends\n",
+            prog);
+}
+
+static int parse_args(int argc, char **argv, struct sim_options *opt)
+{
+    *opt = (struct sim_options){
+        .days = 1,
+        .start_unix = 1748736000U, /* 2025-06-01 00:00:00 UTC */
+        .seed = 1,
+        .adv_s = 5,
+        .scan_s = 20,
+        .adc_rate_hz = 10000,
+        .adc_threshold_mv = 100,
+        .adc_debounce_ms = 10,
+        .adc_window = ADC_PIPELINE_WINDOW_DEFAULT,
+        .adc_pulse_hz = 1.0,
+        .adc_pulse_mv = 500.0,
+        .adc_noise_mv = 20.0,
+    };
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *a = argv[i];
+        const char *v = (i + 1 < argc) ? argv[i + 1] : NULL;
+        bool takes_value = true;
+
+        if (strcmp(a, "--adaptive") == 0)
+        {
+            opt->adaptive = true;
+            takes_value = false;
+        }
+        else if (strcmp(a, "--adc-peaks-only") == 0)
+        {
+            opt->adc_peaks_only = true;
+            takes_value = false;
+        }
+        else if (strcmp(a, "--verbose") == 0)
+        {
+            opt->verbose = true;
+            takes_value = false;
+        }
+        else if (!v)
+        {
+            usage(argv[0]);
+            return -1;
+        }
+        else if (strcmp(a, "--scenario") == 0)
+        {
+            opt->scenario_path = v;
+        }
+        else if (strcmp(a, "--days") == 0)
+        {
+            opt->days = (uint32_t)strtoul(v, NULL, 0);
+        }
+        else if (strcmp(a, "--start") == 0)
+        {
+            opt->start_unix = (uint32_t)strtoul(v, NULL, 0);
+        }
+        else if (strcmp(a, "--image") == 0)
+        {
+            opt->image_path = v;
+        }
+        else if (strcmp(a, "--seed") == 0)
+        {
+            opt->seed = (uint32_t)strtoul(v, NULL, 0);
+        }
+        else if (strcmp(a, "--adv") == 0)
+        {
+            opt->adv_s = (uint16_t)strtoul(v, NULL, 0);
+        }
+        else if (strcmp(a, "--scan") == 0)
+        {
+            opt->scan_s = (uint16_t)strtoul(v, NULL, 0);
+        }
+        else if (strcmp(a, "--adc-csv") == 0)
+        {
+            opt->adc_csv_path = v;
+        }
+        else if (strcmp(a, "--adc-rate") == 0)
+        {
+            opt->adc_rate_hz = (uint32_t)strtoul(v, NULL, 0);
+        }
+        else if (strcmp(a, "--adc-threshold") == 0)
+        {
+            opt->adc_threshold_mv = (int32_t)strtol(v, NULL, 0);
+        }
+        else if (strcmp(a, "--adc-debounce") == 0)
+        {
+            opt->adc_debounce_ms = (uint32_t)strtoul(v, NULL, 0);
+        }
+        else if (strcmp(a, "--adc-window") == 0)
+        {
+            opt->adc_window = (uint32_t)strtoul(v, NULL, 0);
+        }
+        else if (strcmp(a, "--adc-pulse-hz") == 0)
+        {
+            opt->adc_pulse_hz = strtod(v, NULL);
+        }
+        else
+        {
+            usage(argv[0]);
+            return -1;
+        }
+        if (takes_value)
+        {
+            i++;
+        }
+    }
+
+    /* 32-bit uptime in ms wraps after 49 days */
+    if (opt->days < 1 || opt->days > 45 || opt->adv_s == 0 || opt->scan_s == 0 || opt->adc_rate_hz < 1000 ||
+        opt->adc_window < ADC_PIPELINE_WINDOW_MIN || opt->adc_window > ADC_PIPELINE_WINDOW_MAX ||
+        opt->adc_pulse_hz <= 0.0)
+    {
+        fprintf(stderr, "Invalid option value\n");
+        return -1;
+    }
+    opt->start_unix -= opt->start_unix % SIM_DAY_S;
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (parse_args(argc, argv, &sim.opt) != 0)
+    {
+        return 1;
+    }
+    srand(sim.opt.seed);
+
+    if (load_scenario(sim.opt.scenario_path) != 0)
+    {
+        return 1;
+    }
+    if (sim.opt.adc_csv_path && load_adc_csv(sim.opt.adc_csv_path) != 0)
+    {
+        return 1;
+    }
+
+    if (fram_image_init(&fram_dev, sim.opt.image_path) != 0)
+    {
+        fprintf(stderr, "Cannot read FRAM image %s\n", sim.opt.image_path);
+        return 1;
+    }
+    if (juxta_framfs_init(&sim.fs, &fram_dev) != 0 ||
+        juxta_framfs_init_with_time(&sim.time_ctx, &sim.fs, rtc_file_date, true) != 0)
+    {
+        fprintf(stderr, "FRAM file system init failed\n");
+        return 1;
+    }
+
+    struct juxta_duty_cfg duty_cfg = {
+        .adv_min_s = sim.opt.adv_s,
+        .adv_max_s = sim.opt.adv_s * SIM_DUTY_MAX_FACTOR,
+        .scan_min_s = sim.opt.scan_s,
+        .scan_max_s = sim.opt.scan_s * SIM_DUTY_MAX_FACTOR,
+        .adv_on_ms = SIM_ADV_RADIO_ON_MS,
+        .scan_on_ms = SIM_SCAN_RADIO_ON_MS,
+        .hold_s = SIM_DUTY_HOLD_S,
+        .churn_db = SIM_DUTY_CHURN_DB,
+        .motion_threshold = SIM_DUTY_MOTION_THRESHOLD,
+    };
+    juxta_duty_init(&sim.duty, &duty_cfg);
+    juxta_activity_init(&sim.activity, SIM_ACCEL_ODR_HZ, SIM_ACCEL_MOTION_MG);
+    juxta_rssi_series_reset(&sim.series);
+    sim.last_adv_s = sim.opt.start_unix;
+    sim.last_scan_s = sim.opt.start_unix;
+    sim.end_ms = sim.opt.days * SIM_DAY_S * 1000U;
+
+    run();
+
+    if (sim.opt.image_path && fram_image_save(sim.opt.image_path) != 0)
+    {
+        fprintf(stderr, "Cannot write FRAM image %s\n", sim.opt.image_path);
+        return 1;
+    }
+    free(sim.adc_input);
+    return 0;
+}
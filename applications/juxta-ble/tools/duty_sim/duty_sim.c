@@ -0,0 +1,477 @@
+/*
+ * JUXTA Duty Cycle Simulation
+ * Runs a group of simulated collars through the same contact and motion
+ * trace under each interval policy (fixed, inactivity doubler, adaptive
+ * controller from src/duty_cycle.c) and compares detection rate with
+ * radio on-time.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "duty_cycle.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+
+/* Firmware burst timing (main.c) */
+#define SIM_TICK_MS 100
+#define SIM_ADV_BURST_MS 2000
+#define SIM_SCAN_BURST_MS 1500
+#define SIM_MIN_GAP_MS 100
+#define SIM_RANDOM_OFFSET_MS 1000
+#define SIM_ADV_RADIO_ON_MS 20                      /* ADV_BURST_RADIO_ON_MS */
+#define SIM_SCAN_RADIO_ON_MS (SIM_SCAN_BURST_MS / 4) /* SCAN_BURST_RADIO_ON_MS */
+
+/* Radio link: 100-200 ms adv interval, 25% scan window, 90% reception */
+#define SIM_ADV_EVENT_MS 150
+#define SIM_CAPTURE_PROB (0.25 * 0.9)
+
+#define SIM_MAX_COLLARS 32
+
+enum sim_policy
+{
+    POLICY_FIXED = 0,
+    POLICY_DOUBLER,
+    POLICY_ADAPTIVE,
+    POLICY_COUNT
+};
+
+static const char *const policy_names[POLICY_COUNT] = {"fixed", "doubler", "adaptive"};
+
+struct sim_options
+{
+    uint32_t collars;
+    double hours;
+    uint32_t seed;
+    uint16_t adv_s;
+    uint16_t scan_s;
+    uint16_t adv_max_s;
+    uint16_t scan_max_s;
+    uint32_t budget_s;
+    uint16_t hold_s;
+    double contacts_per_hour; /* Per pair */
+    double contact_minutes;   /* Mean contact length */
+    int policy;               /* -1 = all */
+};
+
+/* Per-minute ground truth shared by all policies */
+struct sim_trace
+{
+    uint32_t minutes;
+    uint32_t collars;
+    uint8_t *contact; /* [minute][a][b], symmetric */
+    int8_t *rssi;     /* [minute][a][b] */
+    uint8_t *motion;  /* [minute][collar] */
+};
+
+struct sim_collar
+{
+    int64_t next_adv_ms;
+    int64_t next_scan_ms;
+    int64_t busy_until_ms;
+    bool scanning;
+    bool advertising;
+    int64_t last_adv_end_ms;
+    int64_t last_scan_end_ms;
+    bool extended; /* Doubler: no motion last minute */
+    uint8_t found[SIM_MAX_COLLARS];
+    int8_t found_rssi[SIM_MAX_COLLARS];
+    uint8_t record[SIM_MAX_COLLARS]; /* Peers in the current minute record */
+    struct juxta_duty_ctrl ctrl;
+    uint32_t adv_bursts;
+    uint32_t scan_bursts;
+};
+
+struct sim_result
+{
+    uint64_t contact_minutes; /* Directed pair-minutes in contact */
+    uint64_t logged_minutes;  /* ... that appear in the minute record */
+    uint32_t episodes;        /* Directed contact episodes */
+    uint32_t episodes_found;  /* ... logged at least once */
+    uint64_t adv_bursts;
+    uint64_t scan_bursts;
+};
+
+static uint32_t rng_state;
+
+static double rng_uniform(void)
+{
+    /* xorshift32 */
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return (rng_state >> 8) * (1.0 / 16777216.0);
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "Population:\n"
+            "  --collars N          Simulated collars (default 8, max %d)\n"
+            "  --hours H            Simulated time (default 24)\n"
+            "  --contact-rate R     Contacts per pair per hour (default 0.2)\n"
+            "  --contact-min M      Mean contact length in minutes (default 5)\n"
+            "  --seed N             Trace seed (default 1)\n"
+            "Intervals (same meaning as the gateway settings):\n"
+            "  --adv S              advInterval (default 5)\n"
+            "  --scan S             scanInterval (default 20)\n"
+            "  --adv-max S          advIntervalMax (default 2x adv)\n"
+            "  --scan-max S         scanIntervalMax (default 2x scan)\n"
+            "  --budget S           radioBudget in s/h (default 0 = unlimited)\n"
+            "  --hold S             Adaptive quiet time per step (default 120)\n"
+            "  --policy P           fixed|doubler|adaptive (default all)\n",
+            prog, SIM_MAX_COLLARS);
+}
+
+static int parse_args(int argc, char **argv, struct sim_options *opt)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        const char *val = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (strcmp(arg, "--collars") == 0 && val)
+            opt->collars = (uint32_t)atoi(val), i++;
+        else if (strcmp(arg, "--hours") == 0 && val)
+            opt->hours = atof(val), i++;
+        else if (strcmp(arg, "--contact-rate") == 0 && val)
+            opt->contacts_per_hour = atof(val), i++;
+        else if (strcmp(arg, "--contact-min") == 0 && val)
+            opt->contact_minutes = atof(val), i++;
+        else if (strcmp(arg, "--seed") == 0 && val)
+            opt->seed = (uint32_t)strtoul(val, NULL, 0), i++;
+        else if (strcmp(arg, "--adv") == 0 && val)
+            opt->adv_s = (uint16_t)atoi(val), i++;
+        else if (strcmp(arg, "--scan") == 0 && val)
+            opt->scan_s = (uint16_t)atoi(val), i++;
+        else if (strcmp(arg, "--adv-max") == 0 && val)
+            opt->adv_max_s = (uint16_t)atoi(val), i++;
+        else if (strcmp(arg, "--scan-max") == 0 && val)
+            opt->scan_max_s = (uint16_t)atoi(val), i++;
+        else if (strcmp(arg, "--budget") == 0 && val)
+            opt->budget_s = (uint32_t)atoi(val), i++;
+        else if (strcmp(arg, "--hold") == 0 && val)
+            opt->hold_s = (uint16_t)atoi(val), i++;
+        else if (strcmp(arg, "--policy") == 0 && val)
+        {
+            opt->policy = -1;
+            for (int p = 0; p < POLICY_COUNT; p++)
+            {
+                if (strcmp(val, policy_names[p]) == 0)
+                    opt->policy = p;
+            }
+            if (opt->policy < 0)
+                return -1;
+            i++;
+        }
+        else
+            return -1;
+    }
+
+    if (opt->collars < 2 || opt->collars > SIM_MAX_COLLARS || opt->hours <= 0 ||
+        opt->adv_s == 0 || opt->scan_s == 0 || opt->contact_minutes < 1)
+    {
+        return -1;
+    }
+    if (!opt->adv_max_s)
+        opt->adv_max_s = opt->adv_s * 2;
+    if (!opt->scan_max_s)
+        opt->scan_max_s = opt->scan_s * 2;
+    return 0;
+}
+
+static size_t pair_index(const struct sim_trace *tr, uint32_t minute, uint32_t a, uint32_t b)
+{
+    return ((size_t)minute * tr->collars + a) * tr->collars + b;
+}
+
+/* Markov contact and motion trace; contacts start more often while moving */
+static int generate_trace(const struct sim_options *opt, struct sim_trace *tr)
+{
+    tr->minutes = (uint32_t)(opt->hours * 60.0);
+    tr->collars = opt->collars;
+    size_t pairs = (size_t)tr->minutes * tr->collars * tr->collars;
+    tr->contact = calloc(pairs, 1);
+    tr->rssi = calloc(pairs, 1);
+    tr->motion = calloc((size_t)tr->minutes * tr->collars, 1);
+    if (!tr->contact || !tr->rssi || !tr->motion)
+    {
+        return -1;
+    }
+
+    rng_state = opt->seed ? opt->seed : 1;
+    bool moving[SIM_MAX_COLLARS] = {0};
+    double p_start = opt->contacts_per_hour / 60.0;
+    double p_end = 1.0 / opt->contact_minutes;
+
+    for (uint32_t m = 0; m < tr->minutes; m++)
+    {
+        for (uint32_t c = 0; c < tr->collars; c++)
+        {
+            moving[c] = moving[c] ? (rng_uniform() > 0.2) : (rng_uniform() < 0.05);
+            tr->motion[(size_t)m * tr->collars + c] = moving[c] ? (uint8_t)(3 + rng_uniform() * 12) : 0;
+        }
+
+        for (uint32_t a = 0; a < tr->collars; a++)
+        {
+            for (uint32_t b = a + 1; b < tr->collars; b++)
+            {
+                bool was = m && tr->contact[pair_index(tr, m - 1, a, b)];
+                double start = p_start * ((moving[a] || moving[b]) ? 3.0 : 0.5);
+                bool now = was ? (rng_uniform() > p_end) : (rng_uniform() < start);
+                int8_t rssi = -90 + (int8_t)(rng_uniform() * 35);
+                if (was && now)
+                {
+                    /* Slow RSSI walk while the contact lasts */
+                    rssi = tr->rssi[pair_index(tr, m - 1, a, b)] + (int8_t)(rng_uniform() * 7) - 3;
+                }
+                tr->contact[pair_index(tr, m, a, b)] = now;
+                tr->contact[pair_index(tr, m, b, a)] = now;
+                tr->rssi[pair_index(tr, m, a, b)] = rssi;
+                tr->rssi[pair_index(tr, m, b, a)] = rssi;
+            }
+        }
+    }
+    return 0;
+}
+
+static uint16_t policy_interval(const struct sim_collar *col, enum sim_policy policy, bool adv,
+                                const struct sim_options *opt)
+{
+    switch (policy)
+    {
+    case POLICY_ADAPTIVE:
+        return adv ? juxta_duty_adv_interval(&col->ctrl) : juxta_duty_scan_interval(&col->ctrl);
+    case POLICY_DOUBLER:
+        return (adv ? opt->adv_s : opt->scan_s) * (col->extended ? 2 : 1);
+    default:
+        return adv ? opt->adv_s : opt->scan_s;
+    }
+}
+
+/* Next burst after @p last_end, like ble_schedule_bursts() */
+static int64_t next_burst(int64_t now_ms, int64_t last_end_ms, uint16_t interval_s)
+{
+    int64_t due = last_end_ms + (int64_t)interval_s * 1000;
+    int64_t delay = due - now_ms;
+    if (delay < SIM_MIN_GAP_MS)
+        delay = SIM_MIN_GAP_MS;
+    return now_ms + delay + (int64_t)(rng_uniform() * SIM_RANDOM_OFFSET_MS);
+}
+
+static void run_policy(const struct sim_options *opt, const struct sim_trace *tr,
+                       enum sim_policy policy, struct sim_result *res)
+{
+    static struct sim_collar col[SIM_MAX_COLLARS];
+    uint32_t n = tr->collars;
+    struct juxta_duty_cfg cfg = {
+        .adv_min_s = opt->adv_s,
+        .adv_max_s = opt->adv_max_s,
+        .scan_min_s = opt->scan_s,
+        .scan_max_s = opt->scan_max_s,
+        .budget_ms = opt->budget_s * 1000U,
+        .adv_on_ms = SIM_ADV_RADIO_ON_MS,
+        .scan_on_ms = SIM_SCAN_RADIO_ON_MS,
+        .hold_s = opt->hold_s,
+        .churn_db = 6,
+        .motion_threshold = 3,
+    };
+
+    memset(col, 0, sizeof(col));
+    memset(res, 0, sizeof(*res));
+    rng_state = opt->seed * 7919U + (uint32_t)policy + 1;
+
+    for (uint32_t c = 0; c < n; c++)
+    {
+        juxta_duty_init(&col[c].ctrl, &cfg);
+        col[c].next_adv_ms = (int64_t)(rng_uniform() * opt->adv_s * 1000);
+        col[c].next_scan_ms = (int64_t)(rng_uniform() * opt->scan_s * 1000);
+    }
+
+    static uint8_t episode_found[SIM_MAX_COLLARS][SIM_MAX_COLLARS];
+    memset(episode_found, 0, sizeof(episode_found));
+    double p_tick = 1.0 - pow(1.0 - SIM_CAPTURE_PROB, (double)SIM_TICK_MS / SIM_ADV_EVENT_MS);
+    int64_t end_ms = (int64_t)tr->minutes * 60000;
+
+    for (int64_t t = 0; t < end_ms; t += SIM_TICK_MS)
+    {
+        uint32_t minute = (uint32_t)(t / 60000);
+        uint32_t now_s = (uint32_t)(t / 1000);
+
+        if (t % 60000 == 0)
+        {
+            for (uint32_t a = 0; a < n; a++)
+            {
+                /* Close the previous minute's record, then feed motion */
+                if (minute > 0)
+                {
+                    for (uint32_t b = 0; b < n; b++)
+                    {
+                        if (a == b || !tr->contact[pair_index(tr, minute - 1, a, b)])
+                            continue;
+                        res->contact_minutes++;
+                        if (col[a].record[b])
+                        {
+                            res->logged_minutes++;
+                            episode_found[a][b] = 1;
+                        }
+                    }
+                    uint8_t motion = tr->motion[(size_t)(minute - 1) * n + a];
+                    col[a].extended = (motion == 0);
+                    if (policy == POLICY_ADAPTIVE)
+                        juxta_duty_observe_motion(&col[a].ctrl, motion, now_s);
+                }
+                memset(col[a].record, 0, sizeof(col[a].record));
+
+                /* Directed episodes end when the contact does */
+                for (uint32_t b = 0; b < n; b++)
+                {
+                    if (a == b || minute == 0)
+                        continue;
+                    bool was = tr->contact[pair_index(tr, minute - 1, a, b)];
+                    bool now = minute < tr->minutes && tr->contact[pair_index(tr, minute, a, b)];
+                    if (was && !now)
+                    {
+                        res->episodes++;
+                        res->episodes_found += episode_found[a][b];
+                        episode_found[a][b] = 0;
+                    }
+                }
+            }
+        }
+
+        for (uint32_t a = 0; a < n; a++)
+        {
+            struct sim_collar *c = &col[a];
+
+            if (c->scanning)
+            {
+                for (uint32_t b = 0; b < n; b++)
+                {
+                    if (b != a && col[b].advertising && tr->contact[pair_index(tr, minute, a, b)] &&
+                        rng_uniform() < p_tick)
+                    {
+                        c->found[b] = 1;
+                        c->found_rssi[b] = tr->rssi[pair_index(tr, minute, a, b)];
+                    }
+                }
+            }
+
+            if (t < c->busy_until_ms)
+                continue;
+
+            /* Burst end: scan table becomes the minute record, then re-plan */
+            if (c->scanning || c->advertising)
+            {
+                if (c->scanning)
+                {
+                    uint32_t ids[SIM_MAX_COLLARS];
+                    int8_t rssi[SIM_MAX_COLLARS];
+                    uint8_t count = 0;
+                    memcpy(c->record, c->found, sizeof(c->record));
+                    for (uint32_t b = 0; b < n; b++)
+                    {
+                        if (c->found[b])
+                        {
+                            ids[count] = b;
+                            rssi[count++] = c->found_rssi[b];
+                        }
+                    }
+                    if (policy == POLICY_ADAPTIVE)
+                        juxta_duty_observe_scan(&c->ctrl, ids, rssi, count, now_s);
+                    c->last_scan_end_ms = t;
+                }
+                else
+                {
+                    c->last_adv_end_ms = t;
+                }
+                c->scanning = c->advertising = false;
+                c->next_scan_ms = next_burst(t, c->last_scan_end_ms, policy_interval(c, policy, false, opt));
+                c->next_adv_ms = next_burst(t, c->last_adv_end_ms, policy_interval(c, policy, true, opt));
+                continue;
+            }
+
+            if (t >= c->next_scan_ms)
+            {
+                c->scanning = true;
+                c->busy_until_ms = t + SIM_SCAN_BURST_MS;
+                memset(c->found, 0, sizeof(c->found));
+                c->scan_bursts++;
+            }
+            else if (t >= c->next_adv_ms)
+            {
+                c->advertising = true;
+                c->busy_until_ms = t + SIM_ADV_BURST_MS;
+                c->adv_bursts++;
+            }
+        }
+    }
+
+    for (uint32_t c = 0; c < n; c++)
+    {
+        res->adv_bursts += col[c].adv_bursts;
+        res->scan_bursts += col[c].scan_bursts;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    struct sim_options opt = {
+        .collars = 8,
+        .hours = 24.0,
+        .seed = 1,
+        .adv_s = 5,
+        .scan_s = 20,
+        .hold_s = 120,
+        .contacts_per_hour = 0.2,
+        .contact_minutes = 5.0,
+        .policy = -1,
+    };
+
+    if (parse_args(argc, argv, &opt) != 0)
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    struct sim_trace tr = {0};
+    if (generate_trace(&opt, &tr) != 0)
+    {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    printf("Duty sim: %u collars, %.1f h, adv %u-%u s, scan %u-%u s, budget %u s/h\n",
+           opt.collars, opt.hours, opt.adv_s, opt.adv_max_s, opt.scan_s, opt.scan_max_s, opt.budget_s);
+    printf("  %-9s %10s %10s %8s %8s %12s %7s\n",
+           "policy", "minutes", "episodes", "scans/h", "advs/h", "radio ms/h", "duty");
+
+    double collar_hours = opt.collars * opt.hours;
+    for (int p = 0; p < POLICY_COUNT; p++)
+    {
+        if (opt.policy >= 0 && opt.policy != p)
+            continue;
+
+        struct sim_result res;
+        run_policy(&opt, &tr, (enum sim_policy)p, &res);
+
+        double scans_h = res.scan_bursts / collar_hours;
+        double advs_h = res.adv_bursts / collar_hours;
+        double on_ms_h = scans_h * SIM_SCAN_RADIO_ON_MS + advs_h * SIM_ADV_RADIO_ON_MS;
+        printf("  %-9s %9.1f%% %9.1f%% %8.1f %8.1f %12.0f %6.2f%%\n",
+               policy_names[p],
+               res.contact_minutes ? 100.0 * res.logged_minutes / res.contact_minutes : 0.0,
+               res.episodes ? 100.0 * res.episodes_found / res.episodes : 0.0,
+               scans_h, advs_h, on_ms_h, on_ms_h / 36000.0);
+    }
+
+    free(tr.contact);
+    free(tr.rssi);
+    free(tr.motion);
+    return 0;
+}
@@ -0,0 +1,99 @@
+/*
+ * JUXTA Host Tools - Emulated FRAM
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "fram_image.h"
+#include <stdio.h>
+#include <string.h>
+
+static uint8_t image[JUXTA_FRAM_SIZE_BYTES];
+static struct fram_image_stats stats;
+
+int fram_image_init(struct juxta_fram_device *dev, const char *path)
+{
+    memset(dev, 0, sizeof(*dev));
+    memset(image, 0xFF, sizeof(image));
+    memset(&stats, 0, sizeof(stats));
+
+    if (path)
+    {
+        FILE *f = fopen(path, "rb");
+        if (f)
+        {
+            /* A short image reads as erased past its end */
+            bool failed = fread(image, 1, sizeof(image), f) < sizeof(image) && ferror(f);
+            fclose(f);
+            if (failed)
+            {
+                return -1;
+            }
+        }
+    }
+
+    dev->initialized = true;
+    return 0;
+}
+
+int fram_image_save(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f)
+    {
+        return -1;
+    }
+    size_t n = fwrite(image, 1, sizeof(image), f);
+    return (fclose(f) == 0 && n == sizeof(image)) ? 0 : -1;
+}
+
+void fram_image_get_stats(struct fram_image_stats *out)
+{
+    *out = stats;
+}
+
+static int check_access(const struct juxta_fram_device *dev, uint32_t address, const void *data, size_t length)
+{
+    if (!dev || !data)
+    {
+        return JUXTA_FRAM_ERROR;
+    }
+    if (!dev->initialized)
+    {
+        return JUXTA_FRAM_ERROR_INIT;
+    }
+    if (address >= JUXTA_FRAM_SIZE_BYTES || length > JUXTA_FRAM_SIZE_BYTES - address)
+    {
+        return JUXTA_FRAM_ERROR_ADDR;
+    }
+    return JUXTA_FRAM_OK;
+}
+
+int juxta_fram_write(struct juxta_fram_device *fram_dev, uint32_t address, const uint8_t *data, size_t length)
+{
+    int ret = check_access(fram_dev, address, data, length);
+    if (ret != JUXTA_FRAM_OK)
+    {
+        return ret;
+    }
+
+    memcpy(&image[address], data, length);
+    stats.write_calls++;
+    stats.write_bytes += length;
+    return JUXTA_FRAM_OK;
+}
+
+int juxta_fram_read(struct juxta_fram_device *fram_dev, uint32_t address, uint8_t *data, size_t length)
+{
+    int ret = check_access(fram_dev, address, data, length);
+    if (ret != JUXTA_FRAM_OK)
+    {
+        return ret;
+    }
+
+    memcpy(data, &image[address], length);
+    stats.read_calls++;
+    stats.read_bytes += length;
+    return JUXTA_FRAM_OK;
+}
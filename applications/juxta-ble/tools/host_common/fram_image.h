@@ -0,0 +1,47 @@
+/*
+ * JUXTA Host Tools - Emulated FRAM
+ * Backs juxta_fram_read()/juxta_fram_write() with an in-memory image of
+ * the 128 KB part that can be loaded from and saved to a file, and counts
+ * the traffic the file system generates.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef HOST_COMMON_FRAM_IMAGE_H_
+#define HOST_COMMON_FRAM_IMAGE_H_
+
+#include <juxta_fram/fram.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+struct fram_image_stats
+{
+    uint64_t write_calls;
+    uint64_t write_bytes;
+    uint64_t read_calls;
+    uint64_t read_bytes;
+};
+
+/**
+ * @brief Initialize the device and image (erased to 0xFF)
+ *
+ * @param dev FRAM device handed to the file system
+ * @param path Image to load, or NULL to start blank; a missing file also starts blank
+ * @return 0 on success, -1 if the file exists but could not be read
+ */
+int fram_image_init(struct juxta_fram_device *dev, const char *path);
+
+/**
+ * @brief Write the image to a file
+ *
+ * @return 0 on success, -1 on I/O error
+ */
+int fram_image_save(const char *path);
+
+/**
+ * @brief Traffic since fram_image_init()
+ */
+void fram_image_get_stats(struct fram_image_stats *stats);
+
+#endif /* HOST_COMMON_FRAM_IMAGE_H_ */
@@ -0,0 +1,16 @@
+/*
+ * Host shim for <zephyr/device.h>
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef HOST_COMMON_SHIM_ZEPHYR_DEVICE_H_
+#define HOST_COMMON_SHIM_ZEPHYR_DEVICE_H_
+
+struct device
+{
+    const char *name;
+};
+
+#endif /* HOST_COMMON_SHIM_ZEPHYR_DEVICE_H_ */
@@ -0,0 +1,21 @@
+/*
+ * Host shim for <zephyr/drivers/gpio.h>
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef HOST_COMMON_SHIM_ZEPHYR_DRIVERS_GPIO_H_
+#define HOST_COMMON_SHIM_ZEPHYR_DRIVERS_GPIO_H_
+
+#include <zephyr/device.h>
+#include <stdint.h>
+
+struct gpio_dt_spec
+{
+    const struct device *port;
+    uint8_t pin;
+    uint16_t dt_flags;
+};
+
+#endif /* HOST_COMMON_SHIM_ZEPHYR_DRIVERS_GPIO_H_ */
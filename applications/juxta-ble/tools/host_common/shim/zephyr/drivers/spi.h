@@ -0,0 +1,20 @@
+/*
+ * Host shim for <zephyr/drivers/spi.h>
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef HOST_COMMON_SHIM_ZEPHYR_DRIVERS_SPI_H_
+#define HOST_COMMON_SHIM_ZEPHYR_DRIVERS_SPI_H_
+
+#include <stdint.h>
+
+struct spi_config
+{
+    uint32_t frequency;
+    uint16_t operation;
+    uint16_t slave;
+};
+
+#endif /* HOST_COMMON_SHIM_ZEPHYR_DRIVERS_SPI_H_ */
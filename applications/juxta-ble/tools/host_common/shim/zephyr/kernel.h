@@ -0,0 +1,36 @@
+/*
+ * Host shim for <zephyr/kernel.h>
+ * Only what the portable application modules and the FRAM file system
+ * use; nothing here schedules or blocks.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef HOST_COMMON_SHIM_ZEPHYR_KERNEL_H_
+#define HOST_COMMON_SHIM_ZEPHYR_KERNEL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <errno.h>
+
+#define __packed __attribute__((__packed__))
+#define __aligned(x) __attribute__((__aligned__(x)))
+
+#ifndef MIN
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+#define CLAMP(val, low, high) (((val) <= (low)) ? (low) : MIN(val, high))
+#define ARRAY_SIZE(array) (sizeof(array) / sizeof((array)[0]))
+#define ARG_UNUSED(x) (void)(x)
+
+/* Kconfig symbols are either 1 or undefined here; only valid in #if */
+#define IS_ENABLED(config) HOST_SHIM_IS_ENABLED_(config)
+#define HOST_SHIM_IS_ENABLED_(config) HOST_SHIM_IS_ENABLED_##config
+#define HOST_SHIM_IS_ENABLED_1 1
+
+#endif /* HOST_COMMON_SHIM_ZEPHYR_KERNEL_H_ */
@@ -0,0 +1,43 @@
+/*
+ * Host shim for <zephyr/logging/log.h>
+ * Warnings and errors up to the module's level go to stderr; info and
+ * debug are dropped so a whole-day run is not dominated by printing.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef HOST_COMMON_SHIM_ZEPHYR_LOGGING_LOG_H_
+#define HOST_COMMON_SHIM_ZEPHYR_LOGGING_LOG_H_
+
+#include <stdio.h>
+
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERR 1
+#define LOG_LEVEL_WRN 2
+#define LOG_LEVEL_INF 3
+#define LOG_LEVEL_DBG 4
+
+/* Module level is the optional second argument, warnings by default */
+#define HOST_SHIM_LOG_LEVEL_ARG(unused, level, ...) level
+#define LOG_MODULE_REGISTER(name, ...)                                             \
+    static const char *const host_shim_log_module __attribute__((unused)) = #name; \
+    static const int host_shim_log_level __attribute__((unused)) =                 \
+        HOST_SHIM_LOG_LEVEL_ARG(0, ##__VA_ARGS__, LOG_LEVEL_WRN)
+#define LOG_MODULE_DECLARE(name, ...) LOG_MODULE_REGISTER(name, ##__VA_ARGS__)
+
+#define HOST_SHIM_LOG(level, tag, fmt, ...)                                                  \
+    do                                                                                       \
+    {                                                                                        \
+        if (host_shim_log_level >= (level))                                                  \
+        {                                                                                    \
+            fprintf(stderr, "<%s> %s: " fmt "\n", tag, host_shim_log_module, ##__VA_ARGS__); \
+        }                                                                                    \
+    } while (0)
+
+#define LOG_ERR(fmt, ...) HOST_SHIM_LOG(LOG_LEVEL_ERR, "err", fmt, ##__VA_ARGS__)
+#define LOG_WRN(fmt, ...) HOST_SHIM_LOG(LOG_LEVEL_WRN, "wrn", fmt, ##__VA_ARGS__)
+#define LOG_INF(fmt, ...) ((void)host_shim_log_module)
+#define LOG_DBG(fmt, ...) ((void)host_shim_log_module)
+
+#endif /* HOST_COMMON_SHIM_ZEPHYR_LOGGING_LOG_H_ */
@@ -0,0 +1,42 @@
+/*
+ * JUXTA Host Tests - Check Helpers
+ * Minimal checks for the host unit tests of the portable firmware modules.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef HOST_TEST_H_
+#define HOST_TEST_H_
+
+#include <stdio.h>
+
+/* Fail the current test (return -1) with a message when @p cond is false */
+#define HT_CHECK(cond, ...)                                      \
+    do                                                           \
+    {                                                            \
+        if (!(cond))                                             \
+        {                                                        \
+            fprintf(stderr, "%s:%d: FAIL: ", __FILE__, __LINE__); \
+            fprintf(stderr, __VA_ARGS__);                        \
+            fputc('\n', stderr);                                 \
+            return -1;                                           \
+        }                                                        \
+    } while (0)
+
+/* Run one test function and count it towards @p failures */
+#define HT_RUN(test, failures)                \
+    do                                        \
+    {                                         \
+        if ((test)() != 0)                    \
+        {                                     \
+            (failures)++;                     \
+            printf("FAIL %s\n", #test);       \
+        }                                     \
+        else                                  \
+        {                                     \
+            printf("PASS %s\n", #test);       \
+        }                                     \
+    } while (0)
+
+#endif /* HOST_TEST_H_ */
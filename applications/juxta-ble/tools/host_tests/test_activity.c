@@ -0,0 +1,240 @@
+/*
+ * JUXTA Host Tests - Activity Metrics
+ * Runs src/activity.c over synthetic accelerometer minutes and compares
+ * ODBA, VeDBA, the |a| spread, posture and motion events with a floating
+ * point reference of the same definitions.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "host_test.h"
+#include "activity.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_RATE_HZ 25
+#define TEST_MINUTE_SAMPLES (60 * TEST_RATE_HZ)
+#define TEST_THRESHOLD_MG 100
+
+/* Fixed point truncates the static estimate to 1 mg per axis */
+#define TEST_TOL_ODBA_MG 4
+#define TEST_TOL_VEDBA_MG 3
+#define TEST_TOL_SD_MG 2
+
+typedef void (*sample_fn)(uint32_t n, int16_t out[3]);
+
+/* Same definitions as activity.c, in double precision */
+struct reference
+{
+    double static_mg[3];
+    bool primed;
+    uint32_t window_pos;
+    bool window_flagged;
+
+    uint32_t samples;
+    double odba_sum;
+    double vedba_sum;
+    double mag_sum;
+    double mag_sq_sum;
+    double axis_sum[3];
+    uint32_t motion_events;
+};
+
+static void reference_add(struct reference *ref, const int16_t a[3])
+{
+    const double alpha = 1.0 / (1 << JUXTA_ACTIVITY_STATIC_SHIFT);
+    double odba = 0.0;
+    double dyn_sq = 0.0;
+    double mag_sq = 0.0;
+    bool over = false;
+
+    if (!ref->primed)
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            ref->static_mg[i] = a[i];
+        }
+        ref->primed = true;
+    }
+    for (int i = 0; i < 3; i++)
+    {
+        ref->static_mg[i] += alpha * (a[i] - ref->static_mg[i]);
+        double dyn = a[i] - ref->static_mg[i];
+        odba += fabs(dyn);
+        dyn_sq += dyn * dyn;
+        mag_sq += (double)a[i] * a[i];
+        over = over || (fabs(dyn) > TEST_THRESHOLD_MG);
+        ref->axis_sum[i] += a[i];
+    }
+    ref->samples++;
+    ref->odba_sum += odba;
+    ref->vedba_sum += sqrt(dyn_sq);
+    ref->mag_sum += sqrt(mag_sq);
+    ref->mag_sq_sum += mag_sq;
+
+    if (over && !ref->window_flagged)
+    {
+        ref->window_flagged = true;
+        ref->motion_events++;
+    }
+    if (++ref->window_pos >= TEST_RATE_HZ)
+    {
+        ref->window_pos = 0;
+        ref->window_flagged = false;
+    }
+}
+
+static int check_minute(const char *name, const struct juxta_activity_minute *got, const struct reference *ref)
+{
+    double n = ref->samples;
+    double mean = ref->mag_sum / n;
+    double sd = sqrt(fmax(ref->mag_sq_sum / n - mean * mean, 0.0));
+
+    HT_CHECK(got->samples == ref->samples, "%s: %u samples, expected %u", name, got->samples, ref->samples);
+    HT_CHECK(fabs(got->odba_mg - ref->odba_sum / n) <= TEST_TOL_ODBA_MG, "%s: ODBA %u mg, reference %.1f",
+             name, got->odba_mg, ref->odba_sum / n);
+    HT_CHECK(fabs(got->vedba_mg - ref->vedba_sum / n) <= TEST_TOL_VEDBA_MG, "%s: VeDBA %u mg, reference %.1f",
+             name, got->vedba_mg, ref->vedba_sum / n);
+    HT_CHECK(fabs(got->sd_mg - sd) <= TEST_TOL_SD_MG, "%s: SD %u mg, reference %.1f", name, got->sd_mg, sd);
+    for (int i = 0; i < 3; i++)
+    {
+        double units = ref->axis_sum[i] / n / JUXTA_ACTIVITY_POSTURE_MG;
+        HT_CHECK(fabs(got->posture[i] - units) <= 1.0, "%s: posture[%d] %d, reference %.2f", name, i,
+                 got->posture[i], units);
+    }
+    HT_CHECK(got->motion_events == ref->motion_events, "%s: %u motion events, expected %u", name,
+             got->motion_events, ref->motion_events);
+    return 0;
+}
+
+/* Runs @p minutes minutes and checks each one against the reference */
+static int run_minutes(const char *name, sample_fn fn, int minutes, struct juxta_activity_minute *last)
+{
+    static struct juxta_activity act;
+    struct reference ref;
+    uint32_t n = 0;
+
+    juxta_activity_init(&act, TEST_RATE_HZ, TEST_THRESHOLD_MG);
+    memset(&ref, 0, sizeof(ref));
+
+    for (int m = 0; m < minutes; m++)
+    {
+        for (int s = 0; s < TEST_MINUTE_SAMPLES; s++, n++)
+        {
+            int16_t a[3];
+            fn(n, a);
+            juxta_activity_add(&act, a[0], a[1], a[2]);
+            reference_add(&ref, a);
+        }
+        juxta_activity_take(&act, last);
+        HT_CHECK(check_minute(name, last, &ref) == 0, "%s: minute %d", name, m);
+
+        /* The static estimate and window carry over; the sums restart */
+        ref.samples = 0;
+        ref.odba_sum = ref.vedba_sum = ref.mag_sum = ref.mag_sq_sum = 0.0;
+        memset(ref.axis_sum, 0, sizeof(ref.axis_sum));
+        ref.motion_events = 0;
+    }
+    return 0;
+}
+
+static void constant_1g(uint32_t n, int16_t out[3])
+{
+    (void)n;
+    out[0] = 0;
+    out[1] = 0;
+    out[2] = 1000;
+}
+
+static void all_zero(uint32_t n, int16_t out[3])
+{
+    (void)n;
+    memset(out, 0, 3 * sizeof(out[0]));
+}
+
+/* Collar tilted in x/z with a 1.5 Hz swing: 300 mg on z, 150 mg on x */
+static void sinusoid(uint32_t n, int16_t out[3])
+{
+    double phase = 2.0 * M_PI * 1.5 * n / TEST_RATE_HZ;
+    out[0] = (int16_t)lround(250.0 + 150.0 * sin(phase));
+    out[1] = -120;
+    out[2] = (int16_t)lround(960.0 + 300.0 * sin(phase + 0.3));
+}
+
+static int test_constant_1g(void)
+{
+    struct juxta_activity_minute out;
+
+    HT_CHECK(run_minutes("1 g", constant_1g, 2, &out) == 0, "run failed");
+    HT_CHECK(out.odba_mg == 0 && out.vedba_mg == 0 && out.sd_mg == 0, "still: ODBA %u VeDBA %u SD %u",
+             out.odba_mg, out.vedba_mg, out.sd_mg);
+    /* 1000 mg / 16 mg = 62.5, rounded away from zero */
+    HT_CHECK(out.posture[0] == 0 && out.posture[1] == 0 && out.posture[2] == 63, "posture %d %d %d",
+             out.posture[0], out.posture[1], out.posture[2]);
+    HT_CHECK(out.motion_events == 0, "%u motion events", out.motion_events);
+    return 0;
+}
+
+static int test_all_zero(void)
+{
+    struct juxta_activity_minute out;
+
+    HT_CHECK(run_minutes("zero", all_zero, 2, &out) == 0, "run failed");
+    HT_CHECK(out.samples == TEST_MINUTE_SAMPLES, "%u samples", out.samples);
+    HT_CHECK(out.odba_mg == 0 && out.vedba_mg == 0 && out.sd_mg == 0 && out.motion_events == 0,
+             "ODBA %u VeDBA %u SD %u events %u", out.odba_mg, out.vedba_mg, out.sd_mg, out.motion_events);
+    HT_CHECK(out.posture[0] == 0 && out.posture[1] == 0 && out.posture[2] == 0, "posture %d %d %d",
+             out.posture[0], out.posture[1], out.posture[2]);
+    return 0;
+}
+
+static int test_sinusoid(void)
+{
+    struct juxta_activity_minute out;
+
+    /* The first minute covers the static estimate settling from the first sample */
+    HT_CHECK(run_minutes("sinusoid", sinusoid, 3, &out) == 0, "run failed");
+    HT_CHECK(out.odba_mg > 200 && out.sd_mg > 100, "swing not seen: ODBA %u SD %u", out.odba_mg, out.sd_mg);
+    HT_CHECK(out.motion_events == 60, "%u motion events, expected one per second", out.motion_events);
+    return 0;
+}
+
+static int test_empty_minute(void)
+{
+    struct juxta_activity act;
+    struct juxta_activity_minute out;
+
+    juxta_activity_init(&act, TEST_RATE_HZ, TEST_THRESHOLD_MG);
+    juxta_activity_take(&act, &out);
+    HT_CHECK(out.samples == 0 && out.odba_mg == 0 && out.motion_events == 0, "empty minute reported data");
+    return 0;
+}
+
+static int test_isqrt(void)
+{
+    srand(3);
+    for (int i = 0; i < 100000; i++)
+    {
+        uint64_t v = ((uint64_t)rand() << 31 | (uint64_t)rand()) >> (rand() % 62);
+        uint64_t r = juxta_activity_isqrt(v);
+        HT_CHECK(r * r <= v && (r + 1) * (r + 1) > v, "isqrt(%llu) = %llu", (unsigned long long)v,
+                 (unsigned long long)r);
+    }
+    HT_CHECK(juxta_activity_isqrt(0) == 0 && juxta_activity_isqrt(1) == 1, "isqrt of 0 or 1");
+    return 0;
+}
+
+int main(void)
+{
+    int failures = 0;
+
+    HT_RUN(test_constant_1g, failures);
+    HT_RUN(test_all_zero, failures);
+    HT_RUN(test_sinusoid, failures);
+    HT_RUN(test_empty_minute, failures);
+    HT_RUN(test_isqrt, failures);
+
+    return failures ? 1 : 0;
+}
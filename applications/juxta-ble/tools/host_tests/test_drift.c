@@ -0,0 +1,197 @@
+/*
+ * JUXTA Host Tests - Clock Drift Filter
+ * Feeds lib/juxta_vitals_nrf52/src/drift.c the sync pairs a collar sees
+ * from gateways: a crystal with a known ppm error, gateway timestamps with
+ * 100 ms error, syncs once a day. Checks that the estimate converges on
+ * the true drift inside its reported sigma and that the corrected clock
+ * stays inside the reported time uncertainty.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "host_test.h"
+#include "juxta_vitals_nrf52/drift.h"
+#include <math.h>
+#include <stdlib.h>
+
+#define TEST_DAY_S 86400.0
+#define TEST_DAYS 20
+
+/* Kconfig defaults of CONFIG_JUXTA_VITALS_NRF52_* */
+static const struct juxta_vitals_drift_config cfg = {
+    .sync_error_ms = 100,
+    .min_interval_s = 3600,
+    .max_ppm = 500,
+    .prior_ppm = 50,
+    .wander_ppb = 2000,
+};
+
+static double gaussian(double sigma)
+{
+    double u1 = (rand() + 1.0) / ((double)RAND_MAX + 2.0);
+    double u2 = (rand() + 1.0) / ((double)RAND_MAX + 2.0);
+    return sigma * sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+/* Elapsed local time scaled by the Q32 correction, as timebase_correct() does */
+static double corrected(double local_s, int32_t rate_corr_q32)
+{
+    return local_s * (1.0 + rate_corr_q32 / 4294967296.0);
+}
+
+/*
+ * One collar through TEST_DAYS daily syncs. The local clock runs
+ * drift_ppm(day) fast; a sync on day k happens at true time k days plus
+ * the gateway error, and the gateway writes the whole day boundary.
+ */
+static int run_collar(double ppm_start, double ppm_per_day, double *late_error_ms)
+{
+    struct juxta_vitals_drift_filter f;
+    double true_s = 0.0;  /* True time at the current sync */
+    double local_s = 0.0; /* Local clock at the current sync */
+    double anchor_local_s = 0.0;
+    double error_sum = 0.0;
+    int error_n = 0;
+
+    juxta_vitals_drift_reset(&f, &cfg);
+
+    for (int day = 1; day <= TEST_DAYS; day++)
+    {
+        double ppm = ppm_start + ppm_per_day * day;
+        double sync_true_s = day * TEST_DAY_S + gaussian(cfg.sync_error_ms / 1000.0);
+        double step_s = sync_true_s - true_s;
+        double next_local_s = local_s + step_s * (1.0 + ppm * 1e-6);
+
+        /* Before the sync: the clock set at the last sync, corrected since.
+         * Its error is the last sync's gateway error plus the residual drift. */
+        double clock_s = (day - 1) * TEST_DAY_S + corrected(next_local_s - local_s, f.rate_corr_q32);
+        double error_ms = (clock_s - sync_true_s) * 1000.0;
+        float bound_ms = juxta_vitals_drift_uncertainty_ms(&f, &cfg, (float)step_s);
+        HT_CHECK(fabs(error_ms) <= 4.0 * bound_ms, "day %d: clock off by %.0f ms, uncertainty %.0f ms", day,
+                 error_ms, bound_ms);
+        if (day > 3)
+        {
+            error_sum += fabs(error_ms);
+            error_n++;
+        }
+
+        int32_t measured_ppb = 0;
+        uint64_t local_us = (uint64_t)llround((next_local_s - anchor_local_s) * 1e6);
+        enum juxta_vitals_drift_result res =
+            juxta_vitals_drift_update(&f, &cfg, local_us, (int32_t)TEST_DAY_S, &measured_ppb);
+        HT_CHECK(res == JUXTA_VITALS_DRIFT_UPDATED, "day %d: result %d", day, res);
+
+        double sigma = sqrt(f.var);
+        HT_CHECK(fabs(f.ppb - ppm * 1000.0) <= 4.0 * sigma + 1.0, "day %d: estimate %d ppb, true %.0f, sigma %.0f",
+                 day, f.ppb, ppm * 1000.0, sigma);
+
+        true_s = sync_true_s;
+        local_s = next_local_s;
+        anchor_local_s = next_local_s;
+    }
+
+    HT_CHECK(f.samples == TEST_DAYS, "%u samples", f.samples);
+    *late_error_ms = error_sum / error_n;
+    return 0;
+}
+
+static int test_converges(void)
+{
+    static const double ppm[] = {-45.0, -12.0, 0.0, 5.0, 23.0, 48.0};
+
+    srand(4);
+    for (size_t i = 0; i < sizeof(ppm) / sizeof(ppm[0]); i++)
+    {
+        double late_error_ms;
+        HT_CHECK(run_collar(ppm[i], 0.0, &late_error_ms) == 0, "%.0f ppm", ppm[i]);
+        /* Uncorrected, a day at this drift is ppm x 86.4 ms */
+        HT_CHECK(late_error_ms < 250.0, "%.0f ppm: %.0f ms mean error after day 3 (uncorrected %.0f ms)", ppm[i],
+                 late_error_ms, fabs(ppm[i]) * 86.4);
+    }
+    return 0;
+}
+
+static int test_sigma_shrinks(void)
+{
+    struct juxta_vitals_drift_filter f;
+    int32_t measured_ppb;
+    float last_var;
+
+    juxta_vitals_drift_reset(&f, &cfg);
+    last_var = f.var;
+    HT_CHECK(sqrtf(f.var) == 50000.0f && f.ppb == 0 && f.samples == 0, "reset: %d ppb, sigma %.0f", f.ppb,
+             sqrtf(f.var));
+    for (int day = 1; day <= 5; day++)
+    {
+        /* Exactly 10 ppm fast */
+        uint64_t local_us = (uint64_t)(TEST_DAY_S * 1e6 * (1.0 + 10e-6));
+        juxta_vitals_drift_update(&f, &cfg, local_us, (int32_t)TEST_DAY_S, &measured_ppb);
+        HT_CHECK(measured_ppb == 10000, "measured %d ppb", measured_ppb);
+        HT_CHECK(f.var < last_var, "day %d: variance did not shrink", day);
+        last_var = f.var;
+    }
+    HT_CHECK(abs(f.ppb - 10000) <= 1, "estimate %d ppb", f.ppb);
+    HT_CHECK(sqrtf(f.var) < 2000.0f, "sigma %.0f ppb after five days", sqrtf(f.var));
+    /* -10 ppm correction in Q32 */
+    HT_CHECK(fabs(f.rate_corr_q32 + 42949.2) < 2.0, "rate correction %d", f.rate_corr_q32);
+    return 0;
+}
+
+static int test_tracks_wander(void)
+{
+    double late_error_ms;
+
+    /* 1 ppm per day of temperature wander, within the 2000 ppb/day model */
+    srand(5);
+    HT_CHECK(run_collar(20.0, 1.0, &late_error_ms) == 0, "wandering crystal");
+    HT_CHECK(late_error_ms < 250.0, "%.0f ms mean error after day 3", late_error_ms);
+    return 0;
+}
+
+static int test_short_interval_ignored(void)
+{
+    struct juxta_vitals_drift_filter f;
+    int32_t measured_ppb = 0;
+
+    juxta_vitals_drift_reset(&f, &cfg);
+    enum juxta_vitals_drift_result res =
+        juxta_vitals_drift_update(&f, &cfg, (uint64_t)(cfg.min_interval_s - 1) * 1000000U,
+                                  (int32_t)cfg.min_interval_s, &measured_ppb);
+    HT_CHECK(res == JUXTA_VITALS_DRIFT_TOO_SHORT, "result %d", res);
+    HT_CHECK(f.samples == 0 && f.ppb == 0 && f.rate_corr_q32 == 0, "filter changed by a short interval");
+    return 0;
+}
+
+static int test_gateway_step_restarts(void)
+{
+    struct juxta_vitals_drift_filter f;
+    int32_t measured_ppb = 0;
+    uint64_t day_us = (uint64_t)(TEST_DAY_S * 1e6 * (1.0 + 20e-6));
+
+    juxta_vitals_drift_reset(&f, &cfg);
+    juxta_vitals_drift_update(&f, &cfg, day_us, (int32_t)TEST_DAY_S, &measured_ppb);
+    HT_CHECK(f.samples == 1 && f.ppb != 0, "first measurement not taken");
+
+    /* Gateway clock an hour ahead: 41667 ppm apparent */
+    enum juxta_vitals_drift_result res =
+        juxta_vitals_drift_update(&f, &cfg, day_us, (int32_t)TEST_DAY_S + 3600, &measured_ppb);
+    HT_CHECK(res == JUXTA_VITALS_DRIFT_STEP, "result %d", res);
+    HT_CHECK(measured_ppb < -40000000, "measured %d ppb", measured_ppb);
+    HT_CHECK(f.samples == 0 && f.ppb == 0 && f.rate_corr_q32 == 0 && sqrtf(f.var) == 50000.0f,
+             "filter not restarted");
+    return 0;
+}
+
+int main(void)
+{
+    int failures = 0;
+
+    HT_RUN(test_converges, failures);
+    HT_RUN(test_sigma_shrinks, failures);
+    HT_RUN(test_tracks_wander, failures);
+    HT_RUN(test_short_interval_ignored, failures);
+    HT_RUN(test_gateway_step_restarts, failures);
+
+    return failures ? 1 : 0;
+}
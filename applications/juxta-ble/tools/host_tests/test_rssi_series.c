@@ -0,0 +1,271 @@
+/*
+ * JUXTA Host Tests - RSSI Series
+ * Round-trips src/rssi_series.c: scan bursts are observed, encoded,
+ * serialized and decoded again, and the result is compared with an
+ * independent model of the 2 dB delta coding.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "host_test.h"
+#include "rssi_series.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_MINUTES 2000
+#define TEST_MAX_BURSTS 12 /* More than the bitmap holds, to cover merging */
+
+static struct juxta_rssi_series series;
+
+/* Expected decoder output for one peer, built from the strongest RSSI per burst */
+struct expected_peer
+{
+    uint32_t mac_id;
+    bool heard[JUXTA_RSSI_SERIES_MAX_BURSTS];
+    int burst_rssi[JUXTA_RSSI_SERIES_MAX_BURSTS];
+};
+
+static int8_t clamp_i8(int v)
+{
+    return (int8_t)((v < -128) ? -128 : (v > 127) ? 127 : v);
+}
+
+/* Quantize a burst sequence the way the record stores it; @p saturated marks
+ * samples whose change exceeded the step range */
+static void model_decode(const struct expected_peer *exp, uint8_t burst_count,
+                         int8_t out[JUXTA_RSSI_SERIES_MAX_BURSTS], uint8_t *bitmap,
+                         bool saturated[JUXTA_RSSI_SERIES_MAX_BURSTS])
+{
+    int value = 0;
+    bool first = true;
+
+    *bitmap = 0;
+    for (uint8_t b = 0; b < burst_count; b++)
+    {
+        if (!exp->heard[b])
+        {
+            continue;
+        }
+        if (first)
+        {
+            saturated[b] = false;
+            value = exp->burst_rssi[b];
+            first = false;
+        }
+        else
+        {
+            /* Nearest 2 dB step, half steps away from zero, limited to -8..+7 steps */
+            int diff = exp->burst_rssi[b] - value;
+            int step = (diff >= 0) ? (diff + 1) / 2 : -((-diff + 1) / 2);
+            saturated[b] = (step < -8 || step > 7);
+            step = (step < -8) ? -8 : (step > 7) ? 7 : step;
+            value = clamp_i8(value + step * JUXTA_RSSI_SERIES_STEP_DB);
+        }
+        out[b] = (int8_t)value;
+        *bitmap |= (uint8_t)(1U << b);
+    }
+}
+
+static int run_minute(uint8_t bursts, uint8_t peers, int jump_db)
+{
+    static struct expected_peer exp[JUXTA_RSSI_SERIES_MAX_PEERS];
+    static uint8_t mac_ids[JUXTA_RSSI_SERIES_MAX_PEERS][3];
+    static uint8_t payload[JUXTA_RSSI_SERIES_MAX_PEERS * JUXTA_RSSI_SERIES_PEER_MAX_BYTES];
+
+    memset(exp, 0, sizeof(exp));
+    juxta_rssi_series_reset(&series);
+
+    int level[JUXTA_RSSI_SERIES_MAX_PEERS];
+    for (uint8_t p = 0; p < peers; p++)
+    {
+        exp[p].mac_id = 0x100000u + (uint32_t)p * 0x10203u;
+        level[p] = -95 + rand() % 60;
+    }
+
+    for (uint8_t b = 0; b < bursts; b++)
+    {
+        /* Bursts past the bitmap merge into its last position */
+        uint8_t slot = (b < JUXTA_RSSI_SERIES_MAX_BURSTS) ? b : JUXTA_RSSI_SERIES_MAX_BURSTS - 1;
+
+        for (uint8_t p = 0; p < peers; p++)
+        {
+            if (rand() % 3 == 0)
+            {
+                continue; /* Missed in this burst */
+            }
+            level[p] += rand() % (2 * jump_db + 1) - jump_db;
+            int adverts = 1 + rand() % 4;
+            for (int a = 0; a < adverts; a++)
+            {
+                int8_t rssi = clamp_i8(level[p] + rand() % 7 - 3);
+                HT_CHECK(juxta_rssi_series_observe(&series, exp[p].mac_id, rssi), "peer table full");
+                if (!exp[p].heard[slot] || rssi > exp[p].burst_rssi[slot])
+                {
+                    exp[p].burst_rssi[slot] = rssi;
+                }
+                exp[p].heard[slot] = true;
+            }
+        }
+        juxta_rssi_series_end_burst(&series);
+    }
+    juxta_rssi_series_finish(&series);
+
+    uint8_t expected_bursts = (bursts < JUXTA_RSSI_SERIES_MAX_BURSTS) ? bursts : JUXTA_RSSI_SERIES_MAX_BURSTS;
+    HT_CHECK(series.burst_count == expected_bursts, "burst_count %u, expected %u",
+             series.burst_count, expected_bursts);
+
+    int len = juxta_rssi_series_serialize(&series, mac_ids, payload, sizeof(payload));
+    HT_CHECK(len >= 0, "serialize failed");
+
+    /* Peers appear in first-heard order; map them back by MAC ID */
+    size_t offset = 0;
+    for (uint8_t i = 0; i < series.peer_count; i++)
+    {
+        uint32_t mac = ((uint32_t)mac_ids[i][0] << 16) | ((uint32_t)mac_ids[i][1] << 8) | mac_ids[i][2];
+        const struct expected_peer *e = NULL;
+        for (uint8_t p = 0; p < peers; p++)
+        {
+            if (exp[p].mac_id == mac)
+            {
+                e = &exp[p];
+            }
+        }
+        HT_CHECK(e != NULL, "unknown MAC %06X", (unsigned)mac);
+
+        int8_t got[JUXTA_RSSI_SERIES_MAX_BURSTS];
+        int8_t want[JUXTA_RSSI_SERIES_MAX_BURSTS];
+        uint8_t got_bitmap;
+        uint8_t want_bitmap;
+        bool saturated[JUXTA_RSSI_SERIES_MAX_BURSTS];
+        int used = juxta_rssi_series_decode_peer(&payload[offset], (size_t)len - offset, series.burst_count,
+                                                 got, &got_bitmap);
+        HT_CHECK(used > 0, "decode of %06X failed", (unsigned)mac);
+        HT_CHECK((size_t)used == juxta_rssi_series_peer_size(&series.peers[i]), "decoded size mismatch");
+
+        model_decode(e, series.burst_count, want, &want_bitmap, saturated);
+        HT_CHECK(got_bitmap == want_bitmap, "%06X bitmap %02X, expected %02X", (unsigned)mac,
+                 got_bitmap, want_bitmap);
+        for (uint8_t b = 0; b < series.burst_count; b++)
+        {
+            if (!(want_bitmap & (1U << b)))
+            {
+                continue;
+            }
+            HT_CHECK(got[b] == want[b], "%06X burst %u: %d dBm, expected %d", (unsigned)mac, b, got[b], want[b]);
+            /* Within the step range the decoded value stays within 1 dB */
+            if (!saturated[b])
+            {
+                HT_CHECK(abs(got[b] - e->burst_rssi[b]) <= JUXTA_RSSI_SERIES_STEP_DB / 2,
+                         "%06X burst %u: %d dBm decoded from %d", (unsigned)mac, b, got[b], e->burst_rssi[b]);
+            }
+        }
+        offset += (size_t)used;
+    }
+    HT_CHECK(offset == (size_t)len, "payload %d bytes, decoded %zu", len, offset);
+    return 0;
+}
+
+static int test_round_trip(void)
+{
+    srand(1);
+    for (int m = 0; m < TEST_MINUTES; m++)
+    {
+        uint8_t bursts = (uint8_t)(1 + rand() % TEST_MAX_BURSTS);
+        uint8_t peers = (uint8_t)(1 + rand() % 20);
+        HT_CHECK(run_minute(bursts, peers, 4) == 0, "minute %d (%u bursts, %u peers)", m, bursts, peers);
+    }
+    return 0;
+}
+
+static int test_large_steps_saturate(void)
+{
+    /* Jumps beyond -16..+14 dB per burst clamp to the step limits */
+    srand(2);
+    for (int m = 0; m < TEST_MINUTES; m++)
+    {
+        HT_CHECK(run_minute(JUXTA_RSSI_SERIES_MAX_BURSTS, 8, 40) == 0, "minute %d", m);
+    }
+    return 0;
+}
+
+static int test_full_peer_table(void)
+{
+    juxta_rssi_series_reset(&series);
+    for (uint32_t p = 0; p < JUXTA_RSSI_SERIES_MAX_PEERS; p++)
+    {
+        HT_CHECK(juxta_rssi_series_observe(&series, p + 1, -60), "peer %u rejected", (unsigned)p);
+    }
+    HT_CHECK(!juxta_rssi_series_observe(&series, 0xABCDEF, -60), "peer beyond the table accepted");
+    HT_CHECK(juxta_rssi_series_observe(&series, 1, -50), "known peer rejected with a full table");
+    return 0;
+}
+
+static int test_reset_starts_empty_minute(void)
+{
+    juxta_rssi_series_reset(&series);
+    HT_CHECK(juxta_rssi_series_observe(&series, 0x123456, -70), "observe failed");
+    juxta_rssi_series_end_burst(&series);
+    juxta_rssi_series_reset(&series);
+    juxta_rssi_series_finish(&series);
+    HT_CHECK(series.burst_count == 0 && series.peer_count == 0, "reset left %u bursts, %u peers",
+             series.burst_count, series.peer_count);
+    return 0;
+}
+
+static int test_serialize_too_small(void)
+{
+    uint8_t mac_ids[2][3];
+    uint8_t payload[3];
+
+    juxta_rssi_series_reset(&series);
+    for (int b = 0; b < 4; b++)
+    {
+        HT_CHECK(juxta_rssi_series_observe(&series, 0x010203, -60), "observe failed");
+        HT_CHECK(juxta_rssi_series_observe(&series, 0x040506, -70), "observe failed");
+        juxta_rssi_series_end_burst(&series);
+    }
+    HT_CHECK(juxta_rssi_series_serialize(&series, mac_ids, payload, sizeof(payload)) == -1,
+             "serialize into %zu bytes succeeded", sizeof(payload));
+    return 0;
+}
+
+static int test_decode_rejects_malformed(void)
+{
+    int8_t rssi[JUXTA_RSSI_SERIES_MAX_BURSTS];
+    uint8_t bitmap;
+    const uint8_t empty_bitmap[] = {(uint8_t)-60, 0x00};
+    const uint8_t beyond_count[] = {(uint8_t)-60, 0x08};
+    const uint8_t truncated[] = {(uint8_t)-60, 0x07}; /* 3 samples need one step byte */
+    const uint8_t valid[] = {(uint8_t)-60, 0x07, 0x1F};
+
+    HT_CHECK(juxta_rssi_series_decode_peer(valid, 1, 3, rssi, &bitmap) == -1, "1-byte input accepted");
+    HT_CHECK(juxta_rssi_series_decode_peer(valid, sizeof(valid), 0, rssi, &bitmap) == -1, "0 bursts accepted");
+    HT_CHECK(juxta_rssi_series_decode_peer(valid, sizeof(valid), 9, rssi, &bitmap) == -1, "9 bursts accepted");
+    HT_CHECK(juxta_rssi_series_decode_peer(empty_bitmap, sizeof(empty_bitmap), 3, rssi, &bitmap) == -1,
+             "empty bitmap accepted");
+    HT_CHECK(juxta_rssi_series_decode_peer(beyond_count, sizeof(beyond_count), 3, rssi, &bitmap) == -1,
+             "bit beyond burst count accepted");
+    HT_CHECK(juxta_rssi_series_decode_peer(truncated, sizeof(truncated), 3, rssi, &bitmap) == -1,
+             "truncated steps accepted");
+
+    /* Steps +1 (0x1) then -1 (0xF): -60, -58, -60 */
+    HT_CHECK(juxta_rssi_series_decode_peer(valid, sizeof(valid), 3, rssi, &bitmap) == 3, "valid input rejected");
+    HT_CHECK(bitmap == 0x07 && rssi[0] == -60 && rssi[1] == -58 && rssi[2] == -60,
+             "decoded %d %d %d (bitmap %02X)", rssi[0], rssi[1], rssi[2], bitmap);
+    return 0;
+}
+
+int main(void)
+{
+    int failures = 0;
+
+    HT_RUN(test_round_trip, failures);
+    HT_RUN(test_large_steps_saturate, failures);
+    HT_RUN(test_full_peer_table, failures);
+    HT_RUN(test_reset_starts_empty_minute, failures);
+    HT_RUN(test_serialize_too_small, failures);
+    HT_RUN(test_decode_rejects_malformed, failures);
+
+    return failures ? 1 : 0;
+}
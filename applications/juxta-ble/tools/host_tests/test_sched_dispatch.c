@@ -0,0 +1,322 @@
+/*
+ * JUXTA Host Tests - Scheduler Dispatch
+ * Drives src/sched_dispatch.c, the pass sched_work_handler() runs, through
+ * a fake port: a virtual clock, a one-shot timer that stops when it fires,
+ * and a lock that catches handlers running under it. Checks the routing
+ * order and that the timer is re-armed after passes whose handlers
+ * schedule nothing.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "host_test.h"
+#include "sched_dispatch.h"
+#include <string.h>
+
+#define TEST_MAX_CALLS 32
+
+/* Fake port state */
+static uint32_t now_ms;
+static bool timer_armed;
+static uint32_t timer_expiry_ms;
+static int lock_depth;
+static bool lock_nested;
+
+/* Handler behaviour and trace */
+static bool state_ready;
+static uint32_t dropped_events;
+static int calls[TEST_MAX_CALLS];
+static int call_count;
+static int state_begins;
+static int state_ends;
+static bool handler_under_lock;
+
+static struct juxta_sched_dispatch disp;
+
+#define CALL_STATE_BEGIN (JUXTA_SCHED_EVENT_COUNT)
+#define CALL_STATE_END (JUXTA_SCHED_EVENT_COUNT + 1)
+
+static uint32_t port_now_ms(void)
+{
+    return now_ms;
+}
+
+static uint32_t port_lock(void)
+{
+    lock_nested |= (lock_depth > 0);
+    lock_depth++;
+    return 0x5A;
+}
+
+static void port_unlock(uint32_t key)
+{
+    (void)key;
+    lock_depth--;
+}
+
+static void port_timer_start(uint32_t delay_ms)
+{
+    timer_armed = true;
+    timer_expiry_ms = now_ms + delay_ms;
+}
+
+static void port_timer_stop(void)
+{
+    timer_armed = false;
+}
+
+static const struct juxta_sched_port port = {
+    .now_ms = port_now_ms,
+    .lock = port_lock,
+    .unlock = port_unlock,
+    .timer_start = port_timer_start,
+    .timer_stop = port_timer_stop,
+};
+
+static void trace(int what)
+{
+    handler_under_lock |= (lock_depth > 0);
+    if (call_count < TEST_MAX_CALLS)
+    {
+        calls[call_count++] = what;
+    }
+}
+
+/* Every handler only records the call and schedules nothing, like
+ * led_blink_handler() once blinking stopped or a burst start declined
+ * while a gateway is connected */
+#define DECLINING_HANDLER(evt)                      \
+    static void on_##evt(uint32_t when_ms)          \
+    {                                               \
+        (void)when_ms;                              \
+        trace(JUXTA_SCHED_##evt);                   \
+    }
+DECLINING_HANDLER(HEALTH_CHECK)
+DECLINING_HANDLER(LED_BLINK)
+DECLINING_HANDLER(MINUTE_LOG)
+DECLINING_HANDLER(BURST_END)
+DECLINING_HANDLER(SCAN_BURST)
+DECLINING_HANDLER(ADV_BURST)
+DECLINING_HANDLER(BATTERY_SAMPLE)
+
+/* The ADC trigger is periodic: it re-arms itself before its work, as main.c does */
+#define ADC_TRIGGER_INTERVAL_MS 5000
+
+static void on_ADC_TRIGGER(uint32_t when_ms)
+{
+    juxta_sched_dispatch_at(&disp, JUXTA_SCHED_ADC_TRIGGER, when_ms + ADC_TRIGGER_INTERVAL_MS);
+    trace(JUXTA_SCHED_ADC_TRIGGER);
+}
+
+static bool on_state_ready(void)
+{
+    return state_ready;
+}
+
+static void on_state_begin(uint32_t when_ms, uint32_t due)
+{
+    (void)when_ms;
+    (void)due;
+    state_begins++;
+    trace(CALL_STATE_BEGIN);
+}
+
+static void on_state_end(void)
+{
+    state_ends++;
+    trace(CALL_STATE_END);
+}
+
+static void on_state_dropped(uint32_t events)
+{
+    dropped_events |= events;
+}
+
+static const struct juxta_sched_handlers handlers = {
+    .event = {
+        [JUXTA_SCHED_HEALTH_CHECK] = on_HEALTH_CHECK,
+        [JUXTA_SCHED_LED_BLINK] = on_LED_BLINK,
+        [JUXTA_SCHED_MINUTE_LOG] = on_MINUTE_LOG,
+        [JUXTA_SCHED_ADC_TRIGGER] = on_ADC_TRIGGER,
+        [JUXTA_SCHED_BURST_END] = on_BURST_END,
+        [JUXTA_SCHED_SCAN_BURST] = on_SCAN_BURST,
+        [JUXTA_SCHED_ADV_BURST] = on_ADV_BURST,
+        [JUXTA_SCHED_BATTERY_SAMPLE] = on_BATTERY_SAMPLE,
+    },
+    .state_ready = on_state_ready,
+    .state_begin = on_state_begin,
+    .state_end = on_state_end,
+    .state_dropped = on_state_dropped,
+};
+
+static void setup(void)
+{
+    now_ms = 0;
+    timer_armed = true; /* init must stop it */
+    lock_depth = 0;
+    lock_nested = false;
+    state_ready = true;
+    dropped_events = 0;
+    call_count = 0;
+    state_begins = 0;
+    state_ends = 0;
+    handler_under_lock = false;
+    juxta_sched_dispatch_init(&disp, NULL, &port, &handlers);
+}
+
+/* The kernel side: advance to the expiry, the one-shot timer stops, the
+ * work item runs one pass */
+static uint32_t fire(void)
+{
+    now_ms = timer_expiry_ms;
+    timer_armed = false;
+    call_count = 0;
+    return juxta_sched_dispatch_run(&disp);
+}
+
+static bool port_clean(void)
+{
+    return lock_depth == 0 && !lock_nested && !handler_under_lock;
+}
+
+static int test_init_stops_timer(void)
+{
+    setup();
+    HT_CHECK(!timer_armed, "timer left running by init");
+
+    juxta_sched_dispatch_at(&disp, JUXTA_SCHED_HEALTH_CHECK, 30000);
+    HT_CHECK(timer_armed && timer_expiry_ms == 30000, "armed=%d expiry=%u", timer_armed, timer_expiry_ms);
+
+    juxta_sched_dispatch_cancel(&disp, JUXTA_SCHED_EVENT_BIT(JUXTA_SCHED_HEALTH_CHECK));
+    HT_CHECK(!timer_armed, "timer still armed with nothing pending");
+    HT_CHECK(port_clean(), "lock misuse");
+    return 0;
+}
+
+static int test_declining_handler_rearms(void)
+{
+    setup();
+    juxta_sched_dispatch_at(&disp, JUXTA_SCHED_HEALTH_CHECK, 30000);
+    juxta_sched_dispatch_at(&disp, JUXTA_SCHED_LED_BLINK, 500);
+    HT_CHECK(timer_expiry_ms == 500, "first wakeup %u", timer_expiry_ms);
+
+    uint32_t due = fire();
+    HT_CHECK(due == JUXTA_SCHED_EVENT_BIT(JUXTA_SCHED_LED_BLINK), "due 0x%02x", due);
+    HT_CHECK(call_count == 1 && calls[0] == JUXTA_SCHED_LED_BLINK, "LED handler not run");
+
+    /* The LED scheduled nothing; the health check must still wake the system */
+    HT_CHECK(timer_armed, "timer not re-armed after a declining handler");
+    HT_CHECK(timer_expiry_ms == 30000, "re-armed for %u", timer_expiry_ms);
+
+    due = fire();
+    HT_CHECK(due == JUXTA_SCHED_EVENT_BIT(JUXTA_SCHED_HEALTH_CHECK), "due 0x%02x", due);
+    HT_CHECK(!timer_armed, "timer armed with nothing pending");
+    HT_CHECK(port_clean(), "lock misuse");
+    return 0;
+}
+
+static int test_dropped_state_events_rearm(void)
+{
+    setup();
+    state_ready = false;
+    juxta_sched_dispatch_at(&disp, JUXTA_SCHED_MINUTE_LOG, 1000);
+    juxta_sched_dispatch_at(&disp, JUXTA_SCHED_SCAN_BURST, 1000);
+    juxta_sched_dispatch_at(&disp, JUXTA_SCHED_BATTERY_SAMPLE, 60000);
+
+    fire();
+    HT_CHECK(call_count == 0, "%d handlers ran while the state system was not ready", call_count);
+    HT_CHECK(dropped_events == (JUXTA_SCHED_EVENT_BIT(JUXTA_SCHED_MINUTE_LOG) |
+                                JUXTA_SCHED_EVENT_BIT(JUXTA_SCHED_SCAN_BURST)),
+             "dropped 0x%02x", dropped_events);
+    HT_CHECK(state_begins == 0 && state_ends == 0, "state hooks ran");
+    HT_CHECK(timer_armed && timer_expiry_ms == 60000, "armed=%d expiry=%u", timer_armed, timer_expiry_ms);
+    HT_CHECK(port_clean(), "lock misuse");
+    return 0;
+}
+
+static int test_declined_burst_rearms(void)
+{
+    setup();
+    juxta_sched_dispatch_at(&disp, JUXTA_SCHED_SCAN_BURST, 2000);
+    juxta_sched_dispatch_at(&disp, JUXTA_SCHED_ADV_BURST, 7000);
+    juxta_sched_dispatch_at(&disp, JUXTA_SCHED_MINUTE_LOG, 60000);
+
+    /* Connected: the scan start returns without planning a burst end */
+    fire();
+    HT_CHECK(call_count == 3 && calls[1] == JUXTA_SCHED_SCAN_BURST, "scan start not run");
+    HT_CHECK(timer_armed && timer_expiry_ms == 7000, "armed=%d expiry=%u", timer_armed, timer_expiry_ms);
+
+    fire();
+    HT_CHECK(call_count == 3 && calls[1] == JUXTA_SCHED_ADV_BURST, "adv start not run");
+    HT_CHECK(timer_armed && timer_expiry_ms == 60000, "armed=%d expiry=%u", timer_armed, timer_expiry_ms);
+    HT_CHECK(port_clean(), "lock misuse");
+    return 0;
+}
+
+static int test_order_and_burst_end_precedence(void)
+{
+    setup();
+    for (int e = 0; e < JUXTA_SCHED_EVENT_COUNT; e++)
+    {
+        juxta_sched_dispatch_at(&disp, (enum juxta_sched_event)e, 100);
+    }
+
+    uint32_t due = fire();
+    HT_CHECK(due == (1U << JUXTA_SCHED_EVENT_COUNT) - 1, "due 0x%02x", due);
+
+    /* Burst end re-plans the starts, so due starts are not run beside it */
+    static const int expected[] = {
+        JUXTA_SCHED_HEALTH_CHECK, JUXTA_SCHED_LED_BLINK, JUXTA_SCHED_BATTERY_SAMPLE, CALL_STATE_BEGIN,
+        JUXTA_SCHED_MINUTE_LOG,   JUXTA_SCHED_BURST_END, CALL_STATE_END,             JUXTA_SCHED_ADC_TRIGGER,
+    };
+    HT_CHECK(call_count == (int)(sizeof(expected) / sizeof(expected[0])), "%d calls", call_count);
+    for (int i = 0; i < call_count; i++)
+    {
+        HT_CHECK(calls[i] == expected[i], "call %d was %d, expected %d", i, calls[i], expected[i]);
+    }
+    HT_CHECK(state_begins == 1 && state_ends == 1, "state hooks %d/%d", state_begins, state_ends);
+
+    /* Only the ADC trigger re-armed itself, from inside the pass */
+    HT_CHECK(timer_armed && timer_expiry_ms == 100 + ADC_TRIGGER_INTERVAL_MS, "armed=%d expiry=%u", timer_armed,
+             timer_expiry_ms);
+    HT_CHECK(port_clean(), "lock misuse");
+    return 0;
+}
+
+static int test_late_pass_collects_all_due(void)
+{
+    setup();
+    juxta_sched_dispatch_at(&disp, JUXTA_SCHED_ADC_TRIGGER, 1000);
+    juxta_sched_dispatch_at(&disp, JUXTA_SCHED_BATTERY_SAMPLE, 1500);
+    juxta_sched_dispatch_at(&disp, JUXTA_SCHED_HEALTH_CHECK, 9000);
+
+    /* The work queue was blocked past both deadlines */
+    timer_expiry_ms = 2000;
+    uint32_t due = fire();
+    HT_CHECK(due == (JUXTA_SCHED_EVENT_BIT(JUXTA_SCHED_ADC_TRIGGER) |
+                     JUXTA_SCHED_EVENT_BIT(JUXTA_SCHED_BATTERY_SAMPLE)),
+             "due 0x%02x", due);
+    HT_CHECK(timer_armed && timer_expiry_ms == 2000 + ADC_TRIGGER_INTERVAL_MS, "armed=%d expiry=%u",
+             timer_armed, timer_expiry_ms);
+
+    /* A deadline already in the past arms a zero delay, not a wrapped one */
+    juxta_sched_dispatch_at(&disp, JUXTA_SCHED_LED_BLINK, now_ms - 10);
+    HT_CHECK(timer_armed && timer_expiry_ms == now_ms, "overdue event armed for %u at %u", timer_expiry_ms, now_ms);
+    HT_CHECK(port_clean(), "lock misuse");
+    return 0;
+}
+
+int main(void)
+{
+    int failures = 0;
+
+    HT_RUN(test_init_stops_timer, failures);
+    HT_RUN(test_declining_handler_rearms, failures);
+    HT_RUN(test_dropped_state_events_rearm, failures);
+    HT_RUN(test_declined_burst_rearms, failures);
+    HT_RUN(test_order_and_burst_end_precedence, failures);
+    HT_RUN(test_late_pass_collects_all_due, failures);
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,34 @@
+#!/bin/sh
+#
+# Capture dictionary-encoded logs from RTT and decode them on the host
+#
+# Copyright (c) 2025 NeurotechHub
+# SPDX-License-Identifier: Apache-2.0
+#
+# Usage: rtt_log_decode.sh <build dir> [capture.bin]
+#   Captures until Ctrl-C, then decodes. With an existing capture file
+#   only the decode step runs.
+#
+# Environment:
+#   ZEPHYR_BASE   Zephyr tree matching the build (for log_parser.py)
+#   JLINK_DEVICE  J-Link device name (default NRF52840_XXAA)
+
+set -e
+
+BUILD_DIR=${1:?usage: $0 <build dir> [capture.bin]}
+CAPTURE=${2:-rtt_log.bin}
+DICT="$BUILD_DIR/zephyr/log_dictionary.json"
+PARSER="${ZEPHYR_BASE:?ZEPHYR_BASE not set}/scripts/logging/dictionary/log_parser.py"
+
+if [ ! -f "$DICT" ]; then
+    echo "No $DICT: build with -DEXTRA_CONF_FILE=overlay-log-dict.conf" >&2
+    exit 1
+fi
+
+if [ ! -f "$CAPTURE" ]; then
+    echo "Capturing RTT channel 0 to $CAPTURE (Ctrl-C to stop)"
+    JLinkRTTLogger -Device "${JLINK_DEVICE:-NRF52840_XXAA}" -If SWD -Speed 4000 \
+        -RTTChannel 0 "$CAPTURE" || true
+fi
+
+python3 "$PARSER" "$DICT" "$CAPTURE"
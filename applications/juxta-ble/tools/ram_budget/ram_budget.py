@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+#
+# Static RAM use per module from a GNU ld map file
+#
+# Copyright (c) 2025 NeurotechHub
+# SPDX-License-Identifier: Apache-2.0
+#
+# Usage: ram_budget.py <zephyr.map> [--top N] [--ram NAME]
+#   Sums every input section placed in the RAM region by the object it
+#   came from. Application and JUXTA library sources are listed per file,
+#   Zephyr and module code per library. --top also lists the largest
+#   sections (with -fdata-sections the section name is the symbol).
+
+import argparse
+import re
+import sys
+from collections import defaultdict
+
+MEMORY_RE = re.compile(r"^(\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)")
+# " .bss.name  0xADDR  0xSIZE object" or the same split over two lines
+SECTION_RE = re.compile(r"^ (\.\S+|COMMON)\s*$|^ (\.\S+|COMMON)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$")
+CONT_RE = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$")
+OBJECT_RE = re.compile(r"(?:.*/)?(lib[\w.+-]+\.a)\((.+?)\.obj\)$|(?:.*/)?([\w.+-]+?)\.obj$")
+
+
+def parse_memory(lines):
+    regions = {}
+    in_table = False
+    for line in lines:
+        if line.startswith("Memory Configuration"):
+            in_table = True
+            continue
+        if in_table and line.startswith("Linker script and memory map"):
+            break
+        m = MEMORY_RE.match(line) if in_table else None
+        if m and m.group(1) != "Name":
+            regions[m.group(1)] = (int(m.group(2), 16), int(m.group(3), 16))
+    return regions
+
+
+def section_kind(name):
+    for kind in ("noinit", "bss", "data"):
+        if kind in name:
+            return kind
+    return "bss" if name == "COMMON" else "data"
+
+
+def module_of(obj):
+    m = OBJECT_RE.match(obj.strip())
+    if not m:
+        return "(linker)"
+    if m.group(1):
+        lib, src = m.group(1), m.group(2)
+        if lib == "libapp.a":
+            return src  # Application and directly compiled JUXTA libraries
+        return lib[3:-2]
+    return m.group(3)
+
+
+def parse_sections(lines):
+    in_map = False
+    pending = None
+    for line in lines:
+        if line.startswith("Linker script and memory map"):
+            in_map = True
+            continue
+        if not in_map:
+            continue
+
+        if pending:
+            m = CONT_RE.match(line)
+            name, pending = pending, None
+            if m:
+                yield name, int(m.group(1), 16), int(m.group(2), 16), m.group(3)
+                continue
+
+        m = SECTION_RE.match(line)
+        if not m:
+            continue
+        if m.group(1):
+            pending = m.group(1)
+        else:
+            yield m.group(2), int(m.group(3), 16), int(m.group(4), 16), m.group(5)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Static RAM use per module from a GNU ld map file")
+    ap.add_argument("map", help="zephyr.map from the build")
+    ap.add_argument("--top", type=int, default=0, help="also list the N largest sections")
+    ap.add_argument("--ram", default="RAM", help="memory region name (default RAM)")
+    args = ap.parse_args()
+
+    with open(args.map, encoding="utf-8", errors="replace") as f:
+        lines = f.read().splitlines()
+
+    regions = parse_memory(lines)
+    if args.ram not in regions:
+        sys.exit(f"No '{args.ram}' region in {args.map} (found: {', '.join(regions)})")
+    ram_start, ram_len = regions[args.ram]
+    ram_end = ram_start + ram_len
+
+    modules = defaultdict(lambda: defaultdict(int))
+    sections = []
+    for name, addr, size, obj in parse_sections(lines):
+        if size == 0 or not (ram_start <= addr < ram_end):
+            continue
+        module = module_of(obj)
+        modules[module][section_kind(name)] += size
+        sections.append((size, name, module))
+
+    total = defaultdict(int)
+    print(f"{'module':<32} {'data':>7} {'bss':>7} {'noinit':>7} {'total':>7}")
+    for module, kinds in sorted(modules.items(), key=lambda kv: -sum(kv[1].values())):
+        row = [kinds[k] for k in ("data", "bss", "noinit")]
+        for k, v in zip(("data", "bss", "noinit"), row):
+            total[k] += v
+        print(f"{module:<32} {row[0]:>7} {row[1]:>7} {row[2]:>7} {sum(row):>7}")
+    used = sum(total.values())
+    print(f"{'total':<32} {total['data']:>7} {total['bss']:>7} {total['noinit']:>7} {used:>7}")
+    print(f"{args.ram}: {used} of {ram_len} bytes ({100.0 * used / ram_len:.1f}%), "
+          f"{ram_len - used} free")
+
+    if args.top:
+        print()
+        print(f"Largest {args.top} sections:")
+        for size, name, module in sorted(sections, reverse=True)[:args.top]:
+            print(f"  {size:>7} {name:<48} {module}")
+
+
+if __name__ == "__main__":
+    main()
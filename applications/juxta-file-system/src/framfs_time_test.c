@@ -36,6 +36,12 @@ static uint32_t get_test_rtc_date(void)
     return 240120; /* 24 = year, 01 = month, 20 = day */
 }
 
+/* Mock RTC for the day after, as seen by a restart past midnight */
+static uint32_t get_test_rtc_next_date(void)
+{
+    return 240121;
+}
+
 /**
  * @brief Test time-aware API initialization
  */
@@ -292,6 +298,71 @@ static int test_time_file_management(void)
     return 0;
 }
 
+/**
+ * @brief Test a restart on a later date with the previous day's file still active
+ */
+static int test_time_restart_new_day(void)
+{
+    int ret;
+    uint8_t data[] = {0x52, 0x53};
+    struct juxta_framfs_entry entry;
+    char current_file[JUXTA_FRAMFS_FILENAME_LEN];
+
+    LOG_INF("🔄 Testing restart on a new day...");
+
+    ret = juxta_framfs_format(&fs_ctx);
+    if (ret < 0)
+    {
+        LOG_ERR("❌ Failed to format file system: %d", ret);
+        return ret;
+    }
+
+    ret = juxta_framfs_init_with_time(&time_ctx, &fs_ctx, get_test_rtc_date, true);
+    if (ret == 0)
+    {
+        ret = juxta_framfs_append_data(&time_ctx, data, sizeof(data));
+    }
+    if (ret < 0)
+    {
+        LOG_ERR("❌ Failed to write the first day: %d", ret);
+        return ret;
+    }
+
+    /* Restart: file system and time context come up again, RTC is a day later */
+    ret = juxta_framfs_init(&fs_ctx, &fram_dev);
+    if (ret == 0)
+    {
+        ret = juxta_framfs_init_with_time(&time_ctx, &fs_ctx, get_test_rtc_next_date, true);
+    }
+    if (ret == 0)
+    {
+        ret = juxta_framfs_append_data(&time_ctx, data, sizeof(data));
+    }
+    if (ret < 0)
+    {
+        LOG_ERR("❌ Failed to write after restart: %d", ret);
+        return ret;
+    }
+
+    ret = juxta_framfs_get_active_filename(&fs_ctx, current_file);
+    if (ret < 0 || strcmp(current_file, "240121") != 0)
+    {
+        LOG_ERR("❌ Append after restart went to %s, expected 240121", ret < 0 ? "?" : current_file);
+        return -1;
+    }
+
+    ret = juxta_framfs_get_file_info(&fs_ctx, "240120", &entry);
+    if (ret < 0 || (entry.flags & JUXTA_FRAMFS_FLAG_ACTIVE) || entry.length != sizeof(data))
+    {
+        LOG_ERR("❌ Previous day file not sealed intact (ret=%d, flags=0x%02X, length=%u)",
+                ret, entry.flags, entry.length);
+        return -1;
+    }
+
+    LOG_INF("✅ Restart on a new day sealed 240120 and wrote 240121");
+    return 0;
+}
+
 /**
  * @brief Test error handling and edge cases
  */
@@ -421,7 +492,12 @@ int framfs_time_test_main(void)
     if (ret < 0)
         return ret;
 
-    /* Step 3: Test file system error handling */
+    /* Step 3: Test a restart after midnight */
+    ret = test_time_restart_new_day();
+    if (ret < 0)
+        return ret;
+
+    /* Step 4: Test file system error handling */
     ret = test_time_error_handling();
     if (ret < 0)
         return ret;
@@ -25,6 +25,8 @@ static bool vitals_test_failed = false;
 /* Test function prototypes */
 static void test_vitals_init(void);
 static void test_vitals_timestamp(void);
+static void test_vitals_civil_sweep(void);
+static void test_vitals_unix_time(void);
 static void test_vitals_battery(void);
 static void test_vitals_system(void);
 static void test_vitals_summary(void);
@@ -185,6 +187,161 @@ static void test_vitals_timestamp(void)
     LOG_INF("──────────────────────────────────────────────────────────────");
 }
 
+static void test_vitals_civil_sweep(void)
+{
+    LOG_INF("🧪 Testing civil date conversion (1970-2100 vs gmtime)...");
+    LOG_INF("──────────────────────────────────────────────────────────────");
+
+    /* Test 1: Every day from 1970-01-01 to 2100-12-31, both directions
+     * (to 2037 if the C library still has a 32-bit time_t) */
+    uint32_t last_day = juxta_vitals_days_from_civil(sizeof(time_t) > 4 ? 2100 : 2037, 12, 31);
+    uint32_t mismatches = 0;
+    uint32_t start_ms = k_uptime_get_32();
+
+    for (uint32_t days = 0; days <= last_day; days++)
+    {
+        time_t t = (time_t)days * 86400;
+        struct tm expected;
+        gmtime_r(&t, &expected);
+
+        uint16_t year;
+        uint8_t month, day;
+        juxta_vitals_civil_from_days(days, &year, &month, &day);
+
+        if (year != expected.tm_year + 1900 || month != expected.tm_mon + 1 ||
+            day != expected.tm_mday || juxta_vitals_days_from_civil(year, month, day) != days)
+        {
+            if (mismatches++ < 5)
+            {
+                LOG_ERR("❌ Day %u: got %04u-%02u-%02u, gmtime %04d-%02d-%02d",
+                        days, year, month, day,
+                        expected.tm_year + 1900, expected.tm_mon + 1, expected.tm_mday);
+            }
+        }
+    }
+
+    if (mismatches)
+    {
+        LOG_ERR("❌ Civil date sweep: %u of %u days differ from gmtime", mismatches, last_day + 1);
+        vitals_test_failed = true;
+        return;
+    }
+    LOG_INF("  ✅ %u days match gmtime (%u ms)", last_day + 1, k_uptime_get_32() - start_ms);
+
+    /* Test 2: File date and minute of day around day boundaries */
+    static const struct
+    {
+        uint32_t timestamp;
+        uint32_t yymmdd;
+        uint16_t minute;
+    } boundaries[] = {
+        {1709164799, 240228, 1439}, /* 2024-02-28 23:59:59 */
+        {1709164800, 240229, 0},    /* 2024-02-29 00:00:00 (leap day) */
+        {1709251200, 240301, 0},    /* 2024-03-01 00:00:00 */
+        {1735689599, 241231, 1439}, /* 2024-12-31 23:59:59 */
+        {1735689600, 250101, 0},    /* 2025-01-01 00:00:00 */
+        {1738367999, 250131, 1439}, /* 2025-01-31 23:59:59 */
+        {1738368000, 250201, 0},    /* 2025-02-01 00:00:00 */
+        {4107542400, 301, 0},       /* 2100-03-01 00:00:00 (2100 is not a leap year) */
+    };
+
+    for (size_t i = 0; i < ARRAY_SIZE(boundaries); i++)
+    {
+        juxta_vitals_set_timestamp(&test_vitals, boundaries[i].timestamp);
+        uint32_t yymmdd = juxta_vitals_get_file_date_yymmdd(&test_vitals);
+        uint16_t minute = juxta_vitals_get_minute_of_day(&test_vitals);
+
+        if (yymmdd != boundaries[i].yymmdd)
+        {
+            LOG_ERR("❌ File date for %u: expected %06u, got %06u",
+                    boundaries[i].timestamp, boundaries[i].yymmdd, yymmdd);
+            vitals_test_failed = true;
+        }
+        /* The second call is answered from the cached day boundary */
+        if (juxta_vitals_get_file_date_yymmdd(&test_vitals) != yymmdd || minute != boundaries[i].minute)
+        {
+            LOG_ERR("❌ Cached date/minute for %u: minute %u (expected %u)",
+                    boundaries[i].timestamp, minute, boundaries[i].minute);
+            vitals_test_failed = true;
+        }
+    }
+
+    /* Restore the timestamp the other tests expect */
+    juxta_vitals_set_timestamp(&test_vitals, test_timestamp);
+
+    if (!vitals_test_failed)
+    {
+        LOG_INF("  ✅ File date and minute of day correct across day boundaries");
+    }
+    LOG_INF("──────────────────────────────────────────────────────────────");
+}
+
+static void test_vitals_unix_time(void)
+{
+    LOG_INF("🧪 Testing seconds/microseconds timebase...");
+    LOG_INF("──────────────────────────────────────────────────────────────");
+
+    uint32_t seconds, microseconds;
+    int ret = juxta_vitals_set_timestamp(&test_vitals, test_timestamp);
+    if (ret != 0)
+    {
+        LOG_ERR("❌ Failed to set timestamp: %d", ret);
+        vitals_test_failed = true;
+        return;
+    }
+
+    /* Test 1: 1.25 s after sync lands in the next second, ~250 ms in */
+    k_sleep(K_MSEC(1250));
+    ret = juxta_vitals_get_unix_time(&test_vitals, &seconds, &microseconds);
+    if (ret != 0 || seconds != test_timestamp + 1 || microseconds < 250000 || microseconds >= 350000)
+    {
+        LOG_ERR("❌ Unix time after 1250 ms: ret=%d %u.%06u (expected %u.25xxxx)",
+                ret, seconds, microseconds, test_timestamp + 1);
+        vitals_test_failed = true;
+        return;
+    }
+    LOG_INF("  ✅ Unix time after 1250 ms: %u.%06u", seconds, microseconds);
+
+    /* Test 2: Pairs never go backwards and stay in range across second boundaries */
+    uint64_t prev_us = (uint64_t)seconds * 1000000ULL + microseconds;
+    int64_t end = k_uptime_get() + 2100;
+    uint32_t reads = 0;
+    while (k_uptime_get() < end)
+    {
+        juxta_vitals_get_unix_time(&test_vitals, &seconds, &microseconds);
+        uint64_t now_us = (uint64_t)seconds * 1000000ULL + microseconds;
+        if (microseconds >= 1000000 || now_us < prev_us)
+        {
+            LOG_ERR("❌ Non-monotonic time: %llu -> %u.%06u",
+                    (unsigned long long)prev_us, seconds, microseconds);
+            vitals_test_failed = true;
+            return;
+        }
+        prev_us = now_us;
+        reads++;
+        k_busy_wait(97);
+    }
+    LOG_INF("  ✅ %u reads monotonic across 2 second boundaries", reads);
+
+    /* Test 3: The other accessors agree with the pair */
+    uint64_t unix_ms = juxta_vitals_get_unix_ms(&test_vitals);
+    juxta_vitals_get_unix_time(&test_vitals, &seconds, &microseconds);
+    uint64_t pair_ms = (uint64_t)seconds * 1000ULL + microseconds / 1000U;
+    if (pair_ms < unix_ms || pair_ms - unix_ms > 5)
+    {
+        LOG_ERR("❌ Unix ms %llu disagrees with pair %u.%06u",
+                (unsigned long long)unix_ms, seconds, microseconds);
+        vitals_test_failed = true;
+        return;
+    }
+
+    /* Reset to original timestamp for other tests */
+    juxta_vitals_set_timestamp(&test_vitals, test_timestamp);
+
+    LOG_INF("✅ All timebase tests passed");
+    LOG_INF("──────────────────────────────────────────────────────────────");
+}
+
 static void test_vitals_battery(void)
 {
     LOG_INF("🧪 Testing battery monitoring...");
@@ -626,6 +783,12 @@ int vitals_test_main(void)
     test_vitals_timestamp();
     k_sleep(K_MSEC(100));
 
+    test_vitals_civil_sweep();
+    k_sleep(K_MSEC(100));
+
+    test_vitals_unix_time();
+    k_sleep(K_MSEC(100));
+
     test_vitals_battery();
     k_sleep(K_MSEC(100));
 
@@ -12,6 +12,9 @@
 #include <zephyr/device.h>
 #include <zephyr/drivers/spi.h>
 #include <zephyr/drivers/gpio.h>
+#if IS_ENABLED(CONFIG_JUXTA_SPI_BUS)
+#include <juxta_spi_bus/spi_bus.h>
+#endif
 
 #ifdef __cplusplus
 extern "C"
@@ -26,6 +29,9 @@ extern "C"
         const struct device *spi_dev;
         struct spi_config spi_cfg;
         struct gpio_dt_spec cs_gpio; /* Store GPIO spec for CS control */
+#if IS_ENABLED(CONFIG_JUXTA_SPI_BUS)
+        struct juxta_spi_bus_client bus; /* Arbitrated access to the shared SPI bus */
+#endif
         bool initialized;
     };
 
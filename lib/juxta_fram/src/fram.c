@@ -9,17 +9,48 @@
 #include <zephyr/drivers/spi.h>
 #include <zephyr/drivers/gpio.h>
 #include <zephyr/logging/log.h>
+#include <juxta_prof/prof.h>
 #include <string.h>
 
 LOG_MODULE_REGISTER(juxta_fram, CONFIG_JUXTA_FRAM_LOG_LEVEL);
 
-/* Maximum transfer size to avoid stack overflow */
+JUXTA_PROF_DEFINE(fram_read);
+JUXTA_PROF_DEFINE(fram_write);
+
+/* Largest payload per bus hold; longer transfers are split so other SPI clients can run between chunks */
 #define MAX_FRAM_TRANSFER_SIZE 512
 
 /* Internal helper functions */
 static int fram_send_command(struct juxta_fram_device *fram_dev, uint8_t cmd);
 static int fram_write_enable(struct juxta_fram_device *fram_dev);
 
+/* Bus access: arbitrated when the shared SPI bus manager is enabled. Holding the
+ * bus also serializes use of the static transfer buffers below. */
+static inline void fram_bus_acquire(struct juxta_fram_device *fram_dev)
+{
+#if IS_ENABLED(CONFIG_JUXTA_SPI_BUS)
+    juxta_spi_bus_acquire(&fram_dev->bus);
+#endif
+}
+
+static inline void fram_bus_release(struct juxta_fram_device *fram_dev)
+{
+#if IS_ENABLED(CONFIG_JUXTA_SPI_BUS)
+    juxta_spi_bus_release(&fram_dev->bus);
+#endif
+}
+
+static int fram_transceive(struct juxta_fram_device *fram_dev,
+                           const struct spi_buf_set *tx,
+                           const struct spi_buf_set *rx)
+{
+#if IS_ENABLED(CONFIG_JUXTA_SPI_BUS)
+    return juxta_spi_bus_transceive(&fram_dev->bus, tx, rx);
+#else
+    return spi_transceive(fram_dev->spi_dev, &fram_dev->spi_cfg, tx, rx);
+#endif
+}
+
 /* Device tree initialization function - commented out due to missing DT macros
 int juxta_fram_init_dt(struct juxta_fram_device *fram_dev,
                        const struct device *fram_node,
@@ -86,6 +117,11 @@ int juxta_fram_init(struct juxta_fram_device *fram_dev,
     fram_dev->spi_cfg.cs.gpio.dt_flags = cs_spec->dt_flags;
     fram_dev->spi_cfg.cs.delay = 0;
 
+#if IS_ENABLED(CONFIG_JUXTA_SPI_BUS)
+    /* Bulk transfers: sensor clients are served first between chunks */
+    juxta_spi_bus_client_init(&fram_dev->bus, "fram", spi_dev, &fram_dev->spi_cfg, JUXTA_SPI_BUS_PRIO_LOW);
+#endif
+
     LOG_INF("FRAM initialized: freq=%d Hz, CS=P%d.%02d",
             frequency,
             cs_spec->port ? 1 : 0,
@@ -140,7 +176,7 @@ int juxta_fram_read_id(struct juxta_fram_device *fram_dev,
         .buffers = &rx_buf,
         .count = 1};
 
-    ret = spi_transceive(fram_dev->spi_dev, &fram_dev->spi_cfg, &tx, &rx);
+    ret = fram_transceive(fram_dev, &tx, &rx);
     if (ret < 0)
     {
         LOG_ERR("Failed to read device ID: %d", ret);
@@ -181,10 +217,10 @@ int juxta_fram_read_id(struct juxta_fram_device *fram_dev,
     return JUXTA_FRAM_OK;
 }
 
-int juxta_fram_write(struct juxta_fram_device *fram_dev,
-                     uint32_t address,
-                     const uint8_t *data,
-                     size_t length)
+static int fram_write_data(struct juxta_fram_device *fram_dev,
+                           uint32_t address,
+                           const uint8_t *data,
+                           size_t length)
 {
     int ret;
 
@@ -199,8 +235,10 @@ int juxta_fram_write(struct juxta_fram_device *fram_dev,
         return JUXTA_FRAM_ERROR_ADDR;
     }
 
-    /* Use static buffer to avoid stack overflow with large transfers */
-    static uint8_t write_tx_buf[4 + MAX_FRAM_TRANSFER_SIZE]; /* cmd + 3-byte address + data */
+    /* Command and address go out from a small header; the payload is sent
+     * straight from the caller's buffer as a second segment of the same
+     * transfer, so no staging copy is needed */
+    uint8_t header[4];
 
     /* Handle large transfers by chunking */
     size_t bytes_written = 0;
@@ -209,30 +247,33 @@ int juxta_fram_write(struct juxta_fram_device *fram_dev,
         size_t chunk_size = MIN(length - bytes_written, MAX_FRAM_TRANSFER_SIZE);
         uint32_t chunk_address = address + bytes_written;
 
+        /* WREN and WRITE go back to back in one bus hold so no other FRAM
+         * transfer can consume the write enable latch in between */
+        fram_bus_acquire(fram_dev);
+
         /* Send Write Enable command for each chunk */
         ret = fram_write_enable(fram_dev);
         if (ret < 0)
         {
+            fram_bus_release(fram_dev);
             return ret;
         }
 
-        /* Small delay between commands */
-        k_usleep(30);
-
-        write_tx_buf[0] = JUXTA_FRAM_CMD_WRITE;
-        write_tx_buf[1] = (chunk_address >> 16) & 0xFF; /* Address byte 2 (MSB) */
-        write_tx_buf[2] = (chunk_address >> 8) & 0xFF;  /* Address byte 1 */
-        write_tx_buf[3] = chunk_address & 0xFF;         /* Address byte 0 (LSB) */
-        memcpy(&write_tx_buf[4], data + bytes_written, chunk_size);
+        header[0] = JUXTA_FRAM_CMD_WRITE;
+        header[1] = (chunk_address >> 16) & 0xFF; /* Address byte 2 (MSB) */
+        header[2] = (chunk_address >> 8) & 0xFF;  /* Address byte 1 */
+        header[3] = chunk_address & 0xFF;         /* Address byte 0 (LSB) */
 
-        const struct spi_buf tx_buf_desc = {
-            .buf = write_tx_buf,
-            .len = 4 + chunk_size};
+        const struct spi_buf tx_bufs[] = {
+            {.buf = header, .len = sizeof(header)},
+            {.buf = (uint8_t *)(data + bytes_written), .len = chunk_size},
+        };
         const struct spi_buf_set tx = {
-            .buffers = &tx_buf_desc,
-            .count = 1};
+            .buffers = tx_bufs,
+            .count = ARRAY_SIZE(tx_bufs)};
 
-        ret = spi_write(fram_dev->spi_dev, &fram_dev->spi_cfg, &tx);
+        ret = fram_transceive(fram_dev, &tx, NULL);
+        fram_bus_release(fram_dev);
         if (ret < 0)
         {
             LOG_ERR("Failed to write FRAM data chunk: %d", ret);
@@ -246,10 +287,21 @@ int juxta_fram_write(struct juxta_fram_device *fram_dev,
     return JUXTA_FRAM_OK;
 }
 
-int juxta_fram_read(struct juxta_fram_device *fram_dev,
-                    uint32_t address,
-                    uint8_t *data,
-                    size_t length)
+int juxta_fram_write(struct juxta_fram_device *fram_dev,
+                     uint32_t address,
+                     const uint8_t *data,
+                     size_t length)
+{
+    JUXTA_PROF_START(start);
+    int ret = fram_write_data(fram_dev, address, data, length);
+    JUXTA_PROF_STOP(fram_write, start);
+    return ret;
+}
+
+static int fram_read_data(struct juxta_fram_device *fram_dev,
+                          uint32_t address,
+                          uint8_t *data,
+                          size_t length)
 {
     int ret;
 
@@ -264,9 +316,10 @@ int juxta_fram_read(struct juxta_fram_device *fram_dev,
         return JUXTA_FRAM_ERROR_ADDR;
     }
 
-    /* Use static buffers to avoid stack overflow with large transfers */
-    static uint8_t read_tx_buf[4 + MAX_FRAM_TRANSFER_SIZE]; /* cmd + 3-byte address + dummy bytes */
-    static uint8_t read_rx_buf[4 + MAX_FRAM_TRANSFER_SIZE];
+    /* Only command and address are sent; the controller clocks out dummy
+     * bytes for the rest. The four bytes received during the header are
+     * skipped and the data lands directly in the caller's buffer */
+    uint8_t header[4];
 
     /* Handle large transfers by chunking */
     size_t bytes_read = 0;
@@ -275,34 +328,37 @@ int juxta_fram_read(struct juxta_fram_device *fram_dev,
         size_t chunk_size = MIN(length - bytes_read, MAX_FRAM_TRANSFER_SIZE);
         uint32_t chunk_address = address + bytes_read;
 
-        read_tx_buf[0] = JUXTA_FRAM_CMD_READ;
-        read_tx_buf[1] = (chunk_address >> 16) & 0xFF; /* Address byte 2 (MSB) */
-        read_tx_buf[2] = (chunk_address >> 8) & 0xFF;  /* Address byte 1 */
-        read_tx_buf[3] = chunk_address & 0xFF;         /* Address byte 0 (LSB) */
-        memset(&read_tx_buf[4], 0x00, chunk_size);     /* Dummy bytes for data reception */
+        /* One bus hold per chunk: other clients can run between chunks */
+        fram_bus_acquire(fram_dev);
+
+        header[0] = JUXTA_FRAM_CMD_READ;
+        header[1] = (chunk_address >> 16) & 0xFF; /* Address byte 2 (MSB) */
+        header[2] = (chunk_address >> 8) & 0xFF;  /* Address byte 1 */
+        header[3] = chunk_address & 0xFF;         /* Address byte 0 (LSB) */
 
         const struct spi_buf tx_buf_desc = {
-            .buf = read_tx_buf,
-            .len = 4 + chunk_size};
-        const struct spi_buf rx_buf_desc = {
-            .buf = read_rx_buf,
-            .len = 4 + chunk_size};
+            .buf = header,
+            .len = sizeof(header)};
+        const struct spi_buf rx_bufs[] = {
+            {.buf = NULL, .len = sizeof(header)},
+            {.buf = data + bytes_read, .len = chunk_size},
+        };
         const struct spi_buf_set tx = {
             .buffers = &tx_buf_desc,
             .count = 1};
         const struct spi_buf_set rx = {
-            .buffers = &rx_buf_desc,
-            .count = 1};
+            .buffers = rx_bufs,
+            .count = ARRAY_SIZE(rx_bufs)};
 
-        ret = spi_transceive(fram_dev->spi_dev, &fram_dev->spi_cfg, &tx, &rx);
+        ret = fram_transceive(fram_dev, &tx, &rx);
         if (ret < 0)
         {
+            fram_bus_release(fram_dev);
             LOG_ERR("Failed to read FRAM data chunk: %d", ret);
             return JUXTA_FRAM_ERROR_SPI;
         }
 
-        /* Copy received data (skip command and address bytes) */
-        memcpy(data + bytes_read, &read_rx_buf[4], chunk_size);
+        fram_bus_release(fram_dev);
         bytes_read += chunk_size;
     }
 
@@ -310,6 +366,17 @@ int juxta_fram_read(struct juxta_fram_device *fram_dev,
     return JUXTA_FRAM_OK;
 }
 
+int juxta_fram_read(struct juxta_fram_device *fram_dev,
+                    uint32_t address,
+                    uint8_t *data,
+                    size_t length)
+{
+    JUXTA_PROF_START(start);
+    int ret = fram_read_data(fram_dev, address, data, length);
+    JUXTA_PROF_STOP(fram_read, start);
+    return ret;
+}
+
 int juxta_fram_test(struct juxta_fram_device *fram_dev, uint32_t test_address)
 {
     if (!fram_dev || !fram_dev->initialized)
@@ -371,7 +438,7 @@ static int fram_send_command(struct juxta_fram_device *fram_dev, uint8_t cmd)
         .buffers = &tx_buf,
         .count = 1};
 
-    int ret = spi_write(fram_dev->spi_dev, &fram_dev->spi_cfg, &tx);
+    int ret = fram_transceive(fram_dev, &tx, NULL);
     if (ret < 0)
     {
         LOG_ERR("Failed to send command 0x%02X: %d", cmd, ret);
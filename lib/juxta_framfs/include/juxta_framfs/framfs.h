@@ -70,6 +70,12 @@ extern "C"
 /* ADC record header size */
 #define JUXTA_FRAMFS_ADC_HEADER_SIZE 13 /* 12 bytes original + 1 byte event type */
 
+/* Multi-channel ADC events: (channel count - 1) is stored in the high nibble
+ * of the event type byte, so single-channel records are unchanged */
+#define JUXTA_FRAMFS_ADC_MAX_CHANNELS 4
+#define JUXTA_FRAMFS_ADC_EVENT_TYPE_MASK 0x0F
+#define JUXTA_FRAMFS_ADC_EVENT_CHANNELS_SHIFT 4
+
 /* Record type codes */
 #define JUXTA_FRAMFS_RECORD_TYPE_NO_ACTIVITY 0x00
 #define JUXTA_FRAMFS_RECORD_TYPE_DEVICE_MIN 0x01 /* 1 device */
@@ -77,7 +83,20 @@ extern "C"
 #define JUXTA_FRAMFS_RECORD_TYPE_BOOT 0xF1
 #define JUXTA_FRAMFS_RECORD_TYPE_CONNECTED 0xF2
 #define JUXTA_FRAMFS_RECORD_TYPE_SETTINGS 0xF3
+#define JUXTA_FRAMFS_RECORD_TYPE_RSSI_SERIES 0xF4 /* Per-burst RSSI, variable length */
 #define JUXTA_FRAMFS_RECORD_TYPE_ERROR 0xF5
+#define JUXTA_FRAMFS_RECORD_TYPE_ACTIVITY 0xF6 /* Per-minute accelerometer metrics */
+
+/* Activity records (0xF6) */
+#define JUXTA_FRAMFS_ACTIVITY_RECORD_SIZE 14
+
+/* RSSI series records (0xF4) */
+#define JUXTA_FRAMFS_RSSI_SERIES_HEADER_SIZE 5
+#define JUXTA_FRAMFS_RSSI_SERIES_MAX_PEERS 64
+#define JUXTA_FRAMFS_RSSI_SERIES_MAX_BURSTS 8
+#define JUXTA_FRAMFS_RSSI_SERIES_PEER_MAX_BYTES (2 + JUXTA_FRAMFS_RSSI_SERIES_MAX_BURSTS / 2)
+#define JUXTA_FRAMFS_RSSI_SERIES_MAX_SIZE (JUXTA_FRAMFS_RSSI_SERIES_HEADER_SIZE + \
+                                           JUXTA_FRAMFS_RSSI_SERIES_MAX_PEERS * (1 + JUXTA_FRAMFS_RSSI_SERIES_PEER_MAX_BYTES))
 
 /* Error types */
 #define JUXTA_FRAMFS_ERROR_TYPE_INIT 0x00
@@ -217,6 +236,23 @@ extern "C"
         uint8_t data[];         /* Variable length: 8-bit ADC samples */
     } __packed;
 
+    /**
+     * @brief Activity record structure (14 bytes)
+     *
+     * Used for type 0xF6 records, written after the device record of the
+     * same minute
+     */
+    struct juxta_framfs_activity_record
+    {
+        uint16_t minute;    /* 0-1439 for full day */
+        uint8_t type;       /* 0xF6 */
+        uint16_t samples;   /* Accelerometer samples summarised */
+        uint16_t odba_mg;   /* Mean ODBA in mg */
+        uint16_t vedba_mg;  /* Mean VeDBA in mg */
+        uint16_t sd_mg;     /* Standard deviation of |a| in mg */
+        int8_t posture[3];  /* Mean X/Y/Z acceleration in 16 mg units */
+    } __packed;
+
     /**
      * @brief File system context structure
      */
@@ -645,6 +681,40 @@ extern "C"
                                           uint16_t minute,
                                           uint8_t type);
 
+    /**
+     * @brief Append per-burst RSSI series record to active file with MAC indexing
+     *
+     * Layout: minute (2), type 0xF4, burst count, peer count, one MAC index
+     * per peer, then each peer's series: first RSSI, presence bitmap and
+     * 4-bit signed steps packed high nibble first.
+     *
+     * @param ctx File system context
+     * @param minute Minute of day (0-1439)
+     * @param burst_count Scan bursts in the minute (1-8)
+     * @param mac_ids Array of MAC IDs (3 bytes each)
+     * @param peer_count Number of peers (1-64)
+     * @param series Encoded peer series, back to back in @p mac_ids order
+     * @param series_len Length of @p series
+     * @return 0 on success, negative error code on failure
+     */
+    int juxta_framfs_append_rssi_series(struct juxta_framfs_context *ctx,
+                                        uint16_t minute,
+                                        uint8_t burst_count,
+                                        const uint8_t (*mac_ids)[3],
+                                        uint8_t peer_count,
+                                        const uint8_t *series,
+                                        size_t series_len);
+
+    /**
+     * @brief Append activity record to active file
+     *
+     * @param ctx File system context
+     * @param record Activity record (type is set to 0xF6)
+     * @return 0 on success, negative error code on failure
+     */
+    int juxta_framfs_append_activity(struct juxta_framfs_context *ctx,
+                                     const struct juxta_framfs_activity_record *record);
+
     /* ========================================================================
      * Primary File System API (Time-Aware)
      * ======================================================================== */
@@ -742,6 +812,27 @@ extern "C"
                                                uint16_t minute,
                                                uint8_t type);
 
+    /**
+     * @brief Append per-burst RSSI series with automatic file management (PRIMARY API)
+     *
+     * @see juxta_framfs_append_rssi_series()
+     */
+    int juxta_framfs_append_rssi_series_data(struct juxta_framfs_ctx *ctx,
+                                             uint16_t minute,
+                                             uint8_t burst_count,
+                                             const uint8_t (*mac_ids)[3],
+                                             uint8_t peer_count,
+                                             const uint8_t *series,
+                                             size_t series_len);
+
+    /**
+     * @brief Append activity record with automatic file management (PRIMARY API)
+     *
+     * @see juxta_framfs_append_activity()
+     */
+    int juxta_framfs_append_activity_data(struct juxta_framfs_ctx *ctx,
+                                          const struct juxta_framfs_activity_record *record);
+
     /**
      * @brief Append ADC burst with automatic file management (PRIMARY API)
      *
@@ -789,6 +880,38 @@ extern "C"
                                            uint8_t peak_positive,
                                            uint8_t peak_negative);
 
+    /**
+     * @brief Append multi-channel ADC event (ENHANCED API)
+     *
+     * Same header as juxta_framfs_append_adc_event_data() with the channel
+     * count encoded in the high nibble of the event type byte. Waveform data
+     * is stored channel-major (all samples of channel 0, then channel 1, ...);
+     * single events store one positive/negative peak pair per channel followed
+     * by one reserved byte.
+     *
+     * @param ctx File system context
+     * @param unix_timestamp Unix timestamp (seconds since epoch)
+     * @param microsecond_offset Microsecond offset within current second (0-999999)
+     * @param event_type Event type (0x00=timer, 0x01=peri-event, 0x02=single)
+     * @param channel_count Number of channels (1-JUXTA_FRAMFS_ADC_MAX_CHANNELS)
+     * @param samples Channel-major 8-bit samples (NULL for single events)
+     * @param sample_count Samples per channel (0 for single events)
+     * @param duration_us Actual measured duration in microseconds
+     * @param peaks_positive Per-channel peak positive amplitudes (single events only)
+     * @param peaks_negative Per-channel peak negative amplitudes (single events only)
+     * @return 0 on success, negative error code on failure
+     */
+    int juxta_framfs_append_adc_event_channels(struct juxta_framfs_ctx *ctx,
+                                               uint32_t unix_timestamp,
+                                               uint32_t microsecond_offset,
+                                               uint8_t event_type,
+                                               uint8_t channel_count,
+                                               const uint8_t *samples,
+                                               uint16_t sample_count,
+                                               uint32_t duration_us,
+                                               const uint8_t *peaks_positive,
+                                               const uint8_t *peaks_negative);
+
     /**
      * @brief Get current active filename
      *
@@ -7,11 +7,14 @@
 
 #include <juxta_framfs/framfs.h>
 #include <zephyr/logging/log.h>
+#include <juxta_prof/prof.h>
 #include <stdio.h>
 #include <string.h>
 
 LOG_MODULE_REGISTER(juxta_framfs, CONFIG_JUXTA_FRAMFS_LOG_LEVEL);
 
+JUXTA_PROF_DEFINE(framfs_append);
+
 /* Internal helper functions */
 static int framfs_read_header(struct juxta_framfs_context *ctx);
 static int framfs_write_header(struct juxta_framfs_context *ctx);
@@ -320,9 +323,9 @@ int juxta_framfs_create_active(struct juxta_framfs_context *ctx,
     return JUXTA_FRAMFS_OK;
 }
 
-int juxta_framfs_append(struct juxta_framfs_context *ctx,
-                        const uint8_t *data,
-                        size_t length)
+static int framfs_append_active(struct juxta_framfs_context *ctx,
+                                const uint8_t *data,
+                                size_t length)
 {
     if (!ctx || !ctx->initialized || !data || length == 0)
     {
@@ -393,6 +396,16 @@ int juxta_framfs_append(struct juxta_framfs_context *ctx,
     return JUXTA_FRAMFS_OK;
 }
 
+int juxta_framfs_append(struct juxta_framfs_context *ctx,
+                        const uint8_t *data,
+                        size_t length)
+{
+    JUXTA_PROF_START(start);
+    int ret = framfs_append_active(ctx, data, length);
+    JUXTA_PROF_STOP(framfs_append, start);
+    return ret;
+}
+
 int juxta_framfs_seal_active(struct juxta_framfs_context *ctx)
 {
     if (!ctx || !ctx->initialized)
@@ -477,7 +490,7 @@ int juxta_framfs_read(struct juxta_framfs_context *ctx,
 
     /* Read data from FRAM */
     uint32_t read_addr = entry.start_addr + offset;
-    LOG_INF("📁 FRAMFS READ: file=%s, entry.start_addr=0x%06X, offset=%u, read_addr=0x%06X, length=%zu",
+    LOG_DBG("📁 FRAMFS READ: file=%s, entry.start_addr=0x%06X, offset=%u, read_addr=0x%06X, length=%zu",
             filename, (unsigned)entry.start_addr, (unsigned)offset, (unsigned)read_addr, length);
 
     ret = juxta_fram_read(ctx->fram_dev, read_addr, buffer, length);
@@ -487,12 +500,12 @@ int juxta_framfs_read(struct juxta_framfs_context *ctx,
         return ret;
     }
 
-    LOG_INF("📁 FRAMFS READ SUCCESS: read %zu bytes from FRAM addr 0x%06X", length, (unsigned)read_addr);
+    LOG_DBG("📁 FRAMFS READ SUCCESS: read %zu bytes from FRAM addr 0x%06X", length, (unsigned)read_addr);
 
     /* Log first few bytes for debugging */
     if (length >= 12 && offset == 0)
     {
-        LOG_INF("📁 FRAMFS READ DATA (first 12 bytes): %02X%02X%02X%02X %02X%02X%02X%02X %02X%02X%02X%02X",
+        LOG_DBG("📁 FRAMFS READ DATA (first 12 bytes): %02X%02X%02X%02X %02X%02X%02X%02X %02X%02X%02X%02X",
                 buffer[0], buffer[1], buffer[2], buffer[3],
                 buffer[4], buffer[5], buffer[6], buffer[7],
                 buffer[8], buffer[9], buffer[10], buffer[11]);
@@ -1244,49 +1257,62 @@ int juxta_framfs_set_adc_config(struct juxta_framfs_context *ctx,
  * Data Encoding/Decoding Functions
  * ======================================================================== */
 
-int juxta_framfs_encode_device_record(const struct juxta_framfs_device_record *record,
-                                      uint8_t *buffer,
-                                      size_t buffer_size)
+/* Device record layout: minute (2, big-endian), device count, motion count,
+ * battery, temperature, then count MAC indices and count RSSI values.
+ * NULL @p mac_indices or @p rssi_values encode as zeros. */
+static int framfs_encode_device_fields(uint16_t minute, uint8_t device_count, uint8_t motion_count,
+                                       uint8_t battery_level, int8_t temperature,
+                                       const uint8_t *mac_indices, const int8_t *rssi_values,
+                                       uint8_t *buffer, size_t buffer_size)
 {
-    if (!record || !buffer)
+    /* Validate device count */
+    if (device_count > 128)
     {
+        LOG_WRN("Invalid device count: %d", device_count);
         return JUXTA_FRAMFS_ERROR;
     }
 
     /* Calculate required buffer size */
-    size_t required_size = 6 + (2 * record->type); /* minute + type + motion + battery + temp + mac_indices + rssi_values */
+    size_t required_size = 6 + (2 * device_count); /* minute + type + motion + battery + temp + mac_indices + rssi_values */
     if (buffer_size < required_size)
     {
         LOG_WRN("Buffer too small: %zu < %zu", buffer_size, required_size);
         return JUXTA_FRAMFS_ERROR_SIZE;
     }
 
-    /* Validate device count */
-    if (record->type > 128)
-    {
-        LOG_WRN("Invalid device count: %d", record->type);
-        return JUXTA_FRAMFS_ERROR;
-    }
-
     /* Encode fixed fields */
-    buffer[0] = (record->minute >> 8) & 0xFF; /* minute high byte */
-    buffer[1] = record->minute & 0xFF;        /* minute low byte */
-    buffer[2] = record->type;                 /* device count (0-128) */
-    buffer[3] = record->motion_count;         /* motion count */
-    buffer[4] = record->battery_level;        /* battery level */
-    buffer[5] = (uint8_t)record->temperature; /* temperature (signed) */
+    buffer[0] = (minute >> 8) & 0xFF; /* minute high byte */
+    buffer[1] = minute & 0xFF;        /* minute low byte */
+    buffer[2] = device_count;         /* device count (0-128) */
+    buffer[3] = motion_count;         /* motion count */
+    buffer[4] = battery_level;        /* battery level */
+    buffer[5] = (uint8_t)temperature; /* temperature (signed) */
 
     /* Encode variable fields */
-    size_t offset = 6;
-    for (int i = 0; i < record->type; i++)
+    for (int i = 0; i < device_count; i++)
     {
-        buffer[offset + i] = record->mac_indices[i];                /* MAC index */
-        buffer[offset + record->type + i] = record->rssi_values[i]; /* RSSI value */
+        buffer[6 + i] = mac_indices ? mac_indices[i] : 0;                         /* MAC index */
+        buffer[6 + device_count + i] = rssi_values ? (uint8_t)rssi_values[i] : 0; /* RSSI value */
     }
 
     return (int)required_size;
 }
 
+int juxta_framfs_encode_device_record(const struct juxta_framfs_device_record *record,
+                                      uint8_t *buffer,
+                                      size_t buffer_size)
+{
+    if (!record || !buffer)
+    {
+        return JUXTA_FRAMFS_ERROR;
+    }
+
+    return framfs_encode_device_fields(record->minute, record->type, record->motion_count,
+                                       record->battery_level, record->temperature,
+                                       record->mac_indices, record->rssi_values,
+                                       buffer, buffer_size);
+}
+
 int juxta_framfs_decode_device_record(const uint8_t *buffer,
                                       size_t buffer_size,
                                       struct juxta_framfs_device_record *record)
@@ -1378,37 +1404,32 @@ int juxta_framfs_append_device_scan(struct juxta_framfs_context *ctx,
         return JUXTA_FRAMFS_ERROR;
     }
 
-    /* Prepare device record */
-    struct juxta_framfs_device_record record;
-    record.minute = minute;
-    record.type = device_count;
-    record.motion_count = motion_count;
-    record.battery_level = battery_level;
-    record.temperature = temperature;
+    /* Only the indices are staged; a full juxta_framfs_device_record would
+     * double the stack use */
+    uint8_t mac_indices[128];
+    bool have_devices = device_count > 0 && mac_ids && rssi_values;
 
     /* Process MAC IDs and get indices (only if devices found) */
-    if (device_count > 0 && mac_ids && rssi_values)
+    if (have_devices)
     {
         for (int i = 0; i < device_count; i++)
         {
-            uint8_t mac_index;
-            int ret = juxta_framfs_mac_find_or_add(ctx, mac_ids[i], &mac_index);
+            int ret = juxta_framfs_mac_find_or_add(ctx, mac_ids[i], &mac_indices[i]);
             if (ret < 0)
             {
                 LOG_ERR("Failed to process MAC ID %d: %d", i, ret);
                 return ret;
             }
-            record.mac_indices[i] = mac_index;
-            record.rssi_values[i] = rssi_values[i];
         }
     }
 
-    /* Encode record */
     uint8_t buffer[6 + (2 * 128)]; /* Maximum size for 128 devices */
-    int encoded_size = juxta_framfs_encode_device_record(&record, buffer, sizeof(buffer));
+    int encoded_size = framfs_encode_device_fields(minute, device_count, motion_count, battery_level,
+                                                   temperature, have_devices ? mac_indices : NULL,
+                                                   have_devices ? rssi_values : NULL,
+                                                   buffer, sizeof(buffer));
     if (encoded_size < 0)
     {
-        LOG_ERR("Failed to encode device record: %d", encoded_size);
         return encoded_size;
     }
 
@@ -1453,6 +1474,81 @@ int juxta_framfs_append_simple_record(struct juxta_framfs_context *ctx,
     return juxta_framfs_append(ctx, buffer, 3);
 }
 
+int juxta_framfs_append_rssi_series(struct juxta_framfs_context *ctx,
+                                    uint16_t minute,
+                                    uint8_t burst_count,
+                                    const uint8_t (*mac_ids)[3],
+                                    uint8_t peer_count,
+                                    const uint8_t *series,
+                                    size_t series_len)
+{
+    if (!ctx || !ctx->initialized || !mac_ids || !series)
+    {
+        return JUXTA_FRAMFS_ERROR;
+    }
+
+    if (burst_count == 0 || burst_count > JUXTA_FRAMFS_RSSI_SERIES_MAX_BURSTS ||
+        peer_count == 0 || peer_count > JUXTA_FRAMFS_RSSI_SERIES_MAX_PEERS ||
+        series_len > (size_t)peer_count * JUXTA_FRAMFS_RSSI_SERIES_PEER_MAX_BYTES)
+    {
+        LOG_WRN("Invalid RSSI series: bursts=%u, peers=%u, len=%zu", burst_count, peer_count, series_len);
+        return JUXTA_FRAMFS_ERROR_SIZE;
+    }
+
+    uint8_t buffer[JUXTA_FRAMFS_RSSI_SERIES_MAX_SIZE];
+    buffer[0] = (minute >> 8) & 0xFF;
+    buffer[1] = minute & 0xFF;
+    buffer[2] = JUXTA_FRAMFS_RECORD_TYPE_RSSI_SERIES;
+    buffer[3] = burst_count;
+    buffer[4] = peer_count;
+
+    /* Same MAC table as the device record of this minute */
+    size_t offset = JUXTA_FRAMFS_RSSI_SERIES_HEADER_SIZE;
+    for (int i = 0; i < peer_count; i++)
+    {
+        uint8_t mac_index;
+        int ret = juxta_framfs_mac_find_or_add(ctx, mac_ids[i], &mac_index);
+        if (ret < 0)
+        {
+            LOG_ERR("Failed to process MAC ID %d: %d", i, ret);
+            return ret;
+        }
+        buffer[offset++] = mac_index;
+    }
+
+    memcpy(&buffer[offset], series, series_len);
+    offset += series_len;
+
+    return juxta_framfs_append(ctx, buffer, offset);
+}
+
+int juxta_framfs_append_activity(struct juxta_framfs_context *ctx,
+                                 const struct juxta_framfs_activity_record *record)
+{
+    if (!ctx || !ctx->initialized || !record)
+    {
+        return JUXTA_FRAMFS_ERROR;
+    }
+
+    uint8_t buffer[JUXTA_FRAMFS_ACTIVITY_RECORD_SIZE];
+    buffer[0] = (record->minute >> 8) & 0xFF;
+    buffer[1] = record->minute & 0xFF;
+    buffer[2] = JUXTA_FRAMFS_RECORD_TYPE_ACTIVITY;
+    buffer[3] = (record->samples >> 8) & 0xFF;
+    buffer[4] = record->samples & 0xFF;
+    buffer[5] = (record->odba_mg >> 8) & 0xFF;
+    buffer[6] = record->odba_mg & 0xFF;
+    buffer[7] = (record->vedba_mg >> 8) & 0xFF;
+    buffer[8] = record->vedba_mg & 0xFF;
+    buffer[9] = (record->sd_mg >> 8) & 0xFF;
+    buffer[10] = record->sd_mg & 0xFF;
+    buffer[11] = (uint8_t)record->posture[0];
+    buffer[12] = (uint8_t)record->posture[1];
+    buffer[13] = (uint8_t)record->posture[2];
+
+    return juxta_framfs_append(ctx, buffer, sizeof(buffer));
+}
+
 /* ========================================================================
  * Primary File System API (Time-Aware)
  * ======================================================================== */
@@ -1484,6 +1580,17 @@ int juxta_framfs_init_with_time(struct juxta_framfs_ctx *ctx,
     snprintf(ctx->current_filename, sizeof(ctx->current_filename),
              "%06u", ctx->current_file_date);
 
+    /* A file still active from an earlier date (restart after midnight) is
+     * sealed by the first append instead of being extended */
+    char active_filename[JUXTA_FRAMFS_FILENAME_LEN];
+    if (fs_ctx->active_file_index >= 0 &&
+        juxta_framfs_get_active_filename(fs_ctx, active_filename) == JUXTA_FRAMFS_OK &&
+        strcmp(active_filename, ctx->current_filename) != 0)
+    {
+        LOG_INF("📁 Active file %s is from another date, switching on first append", active_filename);
+        ctx->current_file_date = 0;
+    }
+
     LOG_INF("📁 File system initialized with date: %06u, filename: %s",
             ctx->current_file_date, ctx->current_filename);
 
@@ -1498,12 +1605,12 @@ int juxta_framfs_ensure_current_file(struct juxta_framfs_ctx *ctx)
         return JUXTA_FRAMFS_ERROR;
     }
 
-    LOG_INF("🔍 ensure_current_file called - checking date");
+    LOG_DBG("🔍 ensure_current_file called - checking date");
 
     /* Get current date from RTC */
     uint32_t current_date = ctx->get_rtc_time();
 
-    LOG_INF("📅 File system date check: current=%06u, stored=%06u",
+    LOG_DBG("📅 File system date check: current=%06u, stored=%06u",
             current_date, ctx->current_file_date);
 
     /* Check if we need to create or switch files */
@@ -1665,6 +1772,48 @@ int juxta_framfs_append_simple_record_data(struct juxta_framfs_ctx *ctx,
     return juxta_framfs_append_simple_record(ctx->fs_ctx, minute, type);
 }
 
+int juxta_framfs_append_rssi_series_data(struct juxta_framfs_ctx *ctx,
+                                         uint16_t minute,
+                                         uint8_t burst_count,
+                                         const uint8_t (*mac_ids)[3],
+                                         uint8_t peer_count,
+                                         const uint8_t *series,
+                                         size_t series_len)
+{
+    if (!ctx)
+    {
+        return JUXTA_FRAMFS_ERROR;
+    }
+
+    /* Ensure correct file is active */
+    int ret = juxta_framfs_ensure_current_file(ctx);
+    if (ret < 0)
+    {
+        return ret;
+    }
+
+    return juxta_framfs_append_rssi_series(ctx->fs_ctx, minute, burst_count,
+                                           mac_ids, peer_count, series, series_len);
+}
+
+int juxta_framfs_append_activity_data(struct juxta_framfs_ctx *ctx,
+                                      const struct juxta_framfs_activity_record *record)
+{
+    if (!ctx)
+    {
+        return JUXTA_FRAMFS_ERROR;
+    }
+
+    /* Ensure correct file is active */
+    int ret = juxta_framfs_ensure_current_file(ctx);
+    if (ret < 0)
+    {
+        return ret;
+    }
+
+    return juxta_framfs_append_activity(ctx->fs_ctx, record);
+}
+
 int juxta_framfs_get_current_filename(struct juxta_framfs_ctx *ctx,
                                       char *filename)
 {
@@ -1876,17 +2025,17 @@ int juxta_framfs_append_adc_burst_data(struct juxta_framfs_ctx *ctx,
     header[12] = JUXTA_FRAMFS_ADC_EVENT_TIMER_BURST; /* Event type */
 
     /* Write header directly to FRAM */
-    LOG_INF("📊 FRAMFS: Writing header to FRAM addr 0x%06X", (unsigned)write_addr);
+    LOG_DBG("📊 FRAMFS: Writing header to FRAM addr 0x%06X", (unsigned)write_addr);
     ret = juxta_fram_write(ctx->fs_ctx->fram_dev, write_addr, header, JUXTA_FRAMFS_ADC_HEADER_SIZE);
     if (ret < 0)
     {
         LOG_ERR("Failed to write ADC burst header to FRAM: %d", ret);
         return ret;
     }
-    LOG_INF("📊 FRAMFS: Header written successfully");
+    LOG_DBG("📊 FRAMFS: Header written successfully");
 
     /* Write samples directly to FRAM (no intermediate buffer) */
-    LOG_INF("📊 FRAMFS: Writing %u samples to FRAM addr 0x%06X",
+    LOG_DBG("📊 FRAMFS: Writing %u samples to FRAM addr 0x%06X",
             (unsigned)sample_count, (unsigned)(write_addr + JUXTA_FRAMFS_ADC_HEADER_SIZE));
     ret = juxta_fram_write(ctx->fs_ctx->fram_dev, write_addr + JUXTA_FRAMFS_ADC_HEADER_SIZE, samples, sample_count);
     if (ret < 0)
@@ -1894,7 +2043,7 @@ int juxta_framfs_append_adc_burst_data(struct juxta_framfs_ctx *ctx,
         LOG_ERR("Failed to write ADC burst samples to FRAM: %d", ret);
         return ret;
     }
-    LOG_INF("📊 FRAMFS: Samples written successfully");
+    LOG_DBG("📊 FRAMFS: Samples written successfully");
 
     /* Update entry with new length */
     entry.length += record_size;
@@ -1930,12 +2079,35 @@ int juxta_framfs_append_adc_event_data(struct juxta_framfs_ctx *ctx,
                                        uint32_t duration_us,
                                        uint8_t peak_positive,
                                        uint8_t peak_negative)
+{
+    return juxta_framfs_append_adc_event_channels(ctx, unix_timestamp, microsecond_offset,
+                                                  event_type, 1, samples, sample_count,
+                                                  duration_us, &peak_positive, &peak_negative);
+}
+
+int juxta_framfs_append_adc_event_channels(struct juxta_framfs_ctx *ctx,
+                                           uint32_t unix_timestamp,
+                                           uint32_t microsecond_offset,
+                                           uint8_t event_type,
+                                           uint8_t channel_count,
+                                           const uint8_t *samples,
+                                           uint16_t sample_count,
+                                           uint32_t duration_us,
+                                           const uint8_t *peaks_positive,
+                                           const uint8_t *peaks_negative)
 {
     if (!ctx || !ctx->fs_ctx || !ctx->fs_ctx->initialized)
     {
         return JUXTA_FRAMFS_ERROR;
     }
 
+    if (channel_count == 0 || channel_count > JUXTA_FRAMFS_ADC_MAX_CHANNELS ||
+        (event_type & ~JUXTA_FRAMFS_ADC_EVENT_TYPE_MASK) != 0)
+    {
+        LOG_WRN("Invalid ADC event: type=0x%02X, channels=%u", event_type, channel_count);
+        return JUXTA_FRAMFS_ERROR;
+    }
+
     /* Validate parameters based on event type */
     if (event_type == JUXTA_FRAMFS_ADC_EVENT_SINGLE_EVENT)
     {
@@ -1945,6 +2117,11 @@ int juxta_framfs_append_adc_event_data(struct juxta_framfs_ctx *ctx,
             LOG_WRN("Single event mode should not have samples");
             return JUXTA_FRAMFS_ERROR;
         }
+        if (!peaks_positive || !peaks_negative)
+        {
+            LOG_WRN("Single event mode requires peaks");
+            return JUXTA_FRAMFS_ERROR;
+        }
     }
     else
     {
@@ -1990,11 +2167,11 @@ int juxta_framfs_append_adc_event_data(struct juxta_framfs_ctx *ctx,
     uint32_t record_size;
     if (event_type == JUXTA_FRAMFS_ADC_EVENT_SINGLE_EVENT)
     {
-        record_size = JUXTA_FRAMFS_ADC_HEADER_SIZE + 3; /* 13-byte header + 2 peaks + 1 reserved */
+        record_size = JUXTA_FRAMFS_ADC_HEADER_SIZE + (2 * channel_count) + 1; /* 13-byte header + peaks + 1 reserved */
     }
     else
     {
-        record_size = JUXTA_FRAMFS_ADC_HEADER_SIZE + sample_count; /* 13-byte header + samples */
+        record_size = JUXTA_FRAMFS_ADC_HEADER_SIZE + ((uint32_t)sample_count * channel_count); /* 13-byte header + samples */
     }
 
     uint32_t write_addr = entry.start_addr + entry.length;
@@ -2004,8 +2181,8 @@ int juxta_framfs_append_adc_event_data(struct juxta_framfs_ctx *ctx,
         return JUXTA_FRAMFS_ERROR_FULL;
     }
 
-    LOG_DBG("📊 FRAMFS: Storing ADC event - type=%u, timestamp=%u, μs_offset=%u, samples=%u, duration=%u us",
-            event_type, (unsigned)unix_timestamp, (unsigned)microsecond_offset,
+    LOG_DBG("📊 FRAMFS: Storing ADC event - type=%u, channels=%u, timestamp=%u, μs_offset=%u, samples=%u, duration=%u us",
+            event_type, channel_count, (unsigned)unix_timestamp, (unsigned)microsecond_offset,
             (unsigned)sample_count, (unsigned)duration_us);
 
     /* Prepare header (13 bytes) - Same format for all event types */
@@ -2028,7 +2205,7 @@ int juxta_framfs_append_adc_event_data(struct juxta_framfs_ctx *ctx,
     }
     header[10] = (clamped_duration >> 8) & 0xFF;
     header[11] = clamped_duration & 0xFF;
-    header[12] = event_type; /* Event type */
+    header[12] = event_type | ((channel_count - 1) << JUXTA_FRAMFS_ADC_EVENT_CHANNELS_SHIFT); /* Event type + channels */
 
     /* Write header to FRAM */
     ret = juxta_fram_write(ctx->fs_ctx->fram_dev, write_addr, header, JUXTA_FRAMFS_ADC_HEADER_SIZE);
@@ -2041,13 +2218,17 @@ int juxta_framfs_append_adc_event_data(struct juxta_framfs_ctx *ctx,
     /* Write event-specific data */
     if (event_type == JUXTA_FRAMFS_ADC_EVENT_SINGLE_EVENT)
     {
-        /* Write peaks + reserved (event type now in header) */
-        uint8_t event_data[3];
-        event_data[0] = peak_positive;
-        event_data[1] = peak_negative;
-        event_data[2] = 0; /* Reserved */
+        /* Write per-channel peaks + reserved (event type now in header) */
+        uint8_t event_data[(2 * JUXTA_FRAMFS_ADC_MAX_CHANNELS) + 1];
+        for (uint8_t ch = 0; ch < channel_count; ch++)
+        {
+            event_data[2 * ch] = peaks_positive[ch];
+            event_data[(2 * ch) + 1] = peaks_negative[ch];
+        }
+        event_data[2 * channel_count] = 0; /* Reserved */
 
-        ret = juxta_fram_write(ctx->fs_ctx->fram_dev, write_addr + JUXTA_FRAMFS_ADC_HEADER_SIZE, event_data, 3);
+        ret = juxta_fram_write(ctx->fs_ctx->fram_dev, write_addr + JUXTA_FRAMFS_ADC_HEADER_SIZE,
+                               event_data, (2 * channel_count) + 1);
         if (ret < 0)
         {
             LOG_ERR("Failed to write ADC event data to FRAM: %d", ret);
@@ -2057,7 +2238,8 @@ int juxta_framfs_append_adc_event_data(struct juxta_framfs_ctx *ctx,
     else
     {
         /* Write samples for timer burst or peri-event */
-        ret = juxta_fram_write(ctx->fs_ctx->fram_dev, write_addr + JUXTA_FRAMFS_ADC_HEADER_SIZE, samples, sample_count);
+        ret = juxta_fram_write(ctx->fs_ctx->fram_dev, write_addr + JUXTA_FRAMFS_ADC_HEADER_SIZE,
+                               samples, (size_t)sample_count * channel_count);
         if (ret < 0)
         {
             LOG_ERR("Failed to write ADC samples to FRAM: %d", ret);
@@ -0,0 +1,116 @@
+/*
+ * JUXTA Hot-Path Cycle Profiler
+ *
+ * Named probes timed with the Cortex-M DWT cycle counter. Each probe keeps
+ * count/min/max/total and a log2 histogram of cycles per call. With
+ * CONFIG_JUXTA_PROF disabled every macro expands to nothing.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef JUXTA_PROF_H_
+#define JUXTA_PROF_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef CONFIG_JUXTA_PROF
+
+#include <cmsis_core.h>
+
+    /**
+     * @brief Probe statistics
+     *
+     * Bin 0 counts calls under 2 cycles; bin i counts [2^i, 2^(i+1)); the
+     * last bin also takes everything longer.
+     */
+    struct juxta_prof_probe
+    {
+        const char *name;
+        struct juxta_prof_probe *next; /* Registration list */
+        bool listed;                   /* Set on first record */
+        uint32_t count;
+        uint32_t min_cyc;
+        uint32_t max_cyc;
+        uint64_t total_cyc;
+        uint32_t hist[CONFIG_JUXTA_PROF_HIST_BINS];
+    };
+
+    /**
+     * @brief Current DWT cycle count (CPU clock, stops while the CPU sleeps)
+     */
+    static inline uint32_t juxta_prof_cycles(void)
+    {
+        return DWT->CYCCNT;
+    }
+
+    /**
+     * @brief Enable the DWT cycle counter (idempotent)
+     *
+     * @return 0 on success, -ENOTSUP if the core has no cycle counter
+     */
+    int juxta_prof_init(void);
+
+    /**
+     * @brief Add one measurement to a probe (callable from any context)
+     */
+    void juxta_prof_record(struct juxta_prof_probe *probe, uint32_t cycles);
+
+    /**
+     * @brief Clear the statistics of every registered probe
+     */
+    void juxta_prof_reset(void);
+
+    /**
+     * @brief Log every registered probe (RTT) at INFO level
+     */
+    void juxta_prof_log(void);
+
+    /**
+     * @brief Write every registered probe as JSON
+     *
+     * {"hz":N,"p":[{"n":name,"c":count,"min":N,"max":N,"avg":N,"lo":bin,"h":[...]}]}
+     * where "h" holds the bins from "lo" to the last non-empty bin. Probes
+     * that do not fit are left out.
+     *
+     * @return Length written (excluding the terminator), negative on error
+     */
+    int juxta_prof_to_json(char *buffer, size_t buffer_size);
+
+/** Define a probe at file scope; several call sites may share one */
+#define JUXTA_PROF_DEFINE(probe) \
+    static struct juxta_prof_probe juxta_prof_##probe = {.name = #probe}
+
+/** Start timing; declares the local that holds the start count */
+#define JUXTA_PROF_START(var) uint32_t var = juxta_prof_cycles()
+
+/** Stop timing and record against a probe */
+#define JUXTA_PROF_STOP(probe, var) \
+    juxta_prof_record(&juxta_prof_##probe, juxta_prof_cycles() - (var))
+
+#else
+
+#define JUXTA_PROF_DEFINE(probe) struct juxta_prof_probe
+#define JUXTA_PROF_START(var) \
+    do                        \
+    {                         \
+    } while (0)
+#define JUXTA_PROF_STOP(probe, var) \
+    do                              \
+    {                               \
+    } while (0)
+
+#endif /* CONFIG_JUXTA_PROF */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JUXTA_PROF_H_ */
@@ -0,0 +1,187 @@
+/*
+ * JUXTA Hot-Path Cycle Profiler Implementation
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <juxta_prof/prof.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <stdio.h>
+#include <string.h>
+
+LOG_MODULE_REGISTER(juxta_prof, CONFIG_JUXTA_PROF_LOG_LEVEL);
+
+#define HIST_BINS CONFIG_JUXTA_PROF_HIST_BINS
+
+/*
+ * Probes register themselves on their first record, so only probes that
+ * actually ran are listed. Recording is a handful of instructions under
+ * the lock; the histogram bin is floor(log2(cycles)).
+ */
+static struct k_spinlock prof_lock;
+static struct juxta_prof_probe *probes;
+
+int juxta_prof_init(void)
+{
+    if (!(DWT->CTRL & DWT_CTRL_NOCYCCNT_Msk))
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+        LOG_INF("⏱️ Cycle profiler enabled (%u Hz)", SystemCoreClock);
+        return 0;
+    }
+
+    LOG_WRN("⏱️ No DWT cycle counter on this core");
+    return -ENOTSUP;
+}
+
+static inline uint32_t hist_bin(uint32_t cycles)
+{
+    uint32_t bin = (cycles > 1) ? (31U - __builtin_clz(cycles)) : 0U;
+
+    return MIN(bin, HIST_BINS - 1U);
+}
+
+void juxta_prof_record(struct juxta_prof_probe *probe, uint32_t cycles)
+{
+    k_spinlock_key_t key = k_spin_lock(&prof_lock);
+    if (probe->count == 0)
+    {
+        if (!probe->listed)
+        {
+            probe->next = probes;
+            probes = probe;
+            probe->listed = true;
+        }
+        probe->min_cyc = cycles;
+    }
+    else if (cycles < probe->min_cyc)
+    {
+        probe->min_cyc = cycles;
+    }
+    if (cycles > probe->max_cyc)
+    {
+        probe->max_cyc = cycles;
+    }
+    probe->count++;
+    probe->total_cyc += cycles;
+    probe->hist[hist_bin(cycles)]++;
+    k_spin_unlock(&prof_lock, key);
+}
+
+void juxta_prof_reset(void)
+{
+    k_spinlock_key_t key = k_spin_lock(&prof_lock);
+    for (struct juxta_prof_probe *p = probes; p; p = p->next)
+    {
+        p->count = 0;
+        p->min_cyc = 0;
+        p->max_cyc = 0;
+        p->total_cyc = 0;
+        memset(p->hist, 0, sizeof(p->hist));
+    }
+    k_spin_unlock(&prof_lock, key);
+}
+
+/* Copy under the lock so a dump never mixes two updates */
+static struct juxta_prof_probe *probe_snapshot(struct juxta_prof_probe *p, struct juxta_prof_probe *copy)
+{
+    k_spinlock_key_t key = k_spin_lock(&prof_lock);
+    struct juxta_prof_probe *next = p ? p->next : probes;
+    if (next)
+    {
+        *copy = *next;
+    }
+    k_spin_unlock(&prof_lock, key);
+    return next;
+}
+
+static void hist_range(const struct juxta_prof_probe *p, int *lo, int *hi)
+{
+    *lo = 0;
+    *hi = -1;
+    for (int i = 0; i < HIST_BINS; i++)
+    {
+        if (p->hist[i])
+        {
+            if (*hi < 0)
+            {
+                *lo = i;
+            }
+            *hi = i;
+        }
+    }
+}
+
+void juxta_prof_log(void)
+{
+    struct juxta_prof_probe copy;
+
+    if (!probes)
+    {
+        LOG_INF("⏱️ Profiler: no probes hit yet");
+        return;
+    }
+
+    LOG_INF("⏱️ Profiler (cycles @ %u Hz):", SystemCoreClock);
+    for (struct juxta_prof_probe *p = probe_snapshot(NULL, &copy); p; p = probe_snapshot(p, &copy))
+    {
+        int lo, hi;
+        hist_range(&copy, &lo, &hi);
+        LOG_INF("⏱️   %-14s n=%u min=%u avg=%u max=%u",
+                copy.name, copy.count, copy.min_cyc,
+                copy.count ? (uint32_t)(copy.total_cyc / copy.count) : 0, copy.max_cyc);
+        for (int i = lo; i <= hi; i++)
+        {
+            if (copy.hist[i])
+            {
+                LOG_INF("⏱️     >=2^%-2d %u", i, copy.hist[i]);
+            }
+        }
+    }
+}
+
+int juxta_prof_to_json(char *buffer, size_t buffer_size)
+{
+    struct juxta_prof_probe copy;
+
+    if (!buffer || buffer_size < 32)
+    {
+        return -EINVAL;
+    }
+
+    int written = snprintf(buffer, buffer_size, "{\"hz\":%u,\"p\":[", SystemCoreClock);
+    bool first = true;
+    for (struct juxta_prof_probe *p = probe_snapshot(NULL, &copy); p; p = probe_snapshot(p, &copy))
+    {
+        char entry[128 + HIST_BINS * 11];
+        int lo, hi;
+        hist_range(&copy, &lo, &hi);
+
+        int len = snprintf(entry, sizeof(entry), "%s{\"n\":\"%s\",\"c\":%u,\"min\":%u,\"max\":%u,\"avg\":%u,\"lo\":%d,\"h\":[",
+                           first ? "" : ",", copy.name, copy.count, copy.min_cyc, copy.max_cyc,
+                           copy.count ? (uint32_t)(copy.total_cyc / copy.count) : 0, lo);
+        for (int i = lo; i <= hi && len < sizeof(entry); i++)
+        {
+            len += snprintf(entry + len, sizeof(entry) - len, "%s%u", (i == lo) ? "" : ",", copy.hist[i]);
+        }
+        if (len < sizeof(entry))
+        {
+            len += snprintf(entry + len, sizeof(entry) - len, "]}");
+        }
+
+        /* Keep room for the closing "]}" */
+        if (len >= sizeof(entry) || written + len + 2 >= buffer_size)
+        {
+            continue;
+        }
+        memcpy(buffer + written, entry, len);
+        written += len;
+        first = false;
+    }
+
+    written += snprintf(buffer + written, buffer_size - written, "]}");
+    return written;
+}
@@ -0,0 +1,133 @@
+/*
+ * JUXTA Shared SPI Bus Manager
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef JUXTA_SPI_BUS_H_
+#define JUXTA_SPI_BUS_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/spi.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Client priority when several clients wait for the bus
+     *
+     * The bus is handed over at transaction (or batch) boundaries to the
+     * highest-priority waiter; ties are served in Zephyr wait-queue order.
+     */
+    enum juxta_spi_bus_prio
+    {
+        JUXTA_SPI_BUS_PRIO_HIGH = 0, /* Time-critical sensor access (FIFO drain) */
+        JUXTA_SPI_BUS_PRIO_LOW,      /* Bulk storage transfers */
+        JUXTA_SPI_BUS_PRIO_COUNT
+    };
+
+    /**
+     * @brief Per-client bus statistics
+     */
+    struct juxta_spi_bus_stats
+    {
+        uint32_t acquires;      /* Outermost acquisitions */
+        uint32_t contended;     /* Acquisitions that had to wait for another holder */
+        uint32_t transfers;     /* SPI transactions issued */
+        uint32_t wait_total_us; /* Time spent waiting for the bus */
+        uint32_t wait_max_us;
+        uint32_t hold_max_us;   /* Longest single hold, including batches */
+        uint32_t hold_total_us; /* Time holding the bus (wraps; diff successive reads) */
+    };
+
+    /**
+     * @brief Bus client (one per chip select)
+     *
+     * The SPI configuration is cached in the client so every transaction
+     * passes the same pointer; the nRF SPIM driver only reconfigures the
+     * peripheral when that pointer changes between transactions.
+     */
+    struct juxta_spi_bus_client
+    {
+        const char *name;
+        const struct device *spi_dev;
+        struct spi_config spi_cfg;
+        enum juxta_spi_bus_prio prio;
+        struct juxta_spi_bus_stats stats;
+    };
+
+    /**
+     * @brief Initialize a bus client
+     *
+     * @param client Client to initialize
+     * @param name Short name for statistics
+     * @param spi_dev SPI controller shared with other clients
+     * @param spi_cfg SPI configuration (copied into the client, including CS)
+     * @param prio Arbitration priority
+     * @return 0 on success, -EINVAL on invalid parameters
+     */
+    int juxta_spi_bus_client_init(struct juxta_spi_bus_client *client,
+                                  const char *name,
+                                  const struct device *spi_dev,
+                                  const struct spi_config *spi_cfg,
+                                  enum juxta_spi_bus_prio prio);
+
+    /**
+     * @brief Take exclusive use of the bus
+     *
+     * Nests for the calling thread, so a batch of back-to-back transactions
+     * can be wrapped in one acquire/release while each transaction still
+     * acquires on its own. Blocks until the bus is free; not callable
+     * from ISRs.
+     *
+     * @param client Client requesting the bus
+     */
+    void juxta_spi_bus_acquire(struct juxta_spi_bus_client *client);
+
+    /**
+     * @brief Release the bus (outermost release hands it to the next waiter)
+     *
+     * @param client Client holding the bus
+     */
+    void juxta_spi_bus_release(struct juxta_spi_bus_client *client);
+
+    /**
+     * @brief Run one SPI transaction with the client's configuration
+     *
+     * @param client Bus client
+     * @param tx TX buffers (may be NULL)
+     * @param rx RX buffers (may be NULL)
+     * @return 0 on success, negative error code on failure
+     */
+    int juxta_spi_bus_transceive(struct juxta_spi_bus_client *client,
+                                 const struct spi_buf_set *tx,
+                                 const struct spi_buf_set *rx);
+
+    /**
+     * @brief Run one write-only SPI transaction
+     */
+    static inline int juxta_spi_bus_write(struct juxta_spi_bus_client *client,
+                                          const struct spi_buf_set *tx)
+    {
+        return juxta_spi_bus_transceive(client, tx, NULL);
+    }
+
+    /**
+     * @brief Number of hand-overs between different clients since boot
+     */
+    uint32_t juxta_spi_bus_switches(void);
+
+    /**
+     * @brief Log a client's statistics at INFO level
+     */
+    void juxta_spi_bus_log_stats(const struct juxta_spi_bus_client *client);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JUXTA_SPI_BUS_H_ */
@@ -0,0 +1,180 @@
+/*
+ * JUXTA Shared SPI Bus Manager Implementation
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <juxta_spi_bus/spi_bus.h>
+#include <zephyr/logging/log.h>
+#include <string.h>
+
+LOG_MODULE_REGISTER(juxta_spi_bus, CONFIG_JUXTA_SPI_BUS_LOG_LEVEL);
+
+/*
+ * One arbiter for the shared controller. The holder keeps the bus until its
+ * outermost release; a release with waiters hands the bus directly to the
+ * highest-priority class, so a new arrival cannot jump ahead of it.
+ */
+static struct k_spinlock bus_lock;
+static bool bus_busy;
+static k_tid_t bus_owner; /* NULL while a hand-over is in flight */
+static uint8_t bus_depth;
+static struct juxta_spi_bus_client *bus_holder;
+static const struct juxta_spi_bus_client *last_holder; /* Compared only, never dereferenced */
+static uint32_t hold_start_cyc;
+static uint32_t bus_switches;
+static uint8_t waiting[JUXTA_SPI_BUS_PRIO_COUNT];
+
+static K_SEM_DEFINE(bus_wake_high, 0, K_SEM_MAX_LIMIT);
+static K_SEM_DEFINE(bus_wake_low, 0, K_SEM_MAX_LIMIT);
+static struct k_sem *const bus_wake[JUXTA_SPI_BUS_PRIO_COUNT] = {&bus_wake_high, &bus_wake_low};
+
+int juxta_spi_bus_client_init(struct juxta_spi_bus_client *client,
+                              const char *name,
+                              const struct device *spi_dev,
+                              const struct spi_config *spi_cfg,
+                              enum juxta_spi_bus_prio prio)
+{
+    if (!client || !spi_dev || !spi_cfg || prio >= JUXTA_SPI_BUS_PRIO_COUNT)
+    {
+        return -EINVAL;
+    }
+
+    memset(client, 0, sizeof(*client));
+    client->name = name ? name : "spi";
+    client->spi_dev = spi_dev;
+    client->spi_cfg = *spi_cfg;
+    client->prio = prio;
+    return 0;
+}
+
+void juxta_spi_bus_acquire(struct juxta_spi_bus_client *client)
+{
+    k_tid_t self = k_current_get();
+    uint32_t start = k_cycle_get_32();
+    bool contended = false;
+
+    k_spinlock_key_t key = k_spin_lock(&bus_lock);
+    if (bus_busy && bus_owner == self)
+    {
+        bus_depth++;
+        k_spin_unlock(&bus_lock, key);
+        return;
+    }
+
+    if (bus_busy)
+    {
+        waiting[client->prio]++;
+        k_spin_unlock(&bus_lock, key);
+
+        /* The releaser keeps bus_busy set and hands the bus over with this give */
+        k_sem_take(bus_wake[client->prio], K_FOREVER);
+        contended = true;
+        key = k_spin_lock(&bus_lock);
+    }
+
+    bus_busy = true;
+    bus_owner = self;
+    bus_depth = 1;
+    bus_holder = client;
+    if (last_holder != client)
+    {
+        if (last_holder)
+        {
+            bus_switches++;
+        }
+        last_holder = client;
+    }
+    hold_start_cyc = k_cycle_get_32();
+    k_spin_unlock(&bus_lock, key);
+
+    uint32_t wait_us = k_cyc_to_us_floor32(hold_start_cyc - start);
+    client->stats.acquires++;
+    client->stats.wait_total_us += wait_us;
+    if (contended)
+    {
+        client->stats.contended++;
+    }
+    if (wait_us > client->stats.wait_max_us)
+    {
+        client->stats.wait_max_us = wait_us;
+    }
+}
+
+void juxta_spi_bus_release(struct juxta_spi_bus_client *client)
+{
+    struct k_sem *wake = NULL;
+
+    k_spinlock_key_t key = k_spin_lock(&bus_lock);
+    if (!bus_busy || bus_owner != k_current_get())
+    {
+        k_spin_unlock(&bus_lock, key);
+        LOG_ERR("%s: release without holding the bus", client->name);
+        return;
+    }
+
+    if (--bus_depth > 0)
+    {
+        k_spin_unlock(&bus_lock, key);
+        return;
+    }
+
+    uint32_t hold_us = k_cyc_to_us_floor32(k_cycle_get_32() - hold_start_cyc);
+    bus_holder->stats.hold_total_us += hold_us;
+    if (hold_us > bus_holder->stats.hold_max_us)
+    {
+        bus_holder->stats.hold_max_us = hold_us;
+    }
+
+    bus_owner = NULL;
+    bus_holder = NULL;
+    for (int prio = 0; prio < JUXTA_SPI_BUS_PRIO_COUNT; prio++)
+    {
+        if (waiting[prio])
+        {
+            waiting[prio]--;
+            wake = bus_wake[prio];
+            break;
+        }
+    }
+    if (!wake)
+    {
+        bus_busy = false;
+    }
+    k_spin_unlock(&bus_lock, key);
+
+    if (wake)
+    {
+        k_sem_give(wake);
+    }
+}
+
+int juxta_spi_bus_transceive(struct juxta_spi_bus_client *client,
+                             const struct spi_buf_set *tx,
+                             const struct spi_buf_set *rx)
+{
+    juxta_spi_bus_acquire(client);
+    int ret = spi_transceive(client->spi_dev, &client->spi_cfg, tx, rx);
+    client->stats.transfers++;
+    juxta_spi_bus_release(client);
+    return ret;
+}
+
+uint32_t juxta_spi_bus_switches(void)
+{
+    return bus_switches;
+}
+
+void juxta_spi_bus_log_stats(const struct juxta_spi_bus_client *client)
+{
+    if (!client)
+    {
+        return;
+    }
+
+    const struct juxta_spi_bus_stats *s = &client->stats;
+    LOG_INF("SPI bus %s: acquires=%u contended=%u transfers=%u wait avg=%u max=%u us, hold max=%u us",
+            client->name, s->acquires, s->contended, s->transfers,
+            s->acquires ? s->wait_total_us / s->acquires : 0, s->wait_max_us, s->hold_max_us);
+}
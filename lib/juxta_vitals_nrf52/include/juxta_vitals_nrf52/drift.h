@@ -0,0 +1,81 @@
+/*
+ * JUXTA Vitals Library for nRF52 - Clock Drift Filter
+ * Scalar Kalman filter over gateway sync pairs. Plain C without Zephyr
+ * dependencies; vitals.c feeds it local and gateway intervals under its
+ * time lock.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef JUXTA_VITALS_NRF52_DRIFT_H
+#define JUXTA_VITALS_NRF52_DRIFT_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Filter tuning (CONFIG_JUXTA_VITALS_NRF52_* on target)
+     */
+    struct juxta_vitals_drift_config
+    {
+        uint32_t sync_error_ms;  /* Error of one gateway timestamp */
+        uint32_t min_interval_s; /* Shortest baseline that is measured */
+        uint32_t max_ppm;        /* Larger apparent drift is a gateway clock step */
+        uint32_t prior_ppm;      /* Uncertainty before the first measurement */
+        uint32_t wander_ppb;     /* Rate change per day (1 sigma) */
+    };
+
+    /**
+     * @brief Filter state
+     */
+    struct juxta_vitals_drift_filter
+    {
+        int32_t ppb;           /* Estimated rate error of the local clock (+ = fast) */
+        int32_t rate_corr_q32; /* -ppb as a Q32 fraction of elapsed ticks */
+        float var;             /* Variance of the estimate (ppb^2) */
+        uint16_t samples;      /* Measurements in the current estimate */
+        uint32_t interval_s;   /* Baseline of the latest measurement */
+    };
+
+    enum juxta_vitals_drift_result
+    {
+        JUXTA_VITALS_DRIFT_TOO_SHORT, /* Baseline below min_interval_s; keep the anchor */
+        JUXTA_VITALS_DRIFT_UPDATED,   /* Measurement taken; move the anchor */
+        JUXTA_VITALS_DRIFT_STEP,      /* Gateway clock stepped; filter reset, move the anchor */
+    };
+
+    /**
+     * @brief Reset to no drift with the prior uncertainty
+     */
+    void juxta_vitals_drift_reset(struct juxta_vitals_drift_filter *f,
+                                  const struct juxta_vitals_drift_config *cfg);
+
+    /**
+     * @brief Measure the rate error between two syncs and update the estimate
+     *
+     * @param local_us Local time elapsed since the anchor sync (uncorrected)
+     * @param gateway_s Gateway time elapsed over the same interval
+     * @param measured_ppb Output: the measured rate error, for logging
+     * @return What the caller does with its anchor, see the enum
+     */
+    enum juxta_vitals_drift_result juxta_vitals_drift_update(struct juxta_vitals_drift_filter *f,
+                                                             const struct juxta_vitals_drift_config *cfg,
+                                                             uint64_t local_us, int32_t gateway_s,
+                                                             int32_t *measured_ppb);
+
+    /**
+     * @brief 1-sigma time error @p age_s seconds after the last sync (ms)
+     */
+    float juxta_vitals_drift_uncertainty_ms(const struct juxta_vitals_drift_filter *f,
+                                            const struct juxta_vitals_drift_config *cfg, float age_s);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JUXTA_VITALS_NRF52_DRIFT_H */
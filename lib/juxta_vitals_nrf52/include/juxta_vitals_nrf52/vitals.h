@@ -11,6 +11,7 @@
 #include <zephyr/kernel.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include "juxta_vitals_nrf52/drift.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -50,13 +51,29 @@ extern "C"
         uint32_t last_update_time;  /* Last update time (uptime) */
 
         /* Microsecond precision timing */
-        uint32_t microsecond_reference;    /* RTC0 counter when timestamp was set */
+        uint64_t base_ticks;               /* Kernel tick count when timestamp was set */
         bool microsecond_tracking_enabled; /* Whether microsecond tracking is active */
 
-        /* Battery state */
-        uint16_t battery_mv;     /* Battery voltage in millivolts */
-        uint8_t battery_percent; /* Battery percentage (0-100) */
-        bool low_battery;        /* Low battery flag */
+        /* Drift estimation from gateway sync pairs (see juxta_vitals_sync_timestamp) */
+        uint64_t sync_ticks;       /* Tick count at the last gateway sync */
+        uint64_t anchor_ticks;     /* Tick count at the sync that started the current measurement */
+        uint32_t anchor_timestamp; /* Gateway time at that sync (0 = no sync yet) */
+        struct juxta_vitals_drift_filter drift; /* Estimate and Q32 correction */
+
+        /* Cached civil-time boundaries: file date and minute-of-day queries
+         * are one compare against these until the next midnight/minute */
+        uint32_t day_start;      /* Unix time of 00:00 UTC of the cached day */
+        uint32_t cached_yymmdd;  /* File date of the cached day (0 = none) */
+        uint32_t minute_start;   /* Unix time at the start of the cached minute */
+        uint16_t cached_minute;  /* Minute of day of the cached minute */
+        bool minute_cache_valid; /* cached_minute/minute_start are set */
+
+        /* Battery state (written by the sampler; read through the snapshot) */
+        uint16_t battery_mv;      /* Filtered battery voltage in millivolts */
+        uint8_t battery_percent;  /* Battery percentage (0-100) */
+        bool low_battery;         /* Low battery flag (with hysteresis) */
+        uint32_t battery_ema_q4;  /* EMA of samples, mV x 16 (0 = no sample yet) */
+        atomic_t battery_snapshot; /* Packed mv/percent/low/valid for lock-free readers */
 
         /* System state */
         uint32_t uptime_seconds; /* System uptime in seconds */
@@ -68,6 +85,28 @@ extern "C"
         bool temperature_monitoring; /* Temperature monitoring enabled */
     };
 
+    /**
+     * @brief Battery state as of the last background sample
+     */
+    struct juxta_vitals_battery
+    {
+        uint16_t mv;     /* Filtered voltage */
+        uint8_t percent; /* 0-100 */
+        bool low;        /* Below critical, until it recovers past the hysteresis */
+        bool valid;      /* At least one sample taken */
+    };
+
+    /**
+     * @brief Clock drift estimate
+     */
+    struct juxta_vitals_drift
+    {
+        int32_t ppb;              /* Rate error of the local clock (+ = fast), corrected out */
+        uint32_t sigma_ppb;       /* 1-sigma uncertainty of ppb */
+        uint16_t samples;         /* Measurements since the estimate (re)started */
+        uint32_t last_interval_s; /* Baseline of the latest measurement */
+    };
+
     /* ========================================================================
      * Core Functions
      * ======================================================================== */
@@ -116,6 +155,42 @@ extern "C"
      */
     int juxta_vitals_set_timestamp(struct juxta_vitals_ctx *ctx, uint32_t timestamp);
 
+    /**
+     * @brief Set the clock from a gateway and update the drift estimate
+     *
+     * Records the (local ticks, gateway time) pair. Once the previous
+     * measurement point is at least CONFIG_JUXTA_VITALS_NRF52_DRIFT_MIN_INTERVAL_S
+     * old, the rate error over that interval feeds a scalar Kalman filter
+     * whose estimate is corrected out of all later time queries. Then sets
+     * the timestamp like juxta_vitals_set_timestamp().
+     *
+     * @param ctx Vitals context
+     * @param timestamp Gateway Unix timestamp (seconds since epoch)
+     * @return 0 on success, negative error code on failure
+     */
+    int juxta_vitals_sync_timestamp(struct juxta_vitals_ctx *ctx, uint32_t timestamp);
+
+    /**
+     * @brief Get the current drift estimate
+     *
+     * @param ctx Vitals context
+     * @param drift Output: estimate (ppb = 0 with the prior sigma before
+     *              the first measurement)
+     * @return 0 on success, JUXTA_VITALS_ERROR_NOT_READY before the first gateway sync
+     */
+    int juxta_vitals_get_drift(struct juxta_vitals_ctx *ctx, struct juxta_vitals_drift *drift);
+
+    /**
+     * @brief Estimated 1-sigma error of the current time
+     *
+     * Sync error plus the residual drift uncertainty integrated since the
+     * last gateway sync.
+     *
+     * @param ctx Vitals context
+     * @return Uncertainty in ms, or UINT32_MAX before the first gateway sync
+     */
+    uint32_t juxta_vitals_get_time_uncertainty_ms(struct juxta_vitals_ctx *ctx);
+
     /**
      * @brief Get current Unix timestamp
      *
@@ -124,6 +199,33 @@ extern "C"
      */
     uint32_t juxta_vitals_get_timestamp(struct juxta_vitals_ctx *ctx);
 
+    /**
+     * @brief Get current Unix time as seconds and microseconds
+     *
+     * Both parts come from one read of the 64-bit kernel tick counter
+     * against one snapshot of the synchronization point, so the pair is
+     * consistent even across a second boundary or a concurrent
+     * juxta_vitals_set_timestamp(). Does not wrap during a deployment.
+     *
+     * @param ctx Vitals context
+     * @param seconds Output: Unix timestamp (seconds since epoch)
+     * @param microseconds Output: Microseconds within the second (0-999999)
+     * @return 0 on success, JUXTA_VITALS_ERROR_NOT_READY if no timestamp is set
+     */
+    int juxta_vitals_get_unix_time(struct juxta_vitals_ctx *ctx,
+                                   uint32_t *seconds, uint32_t *microseconds);
+
+    /**
+     * @brief Get current Unix time in milliseconds
+     *
+     * Same clock as juxta_vitals_get_timestamp(), with the milliseconds
+     * elapsed since the last full second.
+     *
+     * @param ctx Vitals context
+     * @return Unix time in ms, or 0 if not set
+     */
+    uint64_t juxta_vitals_get_unix_ms(struct juxta_vitals_ctx *ctx);
+
     /**
      * @brief Get current timestamp with microsecond precision
      *
@@ -154,7 +256,8 @@ extern "C"
      * This function returns the number of microseconds that have elapsed
      * since the microsecond reference was captured during BLE timestamp
      * synchronization. This provides a consistent 32-bit microsecond
-     * timestamp that's relative to the BLE sync point.
+     * timestamp that's relative to the BLE sync point; it wraps every
+     * 2^32 us (about 71.6 minutes), so use differences only.
      *
      * @param ctx Vitals context
      * @return Microseconds since BLE sync (0-4294967295), or 0 if not available
@@ -181,6 +284,30 @@ extern "C"
      */
     uint32_t juxta_vitals_get_date_yyyymmdd(struct juxta_vitals_ctx *ctx);
 
+    /**
+     * @brief Convert days since 1970-01-01 to a civil (Gregorian, UTC) date
+     *
+     * Constant time, valid for the full uint32_t Unix timestamp range.
+     *
+     * @param days Days since the Unix epoch
+     * @param year Output year (1970-2106)
+     * @param month Output month (1-12)
+     * @param day Output day of month (1-31)
+     */
+    void juxta_vitals_civil_from_days(uint32_t days, uint16_t *year, uint8_t *month, uint8_t *day);
+
+    /**
+     * @brief Convert a civil (Gregorian, UTC) date to days since 1970-01-01
+     *
+     * Constant time inverse of juxta_vitals_civil_from_days().
+     *
+     * @param year Year (1970 or later)
+     * @param month Month (1-12)
+     * @param day Day of month (1-31)
+     * @return Days since the Unix epoch
+     */
+    uint32_t juxta_vitals_days_from_civil(uint16_t year, uint8_t month, uint8_t day);
+
     /**
      * @brief Get current time in HHMMSS format
      *
@@ -240,6 +367,32 @@ extern "C"
      * Battery Functions
      * ======================================================================== */
 
+    /**
+     * @brief Take one battery sample and publish the filtered state
+     *
+     * One SAADC conversion (hardware oversampled), folded into an EMA
+     * (CONFIG_JUXTA_VITALS_NRF52_BATTERY_EMA_SHIFT). The low flag sets at
+     * JUXTA_VITALS_BATTERY_CRITICAL_MV and clears only
+     * CONFIG_JUXTA_VITALS_NRF52_BATTERY_LOW_HYST_MV above it. Blocks for
+     * the conversion: call it from a low-rate job while the radio is idle,
+     * so the EMA tracks the resting voltage.
+     *
+     * @param ctx Vitals context
+     * @return 0 on success, JUXTA_VITALS_ERROR_NOT_READY while battery
+     *         monitoring is off (the last snapshot is kept)
+     */
+    int juxta_vitals_sample_battery(struct juxta_vitals_ctx *ctx);
+
+    /**
+     * @brief Read the last published battery state
+     *
+     * Lock-free and ISR-safe; never touches the ADC.
+     *
+     * @param ctx Vitals context
+     * @param battery Output: battery state (valid = false before the first sample)
+     */
+    void juxta_vitals_get_battery(const struct juxta_vitals_ctx *ctx, struct juxta_vitals_battery *battery);
+
     /**
      * @brief Get battery voltage in millivolts
      *
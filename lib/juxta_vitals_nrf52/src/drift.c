@@ -0,0 +1,90 @@
+/*
+ * JUXTA Vitals Library for nRF52 - Clock Drift Filter
+ *
+ * Each measurement is the average rate error of the local clock against
+ * the gateway between two syncs, m = (local - gateway) / interval. Its
+ * noise comes from the two sync errors, so it shrinks with the interval;
+ * the true rate wanders with temperature. A scalar Kalman filter weighs
+ * both, so daily syncs converge within a few visits while a short
+ * interval barely moves a settled estimate.
+ *
+ * Copyright (c) 2025 NeurotechHub
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "juxta_vitals_nrf52/drift.h"
+#include <math.h>
+
+#define SECONDS_PER_DAY 86400.0f
+
+static float wander_var(const struct juxta_vitals_drift_config *cfg, float seconds)
+{
+    float wander = (float)cfg->wander_ppb;
+
+    return wander * wander * seconds / SECONDS_PER_DAY;
+}
+
+void juxta_vitals_drift_reset(struct juxta_vitals_drift_filter *f,
+                              const struct juxta_vitals_drift_config *cfg)
+{
+    float prior = (float)cfg->prior_ppm * 1000.0f;
+
+    f->ppb = 0;
+    f->rate_corr_q32 = 0;
+    f->var = prior * prior;
+    f->samples = 0;
+    f->interval_s = 0;
+}
+
+enum juxta_vitals_drift_result juxta_vitals_drift_update(struct juxta_vitals_drift_filter *f,
+                                                         const struct juxta_vitals_drift_config *cfg,
+                                                         uint64_t local_us, int32_t gateway_s,
+                                                         int32_t *measured_ppb)
+{
+    uint32_t interval_s = (uint32_t)(local_us / 1000000U);
+    if (interval_s < cfg->min_interval_s)
+    {
+        /* The baseline grows until it is worth measuring */
+        return JUXTA_VITALS_DRIFT_TOO_SHORT;
+    }
+
+    int64_t gateway_us = (int64_t)gateway_s * 1000000;
+    int64_t m = (((int64_t)local_us - gateway_us) * 1000) / interval_s;
+    *measured_ppb = (int32_t)((m < INT32_MIN) ? INT32_MIN : (m > INT32_MAX) ? INT32_MAX : m);
+
+    if (m > (int64_t)cfg->max_ppm * 1000 || m < -(int64_t)cfg->max_ppm * 1000)
+    {
+        /* Not a crystal: the gateway clock was stepped. Start over from here. */
+        juxta_vitals_drift_reset(f, cfg);
+        return JUXTA_VITALS_DRIFT_STEP;
+    }
+
+    float sigma_m = 1.41421356f * (float)cfg->sync_error_ms * 1e6f / (float)interval_s; /* two syncs, ppb */
+    float p = f->var + wander_var(cfg, (float)interval_s);
+    float r = sigma_m * sigma_m;
+    float gain = p / (p + r);
+    float drift = (float)f->ppb + gain * ((float)m - (float)f->ppb);
+
+    f->ppb = (int32_t)lroundf(drift);
+    f->var = (1.0f - gain) * p;
+    f->interval_s = interval_s;
+    if (f->samples < UINT16_MAX)
+    {
+        f->samples++;
+    }
+
+    /* Local time runs (1 + d) fast, so true elapsed = local * (1 - d / (1 + d)) */
+    float d = drift * 1e-9f;
+    f->rate_corr_q32 = (int32_t)lroundf(-d / (1.0f + d) * 4294967296.0f);
+
+    return JUXTA_VITALS_DRIFT_UPDATED;
+}
+
+float juxta_vitals_drift_uncertainty_ms(const struct juxta_vitals_drift_filter *f,
+                                        const struct juxta_vitals_drift_config *cfg, float age_s)
+{
+    /* The rate keeps wandering after the last measurement; ppb x s = ns */
+    float var = f->var + wander_var(cfg, age_s);
+
+    return (float)cfg->sync_error_ms + sqrtf(var) * age_s / 1e6f;
+}
@@ -14,14 +14,12 @@
 #include <math.h>
 #include <string.h>
 #include <stdio.h>
-#include <time.h>
-#include <hal/nrf_rtc.h>
 #include "juxta_vitals_nrf52/vitals.h"
 
 LOG_MODULE_REGISTER(juxta_vitals_nrf52, CONFIG_JUXTA_VITALS_NRF52_LOG_LEVEL);
 
 /* Forward declarations for static functions */
-static int juxta_vitals_read_battery_voltage(struct juxta_vitals_ctx *ctx);
+static int juxta_vitals_read_battery_voltage(struct juxta_vitals_ctx *ctx, int32_t *vdd_mv);
 static int juxta_vitals_read_temperature(struct juxta_vitals_ctx *ctx);
 
 /* ADC configuration */
@@ -39,11 +37,17 @@ static const struct device *temp_dev;
 static const struct device *rtc_dev = NULL; /* Disabled to avoid conflicts with BLE RTC */
 static bool rtc_alarm_set = false;
 static bool rtc_alarm_fired = false;
-static uint32_t rtc_start_time = 0;
 
 /* ADC buffer */
 static int16_t adc_sample_buffer;
 
+/* Guards the sync point (timestamp, base ticks) and the cached day/minute
+ * boundaries in the context */
+static struct k_spinlock time_lock;
+
+#define SECONDS_PER_DAY 86400U
+#define TICKS_PER_SEC ((uint64_t)CONFIG_SYS_CLOCK_TICKS_PER_SEC)
+
 /* ========================================================================
  * Core Functions
  * ======================================================================== */
@@ -124,8 +128,8 @@ int juxta_vitals_init(struct juxta_vitals_ctx *ctx, bool enable_battery_monitori
         LOG_DBG("  Oversampling: %d", adc_seq.oversampling);
         LOG_DBG("  Buffer Size: %d bytes", adc_seq.buffer_size);
 
-        /* Try an initial reading to verify setup */
-        ret = juxta_vitals_read_battery_voltage(ctx);
+        /* Try an initial reading to verify setup; it also seeds the filter */
+        ret = juxta_vitals_sample_battery(ctx);
         if (ret != 0)
         {
             LOG_ERR("Initial battery reading failed: %d", ret);
@@ -149,12 +153,12 @@ int juxta_vitals_update(struct juxta_vitals_ctx *ctx)
     uint32_t elapsed = current_time - ctx->last_update_time;
 
     /* Update uptime */
-    ctx->uptime_seconds = k_uptime_get_32() / 1000;
+    ctx->uptime_seconds = (uint32_t)(k_uptime_get() / 1000);
 
     /* Update battery voltage if monitoring is enabled */
     if (ctx->battery_monitoring && elapsed >= CONFIG_JUXTA_VITALS_NRF52_BATTERY_UPDATE_INTERVAL * 1000)
     {
-        int ret = juxta_vitals_read_battery_voltage(ctx);
+        int ret = juxta_vitals_sample_battery(ctx);
         if (ret < 0)
         {
             LOG_WRN("Failed to read battery voltage: %d", ret);
@@ -201,6 +205,71 @@ int juxta_vitals_get_summary(struct juxta_vitals_ctx *ctx, char *buffer, size_t
  * RTC Functions
  * ======================================================================== */
 
+/*
+ * Timebase: Unix time = timestamp set at sync + kernel ticks elapsed since.
+ * k_uptime_ticks() is the 64-bit extension of the system RTC kept by the
+ * kernel, so elapsed time never wraps. Elapsed ticks are scaled by the
+ * drift correction, then split into whole seconds and a sub-second
+ * remainder to keep the microsecond conversion in range; with the 32768 Hz
+ * nRF system clock both divisions are shifts.
+ */
+struct timebase_snapshot
+{
+    uint32_t timestamp;
+    uint64_t base_ticks;
+    int32_t rate_corr_q32;
+};
+
+static bool timebase_snapshot(struct juxta_vitals_ctx *ctx, struct timebase_snapshot *snap)
+{
+    k_spinlock_key_t key = k_spin_lock(&time_lock);
+    snap->timestamp = ctx->current_timestamp;
+    snap->base_ticks = ctx->base_ticks;
+    snap->rate_corr_q32 = ctx->drift.rate_corr_q32;
+    k_spin_unlock(&time_lock, key);
+
+    return snap->timestamp != 0;
+}
+
+/* elapsed * (1 + corr / 2^32), in two halves so the product cannot overflow */
+static uint64_t timebase_correct(uint64_t elapsed, int32_t corr_q32)
+{
+    uint32_t corr = (corr_q32 < 0) ? (uint32_t)(-(int64_t)corr_q32) : (uint32_t)corr_q32;
+    uint64_t adj = (elapsed >> 32) * corr + (((elapsed & UINT32_MAX) * corr) >> 32);
+
+    return (corr_q32 < 0) ? elapsed - adj : elapsed + adj;
+}
+
+static uint64_t timebase_elapsed_ticks(const struct timebase_snapshot *snap)
+{
+    uint64_t elapsed = (uint64_t)k_uptime_ticks() - snap->base_ticks;
+
+    return snap->rate_corr_q32 ? timebase_correct(elapsed, snap->rate_corr_q32) : elapsed;
+}
+
+static void timebase_split(uint64_t elapsed_ticks, uint32_t *seconds, uint32_t *microseconds)
+{
+    uint64_t whole = elapsed_ticks / TICKS_PER_SEC;
+    uint32_t rem = (uint32_t)(elapsed_ticks - whole * TICKS_PER_SEC);
+
+    *seconds = (uint32_t)whole;
+    *microseconds = k_ticks_to_us_floor32(rem); /* rem < 1 s, so < 1000000 */
+}
+
+static void timebase_set(struct juxta_vitals_ctx *ctx, uint32_t timestamp, uint64_t ticks)
+{
+    /* Store the timestamp with the tick count it refers to; readers take
+     * both under the same lock. The clock may have moved either way, so
+     * the date/minute caches are recomputed on next use. */
+    k_spinlock_key_t key = k_spin_lock(&time_lock);
+    ctx->base_ticks = ticks;
+    ctx->current_timestamp = timestamp;
+    ctx->microsecond_tracking_enabled = true;
+    ctx->cached_yymmdd = 0;
+    ctx->minute_cache_valid = false;
+    k_spin_unlock(&time_lock, key);
+}
+
 int juxta_vitals_set_timestamp(struct juxta_vitals_ctx *ctx, uint32_t timestamp)
 {
     if (!ctx)
@@ -208,121 +277,288 @@ int juxta_vitals_set_timestamp(struct juxta_vitals_ctx *ctx, uint32_t timestamp)
         return JUXTA_VITALS_ERROR_INVALID_PARAM;
     }
 
-    /* Store the timestamp and record the current uptime for reference */
-    ctx->current_timestamp = timestamp;
-    rtc_start_time = k_uptime_get_32();
+    uint64_t ticks = (uint64_t)k_uptime_ticks();
+    timebase_set(ctx, timestamp, ticks);
 
-    /* Set microsecond reference for RTC0-based timing */
-    ctx->microsecond_reference = NRF_RTC0->COUNTER;
-    ctx->microsecond_tracking_enabled = true;
+    LOG_INF("Timestamp set to %u (tick: %llu)", timestamp, (unsigned long long)ticks);
+    return JUXTA_VITALS_OK;
+}
+
+/* Drift estimation from gateway sync pairs; the filter itself is in drift.c */
+static const struct juxta_vitals_drift_config drift_cfg = {
+    .sync_error_ms = CONFIG_JUXTA_VITALS_NRF52_SYNC_ERROR_MS,
+    .min_interval_s = CONFIG_JUXTA_VITALS_NRF52_DRIFT_MIN_INTERVAL_S,
+    .max_ppm = CONFIG_JUXTA_VITALS_NRF52_DRIFT_MAX_PPM,
+    .prior_ppm = CONFIG_JUXTA_VITALS_NRF52_DRIFT_PRIOR_PPM,
+    .wander_ppb = CONFIG_JUXTA_VITALS_NRF52_DRIFT_WANDER_PPB,
+};
+
+static void drift_restart(struct juxta_vitals_ctx *ctx, uint64_t ticks, uint32_t timestamp)
+{
+    ctx->anchor_ticks = ticks;
+    ctx->anchor_timestamp = timestamp;
+    juxta_vitals_drift_reset(&ctx->drift, &drift_cfg);
+}
+
+/* Called with time_lock held; returns the measurement for logging, or false if none was taken */
+static bool drift_measure(struct juxta_vitals_ctx *ctx, uint64_t ticks, uint32_t timestamp,
+                          int32_t *measured_ppb)
+{
+    if (ctx->anchor_timestamp == 0)
+    {
+        drift_restart(ctx, ticks, timestamp);
+        return false;
+    }
+
+    uint64_t local_us = k_ticks_to_us_floor64(ticks - ctx->anchor_ticks);
+    int32_t gateway_s = (int32_t)(timestamp - ctx->anchor_timestamp);
+
+    if (juxta_vitals_drift_update(&ctx->drift, &drift_cfg, local_us, gateway_s, measured_ppb) ==
+        JUXTA_VITALS_DRIFT_TOO_SHORT)
+    {
+        /* Keep the anchor */
+        return false;
+    }
+
+    /* Measured, or restarted after a gateway clock step: either way the next
+     * measurement starts here */
+    ctx->anchor_ticks = ticks;
+    ctx->anchor_timestamp = timestamp;
+    return true;
+}
+
+int juxta_vitals_sync_timestamp(struct juxta_vitals_ctx *ctx, uint32_t timestamp)
+{
+    int32_t measured_ppb = 0;
+
+    if (!ctx || timestamp == 0)
+    {
+        return JUXTA_VITALS_ERROR_INVALID_PARAM;
+    }
+
+    uint64_t ticks = (uint64_t)k_uptime_ticks();
+
+    k_spinlock_key_t key = k_spin_lock(&time_lock);
+    bool measured = drift_measure(ctx, ticks, timestamp, &measured_ppb);
+    ctx->sync_ticks = ticks;
+    int32_t drift_ppb = ctx->drift.ppb;
+    uint16_t samples = ctx->drift.samples;
+    uint32_t sigma_ppb = (uint32_t)sqrtf(ctx->drift.var);
+    k_spin_unlock(&time_lock, key);
 
-    LOG_INF("Timestamp set to %u (uptime: %u ms, RTC0: %u)", timestamp, rtc_start_time, ctx->microsecond_reference);
+    timebase_set(ctx, timestamp, ticks);
+
+    if (measured && samples == 0)
+    {
+        LOG_WRN("⏱️ Gateway clock step (%d ppb apparent drift) - drift estimate restarted",
+                measured_ppb);
+    }
+    else if (measured)
+    {
+        LOG_INF("⏱️ Drift %d ppb ± %u (measured %d ppb, %u samples)",
+                drift_ppb, sigma_ppb, measured_ppb, samples);
+    }
+    LOG_INF("Timestamp synced to %u (tick: %llu)", timestamp, (unsigned long long)ticks);
+    return JUXTA_VITALS_OK;
+}
+
+int juxta_vitals_get_drift(struct juxta_vitals_ctx *ctx, struct juxta_vitals_drift *drift)
+{
+    if (!ctx || !drift)
+    {
+        return JUXTA_VITALS_ERROR_INVALID_PARAM;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&time_lock);
+    bool synced = ctx->anchor_timestamp != 0;
+    drift->ppb = ctx->drift.ppb;
+    drift->sigma_ppb = (uint32_t)sqrtf(ctx->drift.var);
+    drift->samples = ctx->drift.samples;
+    drift->last_interval_s = ctx->drift.interval_s;
+    k_spin_unlock(&time_lock, key);
+
+    return synced ? JUXTA_VITALS_OK : JUXTA_VITALS_ERROR_NOT_READY;
+}
+
+uint32_t juxta_vitals_get_time_uncertainty_ms(struct juxta_vitals_ctx *ctx)
+{
+    if (!ctx)
+    {
+        return UINT32_MAX;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&time_lock);
+    bool synced = ctx->anchor_timestamp != 0;
+    uint64_t sync_ticks = ctx->sync_ticks;
+    struct juxta_vitals_drift_filter drift = ctx->drift;
+    k_spin_unlock(&time_lock, key);
+
+    if (!synced)
+    {
+        return UINT32_MAX;
+    }
+
+    float age_s = (float)k_ticks_to_ms_floor64((uint64_t)k_uptime_ticks() - sync_ticks) / 1000.0f;
+    float error_ms = juxta_vitals_drift_uncertainty_ms(&drift, &drift_cfg, age_s);
+
+    return (error_ms >= (float)UINT32_MAX) ? UINT32_MAX : (uint32_t)error_ms;
+}
+
+int juxta_vitals_get_unix_time(struct juxta_vitals_ctx *ctx,
+                               uint32_t *seconds, uint32_t *microseconds)
+{
+    struct timebase_snapshot snap;
+    uint32_t elapsed_s, us;
+
+    if (!ctx || !seconds || !microseconds)
+    {
+        return JUXTA_VITALS_ERROR_INVALID_PARAM;
+    }
+
+    if (!timebase_snapshot(ctx, &snap))
+    {
+        *seconds = 0;
+        *microseconds = 0;
+        return JUXTA_VITALS_ERROR_NOT_READY;
+    }
+
+    timebase_split(timebase_elapsed_ticks(&snap), &elapsed_s, &us);
+    *seconds = snap.timestamp + elapsed_s;
+    *microseconds = us;
     return JUXTA_VITALS_OK;
 }
 
 uint32_t juxta_vitals_get_timestamp(struct juxta_vitals_ctx *ctx)
 {
+    uint32_t seconds, microseconds;
+
     if (!ctx)
     {
         return 0;
     }
 
-    if (ctx->current_timestamp == 0)
+    if (juxta_vitals_get_unix_time(ctx, &seconds, &microseconds) != JUXTA_VITALS_OK)
     {
         LOG_DBG("No timestamp set yet");
         return 0;
     }
 
-    /* Calculate elapsed time since timestamp was set */
-    uint32_t current_uptime = k_uptime_get_32();
-    uint32_t elapsed_seconds = (current_uptime - rtc_start_time) / 1000;
+    return seconds;
+}
 
-    /* Add elapsed seconds to the stored timestamp */
-    uint32_t current_timestamp = ctx->current_timestamp + elapsed_seconds;
+uint64_t juxta_vitals_get_unix_ms(struct juxta_vitals_ctx *ctx)
+{
+    uint32_t seconds, microseconds;
 
-    LOG_DBG("Current timestamp: %u (elapsed: %u seconds)", current_timestamp, elapsed_seconds);
+    if (!ctx || juxta_vitals_get_unix_time(ctx, &seconds, &microseconds) != JUXTA_VITALS_OK)
+    {
+        return 0;
+    }
 
-    return current_timestamp;
+    return (uint64_t)seconds * 1000 + microseconds / 1000;
 }
 
 uint64_t juxta_vitals_get_timestamp_with_microseconds(struct juxta_vitals_ctx *ctx)
 {
+    uint32_t seconds, microseconds;
+
     if (!ctx || !ctx->initialized)
     {
         return 0;
     }
 
-    uint32_t unix_timestamp = juxta_vitals_get_timestamp(ctx);
-    if (unix_timestamp == 0)
+    if (juxta_vitals_get_unix_time(ctx, &seconds, &microseconds) != JUXTA_VITALS_OK)
     {
         return 0;
     }
 
-    if (!ctx->microsecond_tracking_enabled)
-    {
-        /* Return Unix timestamp with zero microseconds if microsecond tracking not available */
-        return ((uint64_t)unix_timestamp << 32);
-    }
-
-    /* Use the new helper function to get microsecond offset within current second */
-    uint32_t microseconds = juxta_vitals_get_microsecond_offset(ctx);
-
     /* Combine Unix timestamp (upper 32 bits) with microseconds (lower 32 bits) */
-    return ((uint64_t)unix_timestamp << 32) | microseconds;
+    return ((uint64_t)seconds << 32) | microseconds;
 }
 
 uint32_t juxta_vitals_get_microsecond_offset(struct juxta_vitals_ctx *ctx)
 {
+    uint32_t seconds, microseconds;
+
     if (!ctx || !ctx->initialized || !ctx->microsecond_tracking_enabled)
     {
         return 0;
     }
 
-    /* Calculate microsecond offset from RTC0 counter */
-    uint32_t current_rtc_ticks = NRF_RTC0->COUNTER;
-    uint32_t elapsed_ticks = current_rtc_ticks - ctx->microsecond_reference;
-
-    /* Convert ticks to microseconds (32kHz = 32768 ticks per second) */
-    uint32_t microseconds = (elapsed_ticks * 1000000) / 32768;
+    if (juxta_vitals_get_unix_time(ctx, &seconds, &microseconds) != JUXTA_VITALS_OK)
+    {
+        return 0;
+    }
 
-    /* Return microseconds within current second (0-999999) */
-    return microseconds % 1000000;
+    /* Microseconds within current second (0-999999) */
+    return microseconds;
 }
 
 uint32_t juxta_vitals_get_rel_microseconds(struct juxta_vitals_ctx *ctx)
 {
+    struct timebase_snapshot snap;
+    uint32_t seconds, microseconds;
+
     if (!ctx || !ctx->initialized || !ctx->microsecond_tracking_enabled)
     {
         return 0;
     }
 
-    /* Calculate microsecond offset from RTC0 counter */
-    uint32_t current_rtc_ticks = NRF_RTC0->COUNTER;
-    uint32_t elapsed_ticks = current_rtc_ticks - ctx->microsecond_reference;
-
-    /* Convert ticks to microseconds (32kHz = 32768 ticks per second) */
-    uint32_t microseconds = (elapsed_ticks * 1000000) / 32768;
+    if (!timebase_snapshot(ctx, &snap))
+    {
+        return 0;
+    }
 
-    /* Return total microseconds since BLE sync (no modulo - full 32-bit range) */
-    return microseconds;
+    /* Total microseconds since BLE sync, modulo 2^32 */
+    timebase_split(timebase_elapsed_ticks(&snap), &seconds, &microseconds);
+    return seconds * 1000000U + microseconds;
 }
 
 uint32_t juxta_vitals_get_rel_microseconds_to_unix(struct juxta_vitals_ctx *ctx)
 {
-    if (!ctx || !ctx->initialized || !ctx->microsecond_tracking_enabled)
-    {
-        return 0;
-    }
+    /* Same clock and sync point: microseconds within current second */
+    return juxta_vitals_get_microsecond_offset(ctx);
+}
 
-    /* Calculate microsecond offset from RTC0 counter */
-    uint32_t current_rtc_ticks = NRF_RTC0->COUNTER;
-    uint32_t elapsed_ticks = current_rtc_ticks - ctx->microsecond_reference;
+/*
+ * Civil date conversion after Howard Hinnant's days_from_civil/civil_from_days:
+ * years start on March 1 so the leap day falls at the end, and 400-year eras
+ * of 146097 days make the whole conversion a handful of integer divisions.
+ * 719468 is the day number of 1970-01-01 counted from 0000-03-01.
+ */
+void juxta_vitals_civil_from_days(uint32_t days, uint16_t *year, uint8_t *month, uint8_t *day)
+{
+    uint32_t z = days + 719468U;
+    uint32_t era = z / 146097U;
+    uint32_t doe = z - era * 146097U;                                        /* [0, 146096] */
+    uint32_t yoe = (doe - doe / 1460U + doe / 36524U - doe / 146096U) / 365U; /* [0, 399] */
+    uint32_t doy = doe - (365U * yoe + yoe / 4U - yoe / 100U);               /* [0, 365] */
+    uint32_t mp = (5U * doy + 2U) / 153U;                                    /* [0, 11], March = 0 */
+    uint32_t m = (mp < 10U) ? mp + 3U : mp - 9U;
+
+    *day = (uint8_t)(doy - (153U * mp + 2U) / 5U + 1U);
+    *month = (uint8_t)m;
+    *year = (uint16_t)(yoe + era * 400U + (m <= 2U));
+}
 
-    /* Convert ticks to microseconds (32kHz = 32768 ticks per second) */
-    uint32_t microseconds = (elapsed_ticks * 1000000) / 32768;
+uint32_t juxta_vitals_days_from_civil(uint16_t year, uint8_t month, uint8_t day)
+{
+    uint32_t y = (uint32_t)year - (month <= 2);
+    uint32_t era = y / 400U;
+    uint32_t yoe = y - era * 400U;                                               /* [0, 399] */
+    uint32_t doy = (153U * (month > 2 ? month - 3U : month + 9U) + 2U) / 5U + day - 1U; /* [0, 365] */
+    uint32_t doe = yoe * 365U + yoe / 4U - yoe / 100U + doy;                     /* [0, 146096] */
+
+    return era * 146097U + doe - 719468U;
+}
 
-    /* Return microseconds within current second (0-999999) */
-    return microseconds % 1000000;
+static uint32_t yyyymmdd_from_timestamp(uint32_t timestamp)
+{
+    uint16_t year;
+    uint8_t month, day;
+
+    juxta_vitals_civil_from_days(timestamp / SECONDS_PER_DAY, &year, &month, &day);
+    return (uint32_t)year * 10000U + month * 100U + day;
 }
 
 uint32_t juxta_vitals_get_date_yyyymmdd(struct juxta_vitals_ctx *ctx)
@@ -332,53 +568,7 @@ uint32_t juxta_vitals_get_date_yyyymmdd(struct juxta_vitals_ctx *ctx)
         return 0;
     }
 
-    /* Convert Unix timestamp to date */
-    uint32_t days_since_epoch = ctx->current_timestamp / 86400;
-    uint32_t year = 1970;
-    uint32_t month = 1;
-    uint32_t day = 1;
-
-    /* Simple date calculation (approximate) */
-    while (days_since_epoch > 365)
-    {
-        if ((year % 4 == 0 && year % 100 != 0) || year % 400 == 0)
-        {
-            if (days_since_epoch > 366)
-            {
-                days_since_epoch -= 366;
-                year++;
-            }
-            else
-            {
-                break;
-            }
-        }
-        else
-        {
-            days_since_epoch -= 365;
-            year++;
-        }
-    }
-
-    /* Calculate month and day */
-    uint32_t days_in_month[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-    if ((year % 4 == 0 && year % 100 != 0) || year % 400 == 0)
-    {
-        days_in_month[1] = 29; /* February in leap year */
-    }
-
-    for (int i = 0; i < 12; i++)
-    {
-        if (days_since_epoch <= days_in_month[i])
-        {
-            month = i + 1;
-            day = days_since_epoch + 1; /* Add 1 since days are 1-based */
-            break;
-        }
-        days_since_epoch -= days_in_month[i];
-    }
-
-    return year * 10000 + month * 100 + day;
+    return yyyymmdd_from_timestamp(ctx->current_timestamp);
 }
 
 uint32_t juxta_vitals_get_time_hhmmss(struct juxta_vitals_ctx *ctx)
@@ -402,7 +592,7 @@ uint32_t juxta_vitals_get_time_hhmmss(struct juxta_vitals_ctx *ctx)
  * Battery Functions
  * ======================================================================== */
 
-static int juxta_vitals_read_battery_voltage(struct juxta_vitals_ctx *ctx)
+static int juxta_vitals_read_battery_voltage(struct juxta_vitals_ctx *ctx, int32_t *vdd_mv)
 {
     if (!ctx || !ctx->battery_monitoring || !adc_dev)
     {
@@ -430,11 +620,11 @@ static int juxta_vitals_read_battery_voltage(struct juxta_vitals_ctx *ctx)
     LOG_DBG("ADC Raw Value: %d", adc_sample_buffer);
 
     /* Convert to millivolts */
-    int32_t vdd_mv = adc_sample_buffer;
+    int32_t mv = adc_sample_buffer;
     ret = adc_raw_to_millivolts(adc_ref_internal(adc_dev),
                                 adc_cfg.gain,
                                 adc_seq.resolution,
-                                &vdd_mv);
+                                &mv);
     if (ret != 0)
     {
         LOG_ERR("ADC conversion failed: %d", ret);
@@ -444,59 +634,120 @@ static int juxta_vitals_read_battery_voltage(struct juxta_vitals_ctx *ctx)
     LOG_DBG("ADC Conversion:");
     LOG_DBG("  Raw Value: %d", adc_sample_buffer);
     LOG_DBG("  Reference (mV): %d", adc_ref_internal(adc_dev));
-    LOG_DBG("  Converted (mV): %d", vdd_mv);
+    LOG_DBG("  Converted (mV): %d", mv);
     LOG_DBG("  Expected VDD (3V): ~3000 mV");
     LOG_DBG("  Expected ADC reading (1/6 gain): ~500 mV");
 
-    ctx->battery_mv = vdd_mv;
+    *vdd_mv = mv;
+    return JUXTA_VITALS_OK;
+}
+
+/*
+ * Battery snapshot: the sampler is the only writer and publishes the whole
+ * state as one word, so readers (FRAM write gating, minute records, BLE
+ * responses) take one atomic load and never wait on the SAADC.
+ */
+#define BATT_SNAP_MV_MASK 0xFFFFU
+#define BATT_SNAP_PERCENT_SHIFT 16
+#define BATT_SNAP_LOW BIT(23)
+#define BATT_SNAP_VALID BIT(24)
 
-    /* Calculate battery percentage based on range between FULL and CRITICAL */
-    if (ctx->battery_mv >= JUXTA_VITALS_BATTERY_FULL_MV)
+static uint8_t battery_percent_from_mv(uint16_t mv)
+{
+    /* Linear between CRITICAL (0%) and FULL (100%) */
+    if (mv >= JUXTA_VITALS_BATTERY_FULL_MV)
     {
-        ctx->battery_percent = 100;
+        return 100;
     }
-    else if (ctx->battery_mv <= JUXTA_VITALS_BATTERY_CRITICAL_MV)
+    if (mv <= JUXTA_VITALS_BATTERY_CRITICAL_MV)
     {
-        ctx->battery_percent = 0;
+        return 0;
+    }
+
+    uint32_t range = JUXTA_VITALS_BATTERY_FULL_MV - JUXTA_VITALS_BATTERY_CRITICAL_MV;
+    uint32_t current = mv - JUXTA_VITALS_BATTERY_CRITICAL_MV;
+    return (uint8_t)((current * 100) / range);
+}
+
+int juxta_vitals_sample_battery(struct juxta_vitals_ctx *ctx)
+{
+    int32_t vdd_mv;
+
+    if (!ctx || !ctx->battery_monitoring)
+    {
+        return JUXTA_VITALS_ERROR_NOT_READY;
+    }
+
+    int ret = juxta_vitals_read_battery_voltage(ctx, &vdd_mv);
+    if (ret != 0)
+    {
+        return ret;
+    }
+
+    uint32_t sample_q4 = (uint32_t)CLAMP(vdd_mv, 0, UINT16_MAX) << 4;
+    if (ctx->battery_ema_q4 == 0)
+    {
+        ctx->battery_ema_q4 = sample_q4;
     }
     else
     {
-        uint32_t range = JUXTA_VITALS_BATTERY_FULL_MV - JUXTA_VITALS_BATTERY_CRITICAL_MV;
-        uint32_t current = ctx->battery_mv - JUXTA_VITALS_BATTERY_CRITICAL_MV;
-        ctx->battery_percent = (current * 100) / range;
+        int32_t step = ((int32_t)sample_q4 - (int32_t)ctx->battery_ema_q4) >> CONFIG_JUXTA_VITALS_NRF52_BATTERY_EMA_SHIFT;
+        ctx->battery_ema_q4 += step;
+    }
+
+    uint16_t mv = (uint16_t)((ctx->battery_ema_q4 + 8) >> 4);
+    if (mv <= JUXTA_VITALS_BATTERY_CRITICAL_MV)
+    {
+        ctx->low_battery = true;
+    }
+    else if (mv >= JUXTA_VITALS_BATTERY_CRITICAL_MV + CONFIG_JUXTA_VITALS_NRF52_BATTERY_LOW_HYST_MV)
+    {
+        ctx->low_battery = false;
     }
+    ctx->battery_mv = mv;
+    ctx->battery_percent = battery_percent_from_mv(mv);
 
-    /* Set low battery flag when voltage drops below critical threshold */
-    ctx->low_battery = (ctx->battery_mv <= JUXTA_VITALS_BATTERY_CRITICAL_MV);
+    atomic_set(&ctx->battery_snapshot,
+               (atomic_val_t)(mv | ((uint32_t)ctx->battery_percent << BATT_SNAP_PERCENT_SHIFT) |
+                              (ctx->low_battery ? BATT_SNAP_LOW : 0) | BATT_SNAP_VALID));
 
+    LOG_DBG("Battery sample %d mV, filtered %u mV (%u%%)%s", vdd_mv, mv, ctx->battery_percent,
+            ctx->low_battery ? " LOW" : "");
     return JUXTA_VITALS_OK;
 }
 
+void juxta_vitals_get_battery(const struct juxta_vitals_ctx *ctx, struct juxta_vitals_battery *battery)
+{
+    uint32_t snap = ctx ? (uint32_t)atomic_get(&ctx->battery_snapshot) : 0;
+
+    battery->mv = (uint16_t)(snap & BATT_SNAP_MV_MASK);
+    battery->percent = (uint8_t)((snap >> BATT_SNAP_PERCENT_SHIFT) & 0x7F);
+    battery->low = (snap & BATT_SNAP_LOW) != 0;
+    battery->valid = (snap & BATT_SNAP_VALID) != 0;
+}
+
 uint16_t juxta_vitals_get_battery_mv(struct juxta_vitals_ctx *ctx)
 {
-    if (!ctx)
-    {
-        return 0;
-    }
-    return ctx->battery_mv;
+    struct juxta_vitals_battery battery;
+
+    juxta_vitals_get_battery(ctx, &battery);
+    return battery.mv;
 }
 
 uint8_t juxta_vitals_get_battery_percent(struct juxta_vitals_ctx *ctx)
 {
-    if (!ctx)
-    {
-        return 0;
-    }
-    return ctx->battery_percent;
+    struct juxta_vitals_battery battery;
+
+    juxta_vitals_get_battery(ctx, &battery);
+    return battery.percent;
 }
 
 bool juxta_vitals_is_low_battery(struct juxta_vitals_ctx *ctx)
 {
-    if (!ctx)
-    {
-        return false;
-    }
-    return ctx->low_battery;
+    struct juxta_vitals_battery battery;
+
+    juxta_vitals_get_battery(ctx, &battery);
+    return battery.low;
 }
 
 /* ========================================================================
@@ -609,57 +860,25 @@ uint32_t juxta_vitals_get_file_date_yymmdd(struct juxta_vitals_ctx *ctx)
         return 0;
     }
 
-    /* Convert live Unix timestamp to date */
-    uint32_t days_since_epoch = live_timestamp / 86400;
-    uint32_t year = 1970;
-    uint32_t month = 1;
-    uint32_t day = 1;
-
-    /* Simple date calculation (approximate) */
-    while (days_since_epoch > 365)
-    {
-        if ((year % 4 == 0 && year % 100 != 0) || year % 400 == 0)
-        {
-            if (days_since_epoch > 366)
-            {
-                days_since_epoch -= 366;
-                year++;
-            }
-            else
-            {
-                break;
-            }
-        }
-        else
-        {
-            days_since_epoch -= 365;
-            year++;
-        }
-    }
-
-    /* Calculate month and day */
-    uint32_t days_in_month[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-    if ((year % 4 == 0 && year % 100 != 0) || year % 400 == 0)
+    /* Called on every FRAMFS append: one compare until the next midnight */
+    k_spinlock_key_t key = k_spin_lock(&time_lock);
+    if (ctx->cached_yymmdd != 0 && (live_timestamp - ctx->day_start) < SECONDS_PER_DAY)
     {
-        days_in_month[1] = 29; /* February in leap year */
-    }
-
-    for (int i = 0; i < 12; i++)
-    {
-        if (days_since_epoch <= days_in_month[i])
-        {
-            month = i + 1;
-            day = days_since_epoch + 1; /* Add 1 since days are 1-based */
-            break;
-        }
-        days_since_epoch -= days_in_month[i];
+        uint32_t yymmdd = ctx->cached_yymmdd;
+        k_spin_unlock(&time_lock, key);
+        return yymmdd;
     }
+    k_spin_unlock(&time_lock, key);
 
     /* Convert to YYMMDD format (assume 20XX) */
-    uint32_t short_year = year % 100; /* Extract last 2 digits */
-    uint32_t yymmdd = short_year * 10000 + month * 100 + day;
+    uint32_t yymmdd = yyyymmdd_from_timestamp(live_timestamp) % 1000000U;
+    uint32_t day_start = live_timestamp - (live_timestamp % SECONDS_PER_DAY);
+
+    key = k_spin_lock(&time_lock);
+    ctx->day_start = day_start;
+    ctx->cached_yymmdd = yymmdd;
+    k_spin_unlock(&time_lock, key);
 
-    LOG_DBG("📅 File date calculation: timestamp=%u, YYMMDD=%06u", live_timestamp, yymmdd);
     LOG_INF("📅 Current file date: %06u (timestamp: %u)", yymmdd, live_timestamp);
 
     return yymmdd;
@@ -674,11 +893,18 @@ uint16_t juxta_vitals_get_minute_of_day(struct juxta_vitals_ctx *ctx)
     if (live_timestamp == 0)
         return 0;
 
-    struct tm timeinfo;
-    time_t time_sec = (time_t)live_timestamp;
-    gmtime_r(&time_sec, &timeinfo);
+    k_spinlock_key_t key = k_spin_lock(&time_lock);
+    if (!ctx->minute_cache_valid || (live_timestamp - ctx->minute_start) >= 60U)
+    {
+        uint32_t second_of_day = live_timestamp % SECONDS_PER_DAY;
+        ctx->minute_start = live_timestamp - (second_of_day % 60U);
+        ctx->cached_minute = (uint16_t)(second_of_day / 60U);
+        ctx->minute_cache_valid = true;
+    }
+    uint16_t minute = ctx->cached_minute;
+    k_spin_unlock(&time_lock, key);
 
-    return (uint16_t)(timeinfo.tm_hour * 60 + timeinfo.tm_min);
+    return minute;
 }
 
 bool juxta_vitals_validate_battery_level(uint8_t level)
@@ -694,14 +920,16 @@ int juxta_vitals_get_validated_battery_level(struct juxta_vitals_ctx *ctx, uint8
         return JUXTA_VITALS_ERROR_NOT_READY;
     }
 
-    if (!ctx->battery_monitoring)
+    /* Last published sample; still valid while sampling is paused for ADC capture */
+    struct juxta_vitals_battery battery;
+    juxta_vitals_get_battery(ctx, &battery);
+    if (!battery.valid)
     {
-        LOG_WRN("Battery monitoring not enabled");
+        LOG_WRN("No battery sample yet");
         return JUXTA_VITALS_ERROR_NOT_READY;
     }
 
-    /* Get current battery level */
-    uint8_t current_level = juxta_vitals_get_battery_percent(ctx);
+    uint8_t current_level = battery.percent;
 
     /* Validate the level */
     if (!juxta_vitals_validate_battery_level(current_level))